@@ -0,0 +1,460 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Transforms of large arrays of points and vectors by a single matrix
+ * Both array of structures (std::span<Float3>) and structure of arrays (Float3Stream) layouts are supported. The
+ * structure of arrays layout is the fastest since it needs no shuffling to feed the SIMD lanes.
+ */
+
+#pragma once
+
+#include <span>
+#include "Attributes.h"
+#include "Debug.h"
+#include "Intrinsics.h"
+#include "MathKernels.h"
+#include "Matrix.h"
+#include "SimdOperations.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    SSSENGINE_STATIC_ASSERT(sizeof(Float3) == 3 * sizeof(f32), "Float3 must be tightly packed to be used in batches")
+
+    /**
+     * @class Float3Stream
+     * @brief Structure of arrays layout of Float3. Every component array must have the same size
+     *
+     */
+    struct Float3Stream
+    {
+        std::span<f32> X;
+        std::span<f32> Y;
+        std::span<f32> Z;
+
+        SSSENGINE_PURE size Size() const noexcept
+        {
+            return X.size();
+        }
+    };
+
+    /**
+     * @class ConstFloat3Stream
+     * @brief Read only structure of arrays layout of Float3. Every component array must have the same size
+     *
+     */
+    struct ConstFloat3Stream
+    {
+        std::span<const f32> X;
+        std::span<const f32> Y;
+        std::span<const f32> Z;
+
+        ConstFloat3Stream() = default;
+
+        ConstFloat3Stream(std::span<const f32> x, std::span<const f32> y, std::span<const f32> z) : X{x}, Y{y}, Z{z} {}
+
+        // NOLINTNEXTLINE(*-explicit-constructor)
+        ConstFloat3Stream(const Float3Stream &stream) : X{stream.X}, Y{stream.Y}, Z{stream.Z} {}
+
+        SSSENGINE_PURE size Size() const noexcept
+        {
+            return X.size();
+        }
+    };
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        /**
+         * @brief The register with Lanes floats. Templates are keyed by the lane count because naming __m128 or __m256
+         * as a template argument drops their alignment attributes, which GCC warns about
+         */
+        template<size Lanes>
+        struct LaneRegister;
+
+        template<>
+        struct LaneRegister<4>
+        {
+            using Type = Vector128;
+        };
+
+        template<>
+        struct LaneRegister<8>
+        {
+            using Type = Vector256;
+        };
+
+        /**
+         * @brief The matrix elements used by the batch transforms broadcasted to every lane
+         * W of the translation is 1 for points and 0 for vectors
+         */
+        template<size Lanes>
+        struct BroadcastMatrix
+        {
+            using Register = typename LaneRegister<Lanes>::Type;
+
+            Register m00, m01, m02;
+            Register m10, m11, m12;
+            Register m20, m21, m22;
+            Register m30, m31, m32;
+        };
+
+        /**
+         * @brief Converts 4 packed Float3 (x0y0z0x1 y1z1x2y2 z2x3y3z3) to x0x1x2x3 y0y1y2y3 z0z1z2z3
+         * Works per 128 bit lane so it is used both by the SSE and AVX kernels
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE void Transpose3x4(Register a, Register b, Register c, Register &x, Register &y,
+                                                 Register &z)
+        {
+            const Register t0 = Shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b, c);
+            x = Shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, t0);
+
+            const Register t1 = Shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b);
+            const Register t2 = Shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b, c);
+            y = Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(t1, t2);
+
+            const Register t3 = Shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b);
+            z = Shuffle<_MM_SHUFFLE(3, 0, 2, 0)>(t3, c);
+        }
+
+        /**
+         * @brief The inverse of Transpose3x4
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE void Transpose4x3(Register x, Register y, Register z, Register &a, Register &b,
+                                                 Register &c)
+        {
+            constexpr int Even = _MM_SHUFFLE(2, 0, 2, 0);
+
+            a = Shuffle<Even>(Shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(x, y), Shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x));
+            b = Shuffle<Even>(Shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z), Shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(x, y));
+            c = Shuffle<Even>(Shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x), Shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z));
+        }
+
+        SSSENGINE_FORCE_INLINE BroadcastMatrix<4> Broadcast128(const Mat4x4f &matrix, f32 w)
+        {
+            const f32 *m = matrix.data;
+
+            return {
+                _mm_set1_ps(m[0]),
+                _mm_set1_ps(m[1]),
+                _mm_set1_ps(m[2]),
+                _mm_set1_ps(m[4]),
+                _mm_set1_ps(m[5]),
+                _mm_set1_ps(m[6]),
+                _mm_set1_ps(m[8]),
+                _mm_set1_ps(m[9]),
+                _mm_set1_ps(m[10]),
+                _mm_set1_ps(m[12] * w),
+                _mm_set1_ps(m[13] * w),
+                _mm_set1_ps(m[14] * w),
+            };
+        }
+
+        SSSENGINE_FORCE_INLINE void Transform4(const BroadcastMatrix<4> &m, Vector128 &x, Vector128 &y, Vector128 &z)
+        {
+            const Vector128 rx = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, m.m00), _mm_mul_ps(y, m.m10)), _mm_add_ps(_mm_mul_ps(z, m.m20), m.m30));
+            const Vector128 ry = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, m.m01), _mm_mul_ps(y, m.m11)), _mm_add_ps(_mm_mul_ps(z, m.m21), m.m31));
+            const Vector128 rz = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, m.m02), _mm_mul_ps(y, m.m12)), _mm_add_ps(_mm_mul_ps(z, m.m22), m.m32));
+
+            x = rx;
+            y = ry;
+            z = rz;
+        }
+
+#ifdef SSSENGINE_SIMD_AVX
+        SSSENGINE_FORCE_INLINE BroadcastMatrix<8> Broadcast256(const Mat4x4f &matrix, f32 w)
+        {
+            const f32 *m = matrix.data;
+
+            return {
+                _mm256_set1_ps(m[0]),
+                _mm256_set1_ps(m[1]),
+                _mm256_set1_ps(m[2]),
+                _mm256_set1_ps(m[4]),
+                _mm256_set1_ps(m[5]),
+                _mm256_set1_ps(m[6]),
+                _mm256_set1_ps(m[8]),
+                _mm256_set1_ps(m[9]),
+                _mm256_set1_ps(m[10]),
+                _mm256_set1_ps(m[12] * w),
+                _mm256_set1_ps(m[13] * w),
+                _mm256_set1_ps(m[14] * w),
+            };
+        }
+
+        SSSENGINE_FORCE_INLINE void Transform8(const BroadcastMatrix<8> &m, Vector256 &x, Vector256 &y, Vector256 &z)
+        {
+    #ifdef SSSENGINE_SIMD_FMA
+            const Vector256 rx = _mm256_fmadd_ps(x, m.m00, _mm256_fmadd_ps(y, m.m10, _mm256_fmadd_ps(z, m.m20, m.m30)));
+            const Vector256 ry = _mm256_fmadd_ps(x, m.m01, _mm256_fmadd_ps(y, m.m11, _mm256_fmadd_ps(z, m.m21, m.m31)));
+            const Vector256 rz = _mm256_fmadd_ps(x, m.m02, _mm256_fmadd_ps(y, m.m12, _mm256_fmadd_ps(z, m.m22, m.m32)));
+    #else
+            const Vector256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m.m00), _mm256_mul_ps(y, m.m10)),
+                                               _mm256_add_ps(_mm256_mul_ps(z, m.m20), m.m30));
+            const Vector256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m.m01), _mm256_mul_ps(y, m.m11)),
+                                               _mm256_add_ps(_mm256_mul_ps(z, m.m21), m.m31));
+            const Vector256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m.m02), _mm256_mul_ps(y, m.m12)),
+                                               _mm256_add_ps(_mm256_mul_ps(z, m.m22), m.m32));
+    #endif
+
+            x = rx;
+            y = ry;
+            z = rz;
+        }
+
+        SSSENGINE_FORCE_INLINE Vector256 LoadLanes(const f32 *low, const f32 *high)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+        }
+
+        SSSENGINE_FORCE_INLINE void StoreLanes(f32 *low, f32 *high, Vector256 value)
+        {
+            _mm_storeu_ps(low, _mm256_castps256_ps128(value));
+            _mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+        }
+#endif
+
+        /**
+         * @brief Transforms count packed Float3 (x, y, z, x, y, z...) from input into output
+         *
+         * @param w 1 to transform points (translation applied), 0 for vectors
+         * @return How many elements were transformed. The remainder must be done by the caller
+         */
+        SSSENGINE_FORCE_INLINE size TransformPacked(const Mat4x4f &matrix, const f32 *input, f32 *output, size count,
+                                                    f32 w)
+        {
+            size i = 0;
+#ifdef SSSENGINE_SIMD_AVX
+            {
+                const BroadcastMatrix<8> m = Broadcast256(matrix, w);
+                // NOTE: Each 128 bit lane gets 4 points so both lanes can use the same transpose as SSE
+                for(; i + 8 <= count; i += 8)
+                {
+                    const f32 *in = input + i * 3;
+                    f32 *out = output + i * 3;
+
+                    Vector256 x, y, z;
+                    Transpose3x4(
+                        LoadLanes(in, in + 12), LoadLanes(in + 4, in + 16), LoadLanes(in + 8, in + 20), x, y, z);
+                    Transform8(m, x, y, z);
+
+                    Vector256 a, b, c;
+                    Transpose4x3(x, y, z, a, b, c);
+                    StoreLanes(out, out + 12, a);
+                    StoreLanes(out + 4, out + 16, b);
+                    StoreLanes(out + 8, out + 20, c);
+                }
+            }
+#endif
+            const BroadcastMatrix<4> m = Broadcast128(matrix, w);
+            for(; i + 4 <= count; i += 4)
+            {
+                const f32 *in = input + i * 3;
+                f32 *out = output + i * 3;
+
+                Vector128 x, y, z;
+                Transpose3x4(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+                Transform4(m, x, y, z);
+
+                Vector128 a, b, c;
+                Transpose4x3(x, y, z, a, b, c);
+                _mm_storeu_ps(out, a);
+                _mm_storeu_ps(out + 4, b);
+                _mm_storeu_ps(out + 8, c);
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief Transforms count elements of a structure of arrays
+         *
+         * @param w 1 to transform points (translation applied), 0 for vectors
+         * @return How many elements were transformed. The remainder must be done by the caller
+         */
+        SSSENGINE_FORCE_INLINE size TransformStream(const Mat4x4f &matrix, const f32 *inX, const f32 *inY,
+                                                    const f32 *inZ, f32 *outX, f32 *outY, f32 *outZ, size count, f32 w)
+        {
+            size i = 0;
+#ifdef SSSENGINE_SIMD_AVX
+            {
+                const BroadcastMatrix<8> m = Broadcast256(matrix, w);
+                for(; i + 8 <= count; i += 8)
+                {
+                    Vector256 x = _mm256_loadu_ps(inX + i);
+                    Vector256 y = _mm256_loadu_ps(inY + i);
+                    Vector256 z = _mm256_loadu_ps(inZ + i);
+                    Transform8(m, x, y, z);
+                    _mm256_storeu_ps(outX + i, x);
+                    _mm256_storeu_ps(outY + i, y);
+                    _mm256_storeu_ps(outZ + i, z);
+                }
+            }
+#endif
+            const BroadcastMatrix<4> m = Broadcast128(matrix, w);
+            for(; i + 4 <= count; i += 4)
+            {
+                Vector128 x = _mm_loadu_ps(inX + i);
+                Vector128 y = _mm_loadu_ps(inY + i);
+                Vector128 z = _mm_loadu_ps(inZ + i);
+                Transform4(m, x, y, z);
+                _mm_storeu_ps(outX + i, x);
+                _mm_storeu_ps(outY + i, y);
+                _mm_storeu_ps(outZ + i, z);
+            }
+
+            return i;
+        }
+
+        SSSENGINE_FORCE_INLINE Float3 TransformScalar(const Mat4x4f &matrix, f32 x, f32 y, f32 z, f32 w)
+        {
+            const f32 *m = matrix.data;
+
+            return {
+                x * m[0] + y * m[4] + z * m[8] + w * m[12],
+                x * m[1] + y * m[5] + z * m[9] + w * m[13],
+                x * m[2] + y * m[6] + z * m[10] + w * m[14],
+            };
+        }
+
+        /**
+         * @brief Transforms count packed Float3. Used by the kernel tables. @see Kernels::TransformPacked
+         */
+        SSSENGINE_FORCE_INLINE void TransformBatch(const Mat4x4f &matrix, const Float3 *input, Float3 *output,
+                                                   size count, f32 w)
+        {
+            size i = TransformPacked(
+                matrix, reinterpret_cast<const f32 *>(input), reinterpret_cast<f32 *>(output), count, w);
+
+            for(; i < count; ++i)
+            {
+                output[i] = TransformScalar(matrix, input[i].X, input[i].Y, input[i].Z, w);
+            }
+        }
+
+        /**
+         * @brief Transforms count elements of a structure of arrays. Used by the kernel tables. @see
+         * Kernels::TransformStream
+         */
+        SSSENGINE_FORCE_INLINE void TransformBatch(const Mat4x4f &matrix, const f32 *inX, const f32 *inY,
+                                                   const f32 *inZ, f32 *outX, f32 *outY, f32 *outZ, size count, f32 w)
+        {
+            size i = TransformStream(matrix, inX, inY, inZ, outX, outY, outZ, count, w);
+
+            for(; i < count; ++i)
+            {
+                const Float3 result = TransformScalar(matrix, inX[i], inY[i], inZ[i], w);
+                outX[i] = result.X;
+                outY[i] = result.Y;
+                outZ[i] = result.Z;
+            }
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+
+    namespace Detail
+    {
+        SSSENGINE_FORCE_INLINE void TransformBatch(const Mat4x4f &matrix, std::span<const Float3> input,
+                                                   std::span<Float3> output, f32 w)
+        {
+            SSSENGINE_ASSERT(output.size() >= input.size());
+
+            Kernels::TransformPacked(matrix, input.data(), output.data(), input.size(), w);
+        }
+
+        SSSENGINE_FORCE_INLINE void TransformBatch(const Mat4x4f &matrix, ConstFloat3Stream input, Float3Stream output,
+                                                   f32 w)
+        {
+            const size count = input.Size();
+            SSSENGINE_ASSERT(input.Y.size() == count && input.Z.size() == count);
+            SSSENGINE_ASSERT(output.X.size() >= count && output.Y.size() >= count && output.Z.size() >= count);
+
+            Kernels::TransformStream(matrix,
+                                     input.X.data(),
+                                     input.Y.data(),
+                                     input.Z.data(),
+                                     output.X.data(),
+                                     output.Y.data(),
+                                     output.Z.data(),
+                                     count,
+                                     w);
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Transforms every point by the matrix as a row vector with w = 1 (point * matrix). The resulting w is
+     * ignored so no perspective division is done
+     *
+     * @param matrix The transformation
+     * @param points The points to transform
+     * @param result Where to write the transformed points. Must be at least as big as points. Can be the same memory as
+     * points but must not partially overlap it
+     */
+    SSSENGINE_GLOBAL void TransformPoints(const Mat4x4f &matrix, std::span<const Float3> points,
+                                          std::span<Float3> result)
+    {
+        Detail::TransformBatch(matrix, points, result, 1.0f);
+    }
+
+    /**
+     * @brief Transforms every point by the matrix as a row vector with w = 1 (point * matrix). The resulting w is
+     * ignored so no perspective division is done
+     *
+     * @param matrix The transformation
+     * @param points The points to transform
+     * @param result Where to write the transformed points. Same rules as the array of structures version
+     */
+    SSSENGINE_GLOBAL void TransformPoints(const Mat4x4f &matrix, ConstFloat3Stream points, Float3Stream result)
+    {
+        Detail::TransformBatch(matrix, points, result, 1.0f);
+    }
+
+    /**
+     * @brief Transforms every vector by the matrix as a row vector with w = 0 so translation is not applied. Useful for
+     * directions
+     *
+     * @param matrix The transformation
+     * @param vectors The vectors to transform
+     * @param result Where to write the transformed vectors. Same rules as TransformPoints
+     */
+    SSSENGINE_GLOBAL void TransformVectors(const Mat4x4f &matrix, std::span<const Float3> vectors,
+                                           std::span<Float3> result)
+    {
+        Detail::TransformBatch(matrix, vectors, result, 0.0f);
+    }
+
+    /**
+     * @brief Transforms every vector by the matrix as a row vector with w = 0 so translation is not applied. Useful for
+     * directions
+     *
+     * @param matrix The transformation
+     * @param vectors The vectors to transform
+     * @param result Where to write the transformed vectors. Same rules as TransformPoints
+     */
+    SSSENGINE_GLOBAL void TransformVectors(const Mat4x4f &matrix, ConstFloat3Stream vectors, Float3Stream result)
+    {
+        Detail::TransformBatch(matrix, vectors, result, 0.0f);
+    }
+} // namespace SSSEngine::Math
@@ -0,0 +1,196 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Bounding volumes used to cull and to test overlaps
+ */
+
+#pragma once
+
+#include <cmath>
+#include <span>
+#include "Attributes.h"
+#include "BatchTransform.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Matrix.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    /**
+     * @class BoundingBox
+     * @brief Axis aligned bounding box. Stored as center and half size since that is what the intersection tests use
+     *
+     */
+    struct BoundingBox
+    {
+        Float3 Center{};
+        Float3 Extents{};
+
+        friend SSSENGINE_GLOBAL bool operator==(const BoundingBox &lhs, const BoundingBox &rhs)
+        {
+            return lhs.Center == rhs.Center && lhs.Extents == rhs.Extents;
+        }
+    };
+
+    /**
+     * @class BoundingSphere
+     * @brief Cheaper to test than BoundingBox but usually a looser fit
+     *
+     */
+    struct BoundingSphere
+    {
+        Float3 Center{};
+        f32 Radius{0};
+
+        friend SSSENGINE_GLOBAL bool operator==(const BoundingSphere &lhs, const BoundingSphere &rhs)
+        {
+            return lhs.Center == rhs.Center && lhs.Radius == rhs.Radius;
+        }
+    };
+
+    /**
+     * @class BoundingBoxStream
+     * @brief Structure of arrays layout of BoundingBox used by the batch culling. Every array must have the same size
+     *
+     */
+    struct BoundingBoxStream
+    {
+        ConstFloat3Stream Center;
+        ConstFloat3Stream Extents;
+
+        SSSENGINE_PURE size Size() const noexcept
+        {
+            return Center.Size();
+        }
+
+        /**
+         * @brief The boxes [offset, offset + count). Used to split a batch between threads
+         */
+        SSSENGINE_PURE BoundingBoxStream Subspan(size offset, size count) const
+        {
+            return {
+                {Center.X.subspan(offset, count), Center.Y.subspan(offset, count), Center.Z.subspan(offset, count)},
+                {Extents.X.subspan(offset, count),
+                 Extents.Y.subspan(offset, count),
+                 Extents.Z.subspan(offset, count)}};
+        }
+    };
+
+    /**
+     * @class BoundingSphereStream
+     * @brief Structure of arrays layout of BoundingSphere used by the batch culling. The arrays must have the same size
+     *
+     */
+    struct BoundingSphereStream
+    {
+        ConstFloat3Stream Center;
+        std::span<const f32> Radius;
+
+        SSSENGINE_PURE size Size() const noexcept
+        {
+            return Radius.size();
+        }
+
+        /**
+         * @brief The spheres [offset, offset + count). Used to split a batch between threads
+         */
+        SSSENGINE_PURE BoundingSphereStream Subspan(size offset, size count) const
+        {
+            return {
+                {Center.X.subspan(offset, count), Center.Y.subspan(offset, count), Center.Z.subspan(offset, count)},
+                Radius.subspan(offset, count)};
+        }
+    };
+
+    SSSENGINE_GLOBAL BoundingBox BoundingBoxFromMinMax(Float3 min, Float3 max)
+    {
+        return {(min + max) * 0.5f, (max - min) * 0.5f};
+    }
+
+    /**
+     * @brief The smallest box containing every point
+     *
+     * @param points Can not be empty
+     */
+    SSSENGINE_GLOBAL BoundingBox BoundingBoxFromPoints(std::span<const Float3> points)
+    {
+        SSSENGINE_ASSERT(!points.empty());
+
+        Float3 min = points.front();
+        Float3 max = points.front();
+        for(const Float3 &point: points)
+        {
+            min = {std::fmin(min.X, point.X), std::fmin(min.Y, point.Y), std::fmin(min.Z, point.Z)};
+            max = {std::fmax(max.X, point.X), std::fmax(max.Y, point.Y), std::fmax(max.Z, point.Z)};
+        }
+
+        return BoundingBoxFromMinMax(min, max);
+    }
+
+    /**
+     * @brief The smallest box containing both boxes
+     */
+    SSSENGINE_GLOBAL BoundingBox Merge(const BoundingBox &lhs, const BoundingBox &rhs)
+    {
+        const Float3 lhsMin = lhs.Center - lhs.Extents;
+        const Float3 lhsMax = lhs.Center + lhs.Extents;
+        const Float3 rhsMin = rhs.Center - rhs.Extents;
+        const Float3 rhsMax = rhs.Center + rhs.Extents;
+
+        return BoundingBoxFromMinMax(
+            {std::fmin(lhsMin.X, rhsMin.X), std::fmin(lhsMin.Y, rhsMin.Y), std::fmin(lhsMin.Z, rhsMin.Z)},
+            {std::fmax(lhsMax.X, rhsMax.X), std::fmax(lhsMax.Y, rhsMax.Y), std::fmax(lhsMax.Z, rhsMax.Z)});
+    }
+
+    /**
+     * @brief The box containing the transformed box. The result is not the tightest fit when the matrix rotates
+     *
+     * @param matrix An affine transformation
+     */
+    SSSENGINE_GLOBAL BoundingBox TransformBoundingBox(const BoundingBox &box, const Mat4x4f &matrix)
+    {
+        const f32 *m = matrix.data;
+
+        // NOTE: Each corner is center +- extents so the new extents are the sum of the absolute contributions of every
+        // axis (J. Arvo, Transforming Axis-Aligned Bounding Boxes)
+        BoundingBox result;
+        result.Center = {box.Center.X * m[0] + box.Center.Y * m[4] + box.Center.Z * m[8] + m[12],
+                         box.Center.X * m[1] + box.Center.Y * m[5] + box.Center.Z * m[9] + m[13],
+                         box.Center.X * m[2] + box.Center.Y * m[6] + box.Center.Z * m[10] + m[14]};
+        result.Extents = {
+            box.Extents.X * std::abs(m[0]) + box.Extents.Y * std::abs(m[4]) + box.Extents.Z * std::abs(m[8]),
+            box.Extents.X * std::abs(m[1]) + box.Extents.Y * std::abs(m[5]) + box.Extents.Z * std::abs(m[9]),
+            box.Extents.X * std::abs(m[2]) + box.Extents.Y * std::abs(m[6]) + box.Extents.Z * std::abs(m[10])};
+
+        return result;
+    }
+
+    /**
+     * @brief The sphere containing the box
+     */
+    SSSENGINE_GLOBAL BoundingSphere BoundingSphereFromBox(const BoundingBox &box)
+    {
+        const Float3 &e = box.Extents;
+        return {box.Center, std::sqrt(e.X * e.X + e.Y * e.Y + e.Z * e.Z)};
+    }
+} // namespace SSSEngine::Math
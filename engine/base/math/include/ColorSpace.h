@@ -0,0 +1,591 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Color space curves and packed HDR color formats
+ * The sRGB curves are the exact piecewise functions of IEC 61966-2-1, the power part evaluated with FastPow. 8 bit sRGB
+ * decodes through a table since there are only 256 values. R11G11B10 and RGB9E5 match the DXGI formats of the same
+ * name. Every batch works on whole rows of channels so texture import and readback never convert pixel by pixel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include "Attributes.h"
+#include "BatchTransform.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "MathKernels.h"
+#include "Packed.h"
+#include "SimdOperations.h"
+#include "Transcendental.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    /**
+     * @class R11G11B10
+     * @brief Three unsigned floats without sign, 6 bits of mantissa for red and green and 5 for blue, all with a 5 bit
+     * exponent. Red is in the low bits
+     *
+     */
+    struct R11G11B10
+    {
+        u32 Bits{0};
+
+        friend SSSENGINE_GLOBAL bool operator==(R11G11B10 lhs, R11G11B10 rhs)
+        {
+            return lhs.Bits == rhs.Bits;
+        }
+    };
+
+    /**
+     * @class Rgb9E5
+     * @brief Three 9 bit mantissas sharing a 5 bit exponent. Red is in the low bits
+     *
+     */
+    struct Rgb9E5
+    {
+        u32 Bits{0};
+
+        friend SSSENGINE_GLOBAL bool operator==(Rgb9E5 lhs, Rgb9E5 rhs)
+        {
+            return lhs.Bits == rhs.Bits;
+        }
+    };
+
+    SSSENGINE_STATIC_ASSERT(sizeof(R11G11B10) == 4, "R11G11B10 must be 4 bytes")
+    SSSENGINE_STATIC_ASSERT(sizeof(Rgb9E5) == 4, "Rgb9E5 must be 4 bytes")
+
+    namespace Detail
+    {
+        constexpr f32 SrgbLinearThreshold = 0.0031308f;
+        constexpr f32 SrgbEncodedThreshold = 0.04045f;
+        constexpr f32 SrgbSlope = 12.92f;
+        constexpr f32 SrgbOffset = 0.055f;
+        constexpr f32 SrgbGamma = 2.4f;
+
+        /**
+         * @brief Constants of an unsigned float with a 5 bit exponent, like the channels of R11G11B10
+         */
+        template<u32 MantissaBits>
+        struct SmallFloat
+        {
+            static constexpr u32 Shift = 23 - MantissaBits;
+            static constexpr u32 Mask = (1u << (MantissaBits + 5)) - 1;
+            // NOTE: The largest finite value, everything above is clamped to it
+            static constexpr u32 Maximum = (30u << MantissaBits) | ((1u << MantissaBits) - 1);
+            // NOTE: Same tricks as ToHalf with fewer mantissa bits
+            static constexpr u32 DenormalMagic = ((127u - 15u) + Shift + 1u) << 23;
+            static constexpr u32 Rebias = ((15u - 127u) << 23) + (1u << (Shift - 1)) - 1;
+        };
+
+        // NOTE: 511 / 512 * 2^16, the largest value RGB9E5 can hold
+        constexpr f32 Rgb9E5Maximum = 65408.0f;
+        // NOTE: The f32 exponent of the smallest shared exponent, 2^-16
+        constexpr u32 Rgb9E5ExponentBias = 127u - 15u - 1u;
+        constexpr u32 Rgb9E5MantissaMask = 0x1FF;
+    } // namespace Detail
+
+    /**
+     * @brief Encodes a linear value with the sRGB curve. Clamps to [0, 1], NaN becomes 0. Relative error below 1e-5
+     */
+    SSSENGINE_GLOBAL f32 LinearToSrgb(f32 linear)
+    {
+        using namespace Detail;
+
+        linear = linear > 0 ? std::min(linear, 1.0f) : 0.0f;
+        if(linear < SrgbLinearThreshold)
+        {
+            return linear * SrgbSlope;
+        }
+
+        return FastPow(linear, 1 / SrgbGamma) * (1 + SrgbOffset) - SrgbOffset;
+    }
+
+    /**
+     * @brief Decodes an sRGB value to linear. Clamps to [0, 1], NaN becomes 0. Relative error below 1e-5
+     */
+    SSSENGINE_GLOBAL f32 SrgbToLinear(f32 srgb)
+    {
+        using namespace Detail;
+
+        srgb = srgb > 0 ? std::min(srgb, 1.0f) : 0.0f;
+        if(srgb < SrgbEncodedThreshold)
+        {
+            return srgb * (1 / SrgbSlope);
+        }
+
+        return FastPow((srgb + SrgbOffset) * (1 / (1 + SrgbOffset)), SrgbGamma);
+    }
+
+    /**
+     * @brief Decodes an 8 bit sRGB value to linear through a table, exact to the last bit of the f32
+     */
+    f32 Srgb8ToLinear(u8 srgb);
+
+    namespace Detail
+    {
+        template<u32 MantissaBits>
+        SSSENGINE_GLOBAL constexpr u32 ToSmallFloat(f32 value)
+        {
+            using Format = SmallFloat<MantissaBits>;
+
+            // NOTE: Negative values and NaN become 0
+            const u32 bits = std::bit_cast<u32>(value > 0 ? value : 0.0f);
+            if(bits < F16SmallestNormal)
+            {
+                const f32 denormal = std::bit_cast<f32>(bits) + std::bit_cast<f32>(Format::DenormalMagic);
+                return std::bit_cast<u32>(denormal) - Format::DenormalMagic;
+            }
+
+            const u32 mantissaOdd = (bits >> Format::Shift) & 1;
+            return std::min((bits + Format::Rebias + mantissaOdd) >> Format::Shift, Format::Maximum);
+        }
+
+        template<u32 MantissaBits>
+        SSSENGINE_GLOBAL constexpr f32 FromSmallFloat(u32 bits)
+        {
+            // NOTE: The exponent bias is the same as the one of a half
+            return std::bit_cast<f32>(bits << SmallFloat<MantissaBits>::Shift) * std::bit_cast<f32>(F16ToF32Magic);
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Rounds every channel to the nearest value, ties to even. Negative values and NaN become 0 and values too
+     * large become the largest finite value
+     */
+    SSSENGINE_GLOBAL constexpr R11G11B10 ToR11G11B10(Float3 color)
+    {
+        return {Detail::ToSmallFloat<6>(color.X) | (Detail::ToSmallFloat<6>(color.Y) << 11) |
+                (Detail::ToSmallFloat<5>(color.Z) << 22)};
+    }
+
+    SSSENGINE_GLOBAL Float3 FromR11G11B10(R11G11B10 color)
+    {
+        using namespace Detail;
+
+        return {FromSmallFloat<6>(color.Bits & SmallFloat<6>::Mask),
+                FromSmallFloat<6>((color.Bits >> 11) & SmallFloat<6>::Mask),
+                FromSmallFloat<5>(color.Bits >> 22)};
+    }
+
+    /**
+     * @brief Clamps every channel to [0, 65408], NaN becomes 0, and rounds it to the nearest value of the shared
+     * exponent of the largest channel
+     */
+    SSSENGINE_GLOBAL Rgb9E5 ToRgb9E5(Float3 color)
+    {
+        using namespace Detail;
+
+        auto clamp = [](f32 value) { return value > 0 ? std::min(value, Rgb9E5Maximum) : 0.0f; };
+        const f32 r = clamp(color.X);
+        const f32 g = clamp(color.Y);
+        const f32 b = clamp(color.Z);
+
+        // NOTE: The algorithm of the D3D functional specification with the logarithm read from the f32 exponent
+        const f32 maximum = std::max({r, g, b});
+        u32 exponent = std::max(std::bit_cast<u32>(maximum) >> 23, Rgb9E5ExponentBias) - Rgb9E5ExponentBias;
+        f32 scale = std::bit_cast<f32>((127u + 24u - exponent) << 23);
+        if(static_cast<u32>(maximum * scale + 0.5f) == Rgb9E5MantissaMask + 1)
+        {
+            ++exponent;
+            scale *= 0.5f;
+        }
+
+        auto quantize = [scale](f32 value) { return static_cast<u32>(value * scale + 0.5f); };
+        return {quantize(r) | (quantize(g) << 9) | (quantize(b) << 18) | (exponent << 27)};
+    }
+
+    SSSENGINE_GLOBAL Float3 FromRgb9E5(Rgb9E5 color)
+    {
+        using namespace Detail;
+
+        const f32 scale = std::bit_cast<f32>(((color.Bits >> 27) + 127u - 24u) << 23);
+        return {static_cast<f32>(color.Bits & Rgb9E5MantissaMask) * scale,
+                static_cast<f32>((color.Bits >> 9) & Rgb9E5MantissaMask) * scale,
+                static_cast<f32>((color.Bits >> 18) & Rgb9E5MantissaMask) * scale};
+    }
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        /**
+         * @brief Lane wise LinearToSrgb
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register LinearToSrgb(Register linear)
+        {
+            using namespace Detail;
+
+            linear = Min(Max(linear, Set1<Register>(0)), Set1<Register>(1));
+            const Register curve = MulAdd(FastPow(linear, Set1<Register>(1 / SrgbGamma)),
+                                          Set1<Register>(1 + SrgbOffset),
+                                          Set1<Register>(-SrgbOffset));
+            return Select(CompareLess(linear, Set1<Register>(SrgbLinearThreshold)),
+                          Mul(linear, Set1<Register>(SrgbSlope)),
+                          curve);
+        }
+
+        /**
+         * @brief Lane wise SrgbToLinear
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register SrgbToLinear(Register srgb)
+        {
+            using namespace Detail;
+
+            srgb = Min(Max(srgb, Set1<Register>(0)), Set1<Register>(1));
+            const Register base = Mul(Add(srgb, Set1<Register>(SrgbOffset)), Set1<Register>(1 / (1 + SrgbOffset)));
+            return Select(CompareLess(srgb, Set1<Register>(SrgbEncodedThreshold)),
+                          Mul(srgb, Set1<Register>(1 / SrgbSlope)),
+                          FastPow(base, Set1<Register>(SrgbGamma)));
+        }
+
+        /**
+         * @brief Lane wise ToSmallFloat as 32 bit integers
+         */
+        template<u32 MantissaBits>
+        SSSENGINE_FORCE_INLINE __m128i ToSmallFloat4(Vector128 value)
+        {
+            using namespace Detail;
+            using Format = SmallFloat<MantissaBits>;
+
+            // NOTE: The max returns its second operand for NaN
+            const __m128i bits = _mm_castps_si128(_mm_max_ps(value, _mm_setzero_ps()));
+
+            const __m128i magic = Set1Integer(Format::DenormalMagic);
+            const Vector128 denormal = _mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(magic));
+            const __m128i denormalResult = _mm_sub_epi32(_mm_castps_si128(denormal), magic);
+
+            const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, Format::Shift), _mm_set1_epi32(1));
+            __m128i normalResult =
+                _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, Set1Integer(Format::Rebias)), mantissaOdd),
+                               Format::Shift);
+            normalResult = SelectInteger(_mm_cmpgt_epi32(normalResult, Set1Integer(Format::Maximum)),
+                                         Set1Integer(Format::Maximum),
+                                         normalResult);
+
+            return SelectInteger(_mm_cmplt_epi32(bits, Set1Integer(F16SmallestNormal)), denormalResult, normalResult);
+        }
+
+        /**
+         * @brief Lane wise FromSmallFloat
+         */
+        template<u32 MantissaBits>
+        SSSENGINE_FORCE_INLINE Vector128 FromSmallFloat4(__m128i bits)
+        {
+            const __m128i shifted = _mm_slli_epi32(bits, Detail::SmallFloat<MantissaBits>::Shift);
+            return _mm_mul_ps(_mm_castsi128_ps(shifted), _mm_castsi128_ps(Set1Integer(Detail::F16ToF32Magic)));
+        }
+
+        SSSENGINE_FORCE_INLINE __m128i ToR11G11B10x4(Vector128 r, Vector128 g, Vector128 b)
+        {
+            const __m128i rg = _mm_or_si128(ToSmallFloat4<6>(r), _mm_slli_epi32(ToSmallFloat4<6>(g), 11));
+            return _mm_or_si128(rg, _mm_slli_epi32(ToSmallFloat4<5>(b), 22));
+        }
+
+        SSSENGINE_FORCE_INLINE void FromR11G11B10x4(__m128i colors, Vector128 &r, Vector128 &g, Vector128 &b)
+        {
+            const __m128i mask = Set1Integer(Detail::SmallFloat<6>::Mask);
+            r = FromSmallFloat4<6>(_mm_and_si128(colors, mask));
+            g = FromSmallFloat4<6>(_mm_and_si128(_mm_srli_epi32(colors, 11), mask));
+            b = FromSmallFloat4<5>(_mm_srli_epi32(colors, 22));
+        }
+
+        SSSENGINE_FORCE_INLINE __m128i ToRgb9E5x4(Vector128 r, Vector128 g, Vector128 b)
+        {
+            using namespace Detail;
+
+            const Vector128 zero = _mm_setzero_ps();
+            const Vector128 largest = _mm_set1_ps(Rgb9E5Maximum);
+            r = _mm_min_ps(_mm_max_ps(r, zero), largest);
+            g = _mm_min_ps(_mm_max_ps(g, zero), largest);
+            b = _mm_min_ps(_mm_max_ps(b, zero), largest);
+
+            const Vector128 maximum = _mm_max_ps(r, _mm_max_ps(g, b));
+            const __m128i bias = Set1Integer(Rgb9E5ExponentBias);
+            __m128i exponent = _mm_srli_epi32(_mm_castps_si128(maximum), 23);
+            exponent = _mm_sub_epi32(SelectInteger(_mm_cmpgt_epi32(exponent, bias), exponent, bias), bias);
+
+            const Vector128 half = _mm_set1_ps(0.5f);
+            Vector128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(Set1Integer(127u + 24u), exponent), 23));
+            const __m128i roundedMaximum = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(maximum, scale), half));
+            const __m128i overflow = _mm_cmpeq_epi32(roundedMaximum, Set1Integer(Rgb9E5MantissaMask + 1));
+            // NOTE: The mask is -1 where the mantissa overflows
+            exponent = _mm_sub_epi32(exponent, overflow);
+            scale = Select(_mm_castsi128_ps(overflow), _mm_mul_ps(scale, half), scale);
+
+            auto quantize = [scale, half](Vector128 value)
+            { return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), half)); };
+            const __m128i rg = _mm_or_si128(quantize(r), _mm_slli_epi32(quantize(g), 9));
+            return _mm_or_si128(_mm_or_si128(rg, _mm_slli_epi32(quantize(b), 18)), _mm_slli_epi32(exponent, 27));
+        }
+
+        SSSENGINE_FORCE_INLINE void FromRgb9E5x4(__m128i colors, Vector128 &r, Vector128 &g, Vector128 &b)
+        {
+            const __m128i exponent = _mm_add_epi32(_mm_srli_epi32(colors, 27), Set1Integer(127u - 24u));
+            const Vector128 scale = _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+            const __m128i mask = Set1Integer(Detail::Rgb9E5MantissaMask);
+            r = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(colors, mask)), scale);
+            g = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(colors, 9), mask)), scale);
+            b = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(colors, 18), mask)), scale);
+        }
+
+        template<bool ToLinear, typename Register>
+        SSSENGINE_FORCE_INLINE Register ConvertSrgb(Register value)
+        {
+            if constexpr(ToLinear)
+            {
+                return SrgbToLinear(value);
+            }
+            else
+            {
+                return LinearToSrgb(value);
+            }
+        }
+
+        template<bool ToLinear>
+        SSSENGINE_FORCE_INLINE void ConvertSrgbBatch(const f32 *values, f32 *result, size count)
+        {
+            const size i =
+                ForEachLanes(count,
+                             [&]<typename Register>(size index)
+                             { Store(&result[index], ConvertSrgb<ToLinear>(Load<Register>(&values[index]))); });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[4]{};
+                CopyElements(&values[i], padded, remainder);
+                Store(padded, ConvertSrgb<ToLinear>(Load<Vector128>(padded)));
+                CopyElements(padded, &result[i], remainder);
+            }
+        }
+
+        /**
+         * @brief LinearToSrgb on the RGB channels of whole RGBA pixels, the alpha is left as is
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register LinearToSrgbRgba(Register rgba)
+        {
+            static constexpr f32 Channels[8]{0, 0, 0, 1, 0, 0, 0, 1};
+
+            const Register alpha = CompareEqual(Load<Register>(Channels), Set1<Register>(1));
+            return Select(alpha, rgba, LinearToSrgb(rgba));
+        }
+
+        /**
+         * @param rgba 4 channels per pixel, the alpha stays linear
+         * @param count The amount of pixels
+         */
+        SSSENGINE_FORCE_INLINE void ConvertLinearToSrgb8Batch(const f32 *rgba, u8 *result, size count)
+        {
+            // NOTE: 4 pixels, 16 channels, at a time so they pack into a single register of bytes
+            auto encode = [](const f32 *input, u8 *output)
+            {
+                f32 encoded[16];
+                ForEachLanes(16,
+                             [&]<typename Register>(size index)
+                             { Store(&encoded[index], LinearToSrgbRgba(Load<Register>(&input[index]))); });
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output), ToUnorm8x16(encoded));
+            };
+
+            size i = 0;
+            for(; i + 4 <= count; i += 4)
+            {
+                encode(&rgba[i * 4], &result[i * 4]);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[16]{};
+                u8 paddedResult[16];
+                CopyElements(&rgba[i * 4], padded, remainder * 4);
+                encode(padded, paddedResult);
+                CopyElements(paddedResult, &result[i * 4], remainder * 4);
+            }
+        }
+
+        /**
+         * @brief Packs 4 pixels of 3 channels at a time with pack(r, g, b)
+         */
+        template<typename Packed, typename Pack>
+        SSSENGINE_FORCE_INLINE void PackRgbBatch(const f32 *rgb, Packed *result, size count, Pack &&pack)
+        {
+            auto pack4 = [&pack](const f32 *input, Packed *output)
+            {
+                Vector128 r, g, b;
+                Transpose3x4(_mm_loadu_ps(input), _mm_loadu_ps(&input[4]), _mm_loadu_ps(&input[8]), r, g, b);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output), pack(r, g, b));
+            };
+
+            size i = 0;
+            for(; i + 4 <= count; i += 4)
+            {
+                pack4(&rgb[i * 3], &result[i]);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[12]{};
+                Packed paddedResult[4];
+                CopyElements(&rgb[i * 3], padded, remainder * 3);
+                pack4(padded, paddedResult);
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        /**
+         * @brief The inverse of PackRgbBatch with unpack(colors, r, g, b)
+         */
+        template<typename Packed, typename Unpack>
+        SSSENGINE_FORCE_INLINE void UnpackRgbBatch(const Packed *colors, f32 *rgb, size count, Unpack &&unpack)
+        {
+            auto unpack4 = [&unpack](const Packed *input, f32 *output)
+            {
+                Vector128 r, g, b;
+                unpack(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)), r, g, b);
+
+                Vector128 first, second, third;
+                Transpose4x3(r, g, b, first, second, third);
+                _mm_storeu_ps(output, first);
+                _mm_storeu_ps(&output[4], second);
+                _mm_storeu_ps(&output[8], third);
+            };
+
+            size i = 0;
+            for(; i + 4 <= count; i += 4)
+            {
+                unpack4(&colors[i], &rgb[i * 3]);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                Packed padded[4]{};
+                f32 paddedResult[12];
+                CopyElements(&colors[i], padded, remainder);
+                unpack4(padded, paddedResult);
+                CopyElements(paddedResult, &rgb[i * 3], remainder * 3);
+            }
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+
+    /**
+     * @brief LinearToSrgb on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertLinearToSrgb(std::span<const f32> values, std::span<f32> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertLinearToSrgb(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief SrgbToLinear on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertSrgbToLinear(std::span<const f32> values, std::span<f32> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertSrgbToLinear(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief Encodes linear RGBA pixels to 8 bit sRGB, like DXGI_FORMAT_R8G8B8A8_UNORM_SRGB. The alpha is only
+     * quantized
+     *
+     * @param rgba 4 channels per pixel
+     * @param result Must be able to hold every channel
+     */
+    SSSENGINE_GLOBAL void ConvertLinearToSrgb8(std::span<const f32> rgba, std::span<u8> result)
+    {
+        SSSENGINE_ASSERT(rgba.size() % 4 == 0);
+        SSSENGINE_ASSERT(result.size() >= rgba.size());
+
+        Kernels::ConvertLinearToSrgb8(rgba.data(), result.data(), rgba.size() / 4);
+    }
+
+    /**
+     * @brief Decodes 8 bit sRGB RGBA pixels to linear through the table of Srgb8ToLinear. The alpha is only normalized
+     *
+     * @param rgba 4 channels per pixel
+     * @param result Must be able to hold every channel
+     */
+    void ConvertSrgb8ToLinear(std::span<const u8> rgba, std::span<f32> result);
+
+    /**
+     * @brief ToR11G11B10 on every color
+     *
+     * @param rgb 3 channels per color
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void ConvertToR11G11B10(std::span<const f32> rgb, std::span<R11G11B10> result)
+    {
+        SSSENGINE_ASSERT(rgb.size() % 3 == 0);
+        SSSENGINE_ASSERT(result.size() >= rgb.size() / 3);
+
+        Kernels::ConvertToR11G11B10(rgb.data(), result.data(), rgb.size() / 3);
+    }
+
+    /**
+     * @brief FromR11G11B10 on every color
+     *
+     * @param rgb Must be able to hold 3 channels per color
+     */
+    SSSENGINE_GLOBAL void ConvertFromR11G11B10(std::span<const R11G11B10> colors, std::span<f32> rgb)
+    {
+        SSSENGINE_ASSERT(rgb.size() >= colors.size() * 3);
+
+        Kernels::ConvertFromR11G11B10(colors.data(), rgb.data(), colors.size());
+    }
+
+    /**
+     * @brief ToRgb9E5 on every color
+     *
+     * @param rgb 3 channels per color
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void ConvertToRgb9E5(std::span<const f32> rgb, std::span<Rgb9E5> result)
+    {
+        SSSENGINE_ASSERT(rgb.size() % 3 == 0);
+        SSSENGINE_ASSERT(result.size() >= rgb.size() / 3);
+
+        Kernels::ConvertToRgb9E5(rgb.data(), result.data(), rgb.size() / 3);
+    }
+
+    /**
+     * @brief FromRgb9E5 on every color
+     *
+     * @param rgb Must be able to hold 3 channels per color
+     */
+    SSSENGINE_GLOBAL void ConvertFromRgb9E5(std::span<const Rgb9E5> colors, std::span<f32> rgb)
+    {
+        SSSENGINE_ASSERT(rgb.size() >= colors.size() * 3);
+
+        Kernels::ConvertFromRgb9E5(colors.data(), rgb.data(), colors.size());
+    }
+} // namespace SSSEngine::Math
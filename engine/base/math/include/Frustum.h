@@ -0,0 +1,411 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief View frustum and the tests to cull bounding volumes against it
+ * The batch culling writes the indices of the visible volumes so the result can directly drive the draw calls. It has
+ * no shared state so a batch can be split with Subspan and each part culled by a different thread.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <span>
+#include "Attributes.h"
+#include "Bounds.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "MathKernels.h"
+#include "Matrix.h"
+#include "SimdOperations.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    /**
+     * @class Plane
+     * @brief The points p where Dot(Normal, p) + Distance >= 0 are in front of the plane
+     *
+     */
+    struct Plane
+    {
+        Float3 Normal{};
+        f32 Distance{0};
+    };
+
+    enum class FrustumPlane : u8
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        Count,
+    };
+
+    /**
+     * @class Frustum
+     * @brief The 6 planes of a view frustum, all facing inside
+     *
+     */
+    struct Frustum
+    {
+        Plane Planes[static_cast<u8>(FrustumPlane::Count)];
+
+        SSSENGINE_PURE const Plane &operator[](FrustumPlane plane) const
+        {
+            return Planes[static_cast<u8>(plane)];
+        }
+    };
+
+    /**
+     * @brief Extracts the planes of a view projection matrix in world space (G. Gribb, K. Hartmann, Fast Extraction of
+     * Viewing Frustum Planes from the World-View-Projection Matrix)
+     *
+     * @param viewProjection Row vector matrix with a clip space depth of [0, w] like Direct3D
+     */
+    SSSENGINE_GLOBAL Frustum ExtractFrustum(const Mat4x4f &viewProjection)
+    {
+        const f32 *m = viewProjection.data;
+
+        // NOTE: Clip space is v * M so every clip component is a column. A point is inside when -w <= x <= w,
+        // -w <= y <= w and 0 <= z <= w
+        auto column = [m](u32 index) -> Float4 { return {m[index], m[4 + index], m[8 + index], m[12 + index]}; };
+        const Float4 x = column(0);
+        const Float4 y = column(1);
+        const Float4 z = column(2);
+        const Float4 w = column(3);
+
+        auto plane = [](Float4 coefficients) -> Plane
+        {
+            const f32 length = std::sqrt(coefficients.X * coefficients.X + coefficients.Y * coefficients.Y +
+                                         coefficients.Z * coefficients.Z);
+            // NOTE: An infinite far plane has no normal. Leaving it zeroed makes every volume in front of it
+            if(length == 0)
+            {
+                return {};
+            }
+
+            return {Float3{coefficients.X, coefficients.Y, coefficients.Z} / length, coefficients.W / length};
+        };
+
+        Frustum frustum;
+        frustum.Planes[static_cast<u8>(FrustumPlane::Left)] = plane(w + x);
+        frustum.Planes[static_cast<u8>(FrustumPlane::Right)] = plane(w - x);
+        frustum.Planes[static_cast<u8>(FrustumPlane::Bottom)] = plane(w + y);
+        frustum.Planes[static_cast<u8>(FrustumPlane::Top)] = plane(w - y);
+        frustum.Planes[static_cast<u8>(FrustumPlane::Near)] = plane(z);
+        frustum.Planes[static_cast<u8>(FrustumPlane::Far)] = plane(w - z);
+
+        return frustum;
+    }
+
+    /**
+     * @brief Whether any part of the box can be inside the frustum. Boxes close to the frustum corners can pass while
+     * being outside, which is fine for culling
+     */
+    SSSENGINE_GLOBAL bool Intersects(const Frustum &frustum, const BoundingBox &box)
+    {
+        for(const Plane &plane: frustum.Planes)
+        {
+            const Float3 &n = plane.Normal;
+            const f32 distance = n.X * box.Center.X + n.Y * box.Center.Y + n.Z * box.Center.Z + plane.Distance;
+            const f32 radius =
+                std::abs(n.X) * box.Extents.X + std::abs(n.Y) * box.Extents.Y + std::abs(n.Z) * box.Extents.Z;
+            if(distance + radius < 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Whether any part of the sphere can be inside the frustum
+     */
+    SSSENGINE_GLOBAL bool Intersects(const Frustum &frustum, const BoundingSphere &sphere)
+    {
+        for(const Plane &plane: frustum.Planes)
+        {
+            const Float3 &n = plane.Normal;
+            const f32 distance =
+                n.X * sphere.Center.X + n.Y * sphere.Center.Y + n.Z * sphere.Center.Z + plane.Distance;
+            if(distance + sphere.Radius < 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        /**
+         * @brief The planes with the absolute normals precomputed for the box tests
+         */
+        struct CullingPlanes
+        {
+            Plane planes[static_cast<u8>(FrustumPlane::Count)];
+            Float3 absoluteNormals[static_cast<u8>(FrustumPlane::Count)];
+        };
+
+        SSSENGINE_FORCE_INLINE CullingPlanes MakeCullingPlanes(const Frustum &frustum)
+        {
+            CullingPlanes result;
+            for(u8 i = 0; i < static_cast<u8>(FrustumPlane::Count); ++i)
+            {
+                const Plane &plane = frustum.Planes[i];
+                result.planes[i] = plane;
+                result.absoluteNormals[i] = {Abs(plane.Normal.X), Abs(plane.Normal.Y), Abs(plane.Normal.Z)};
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Tests LaneCount boxes against every plane
+         *
+         * @return Bit i is set when box i is visible
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE u32 VisibleBoxes(const CullingPlanes &planes, const f32 *centerX, const f32 *centerY,
+                                                const f32 *centerZ, const f32 *extentX, const f32 *extentY,
+                                                const f32 *extentZ)
+        {
+            const Register cx = Load<Register>(centerX);
+            const Register cy = Load<Register>(centerY);
+            const Register cz = Load<Register>(centerZ);
+            const Register ex = Load<Register>(extentX);
+            const Register ey = Load<Register>(extentY);
+            const Register ez = Load<Register>(extentZ);
+            const Register zero = Set1<Register>(0);
+
+            // NOTE: The broadcasts are loads from memory which is as cheap as keeping 42 registers alive
+            Register outside = zero;
+            for(u8 i = 0; i < static_cast<u8>(FrustumPlane::Count); ++i)
+            {
+                const Plane &plane = planes.planes[i];
+                const Float3 &absolute = planes.absoluteNormals[i];
+
+                const Register distance =
+                    MulAdd(Set1<Register>(plane.Normal.Z),
+                           cz,
+                           MulAdd(Set1<Register>(plane.Normal.Y),
+                                  cy,
+                                  MulAdd(Set1<Register>(plane.Normal.X), cx, Set1<Register>(plane.Distance))));
+                const Register radius =
+                    MulAdd(Set1<Register>(absolute.Z),
+                           ez,
+                           MulAdd(Set1<Register>(absolute.Y), ey, Mul(Set1<Register>(absolute.X), ex)));
+                outside = Or(outside, CompareLess(Add(distance, radius), zero));
+            }
+
+            return ~MoveMask(outside) & ((1u << LaneCount<Register>) - 1);
+        }
+
+        /**
+         * @brief Tests LaneCount spheres against every plane
+         *
+         * @return Bit i is set when sphere i is visible
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE u32 VisibleSpheres(const CullingPlanes &planes, const f32 *centerX, const f32 *centerY,
+                                                  const f32 *centerZ, const f32 *radii)
+        {
+            const Register cx = Load<Register>(centerX);
+            const Register cy = Load<Register>(centerY);
+            const Register cz = Load<Register>(centerZ);
+            const Register radius = Load<Register>(radii);
+            const Register zero = Set1<Register>(0);
+
+            Register outside = zero;
+            for(u8 i = 0; i < static_cast<u8>(FrustumPlane::Count); ++i)
+            {
+                const Plane &plane = planes.planes[i];
+
+                const Register distance =
+                    MulAdd(Set1<Register>(plane.Normal.Z),
+                           cz,
+                           MulAdd(Set1<Register>(plane.Normal.Y),
+                                  cy,
+                                  MulAdd(Set1<Register>(plane.Normal.X), cx, Set1<Register>(plane.Distance))));
+                outside = Or(outside, CompareLess(Add(distance, radius), zero));
+            }
+
+            return ~MoveMask(outside) & ((1u << LaneCount<Register>) - 1);
+        }
+
+        /**
+         * @brief Appends firstIndex + i for every bit i set in mask
+         *
+         * @return The amount of indices written
+         */
+        SSSENGINE_FORCE_INLINE size WriteVisibleIndices(u32 mask, u32 firstIndex, u32 *visible)
+        {
+            size written = 0;
+            while(mask != 0)
+            {
+                visible[written++] = firstIndex + CountTrailingZeros(mask);
+                mask &= mask - 1;
+            }
+
+            return written;
+        }
+
+        // NOTE: Like the other batches the remainder goes through the 4 wide test with padding, the padding lanes are
+        // masked out of the result
+
+        SSSENGINE_FORCE_INLINE size CullBoxesBatch(const Frustum &frustum, const f32 *cx, const f32 *cy,
+                                                   const f32 *cz, const f32 *ex, const f32 *ey, const f32 *ez,
+                                                   size count, u32 firstIndex, u32 *visible)
+        {
+            const CullingPlanes planes = MakeCullingPlanes(frustum);
+
+            size written = 0;
+            const size i = ForEachLanes(count,
+                                        [&]<typename Register>(size index)
+                                        {
+                                            const u32 mask = VisibleBoxes<Register>(planes,
+                                                                                    &cx[index],
+                                                                                    &cy[index],
+                                                                                    &cz[index],
+                                                                                    &ex[index],
+                                                                                    &ey[index],
+                                                                                    &ez[index]);
+                                            written += WriteVisibleIndices(
+                                                mask, firstIndex + static_cast<u32>(index), &visible[written]);
+                                        });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[6][4]{};
+                CopyElements(&cx[i], padded[0], remainder);
+                CopyElements(&cy[i], padded[1], remainder);
+                CopyElements(&cz[i], padded[2], remainder);
+                CopyElements(&ex[i], padded[3], remainder);
+                CopyElements(&ey[i], padded[4], remainder);
+                CopyElements(&ez[i], padded[5], remainder);
+
+                const u32 mask = VisibleBoxes<Vector128>(
+                    planes, padded[0], padded[1], padded[2], padded[3], padded[4], padded[5]);
+                written += WriteVisibleIndices(
+                    mask & ((1u << remainder) - 1), firstIndex + static_cast<u32>(i), &visible[written]);
+            }
+
+            return written;
+        }
+
+        SSSENGINE_FORCE_INLINE size CullSpheresBatch(const Frustum &frustum, const f32 *cx, const f32 *cy,
+                                                     const f32 *cz, const f32 *radius, size count, u32 firstIndex,
+                                                     u32 *visible)
+        {
+            const CullingPlanes planes = MakeCullingPlanes(frustum);
+
+            size written = 0;
+            const size i = ForEachLanes(
+                count,
+                [&]<typename Register>(size index)
+                {
+                    const u32 mask =
+                        VisibleSpheres<Register>(planes, &cx[index], &cy[index], &cz[index], &radius[index]);
+                    written +=
+                        WriteVisibleIndices(mask, firstIndex + static_cast<u32>(index), &visible[written]);
+                });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[4][4]{};
+                CopyElements(&cx[i], padded[0], remainder);
+                CopyElements(&cy[i], padded[1], remainder);
+                CopyElements(&cz[i], padded[2], remainder);
+                CopyElements(&radius[i], padded[3], remainder);
+
+                const u32 mask = VisibleSpheres<Vector128>(planes, padded[0], padded[1], padded[2], padded[3]);
+                written += WriteVisibleIndices(
+                    mask & ((1u << remainder) - 1), firstIndex + static_cast<u32>(i), &visible[written]);
+            }
+
+            return written;
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+
+    /**
+     * @brief Writes the index of every box that intersects the frustum, in increasing order. @see Intersects
+     * To cull from multiple threads give each one a Subspan of the boxes, its own output and the offset of the subspan
+     * as firstIndex
+     *
+     * @param boxes The boxes to test
+     * @param visible Where to write the indices. Must be able to hold every box
+     * @param firstIndex Added to every written index
+     * @return The amount of indices written
+     */
+    SSSENGINE_GLOBAL size CullBoundingBoxes(const Frustum &frustum, const BoundingBoxStream &boxes,
+                                            std::span<u32> visible, u32 firstIndex = 0)
+    {
+        SSSENGINE_ASSERT(boxes.Center.Y.size() == boxes.Size() && boxes.Center.Z.size() == boxes.Size());
+        SSSENGINE_ASSERT(boxes.Extents.X.size() == boxes.Size() && boxes.Extents.Y.size() == boxes.Size() &&
+                         boxes.Extents.Z.size() == boxes.Size());
+        SSSENGINE_ASSERT(visible.size() >= boxes.Size());
+
+        return Kernels::CullBoundingBoxes(frustum,
+                                          boxes.Center.X.data(),
+                                          boxes.Center.Y.data(),
+                                          boxes.Center.Z.data(),
+                                          boxes.Extents.X.data(),
+                                          boxes.Extents.Y.data(),
+                                          boxes.Extents.Z.data(),
+                                          boxes.Size(),
+                                          firstIndex,
+                                          visible.data());
+    }
+
+    /**
+     * @brief Writes the index of every sphere that intersects the frustum, in increasing order. @see Intersects
+     * To cull from multiple threads give each one a Subspan of the spheres, its own output and the offset of the
+     * subspan as firstIndex
+     *
+     * @param spheres The spheres to test
+     * @param visible Where to write the indices. Must be able to hold every sphere
+     * @param firstIndex Added to every written index
+     * @return The amount of indices written
+     */
+    SSSENGINE_GLOBAL size CullBoundingSpheres(const Frustum &frustum, const BoundingSphereStream &spheres,
+                                              std::span<u32> visible, u32 firstIndex = 0)
+    {
+        SSSENGINE_ASSERT(spheres.Center.X.size() == spheres.Size() && spheres.Center.Y.size() == spheres.Size() &&
+                         spheres.Center.Z.size() == spheres.Size());
+        SSSENGINE_ASSERT(visible.size() >= spheres.Size());
+
+        return Kernels::CullBoundingSpheres(frustum,
+                                            spheres.Center.X.data(),
+                                            spheres.Center.Y.data(),
+                                            spheres.Center.Z.data(),
+                                            spheres.Radius.data(),
+                                            spheres.Size(),
+                                            firstIndex,
+                                            visible.data());
+    }
+} // namespace SSSEngine::Math
@@ -0,0 +1,172 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Dispatch tables of the batch math kernels
+ * Every kernel is compiled once per supported instruction set and the best one for the CPU is picked at startup with
+ * LoadKernels. Until then the SSE kernels, which run on any x64 CPU, are used
+ */
+
+#pragma once
+
+#include "Concepts.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "Matrix.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    template<SSSEngine::RealConcept T>
+    struct Quaternion;
+
+    struct Frustum;
+    struct Half;
+    struct Snorm16;
+    struct OctahedralNormal;
+    struct R11G11B10;
+    struct Rgb9E5;
+} // namespace SSSEngine::Math
+
+namespace SSSEngine::Math::Kernels
+{
+    using TransformPacked_t = void (*)(const Mat4x4f &matrix, const Float3 *input, Float3 *output, size count, f32 w);
+    using TransformStream_t = void (*)(const Mat4x4f &matrix, const f32 *inX, const f32 *inY, const f32 *inZ,
+                                       f32 *outX, f32 *outY, f32 *outZ, size count, f32 w);
+    using NormalizeQuaternions_t = void (*)(const Quaternion<f32> *quaternions, Quaternion<f32> *result, size count);
+    using InterpolateQuaternions_t = void (*)(const Quaternion<f32> *from, const Quaternion<f32> *to, const f32 *t,
+                                              Quaternion<f32> *result, size count);
+    using ComposeTransforms_t = void (*)(const Float3 *positions, const Quaternion<f32> *rotations,
+                                         const Float3 *scales, Mat4x4f *result, size count);
+    using CullBoundingBoxes_t = size (*)(const Frustum &frustum, const f32 *centerX, const f32 *centerY,
+                                         const f32 *centerZ, const f32 *extentX, const f32 *extentY,
+                                         const f32 *extentZ, size count, u32 firstIndex, u32 *visible);
+    using CullBoundingSpheres_t = size (*)(const Frustum &frustum, const f32 *centerX, const f32 *centerY,
+                                           const f32 *centerZ, const f32 *radii, size count, u32 firstIndex,
+                                           u32 *visible);
+    using ConvertToHalf_t = void (*)(const f32 *values, Half *result, size count);
+    using ConvertFromHalf_t = void (*)(const Half *halves, f32 *result, size count);
+    using ConvertToSnorm16_t = void (*)(const f32 *values, Snorm16 *result, size count);
+    using ConvertToUnorm8_t = void (*)(const f32 *values, u8 *result, size count);
+    using EncodeOctahedral_t = void (*)(const Float3 *normals, OctahedralNormal *result, size count);
+    using ConvertFromUnorm8_t = void (*)(const u8 *values, f32 *result, size count);
+    using ConvertColorCurve_t = void (*)(const f32 *values, f32 *result, size count);
+    using ConvertLinearToSrgb8_t = void (*)(const f32 *rgba, u8 *result, size count);
+    using ConvertToR11G11B10_t = void (*)(const f32 *rgb, R11G11B10 *result, size count);
+    using ConvertFromR11G11B10_t = void (*)(const R11G11B10 *colors, f32 *rgb, size count);
+    using ConvertToRgb9E5_t = void (*)(const f32 *rgb, Rgb9E5 *result, size count);
+    using ConvertFromRgb9E5_t = void (*)(const Rgb9E5 *colors, f32 *rgb, size count);
+
+    namespace Sse
+    {
+        void TransformPacked(const Mat4x4f &matrix, const Float3 *input, Float3 *output, size count, f32 w);
+        void TransformStream(const Mat4x4f &matrix, const f32 *inX, const f32 *inY, const f32 *inZ, f32 *outX,
+                             f32 *outY, f32 *outZ, size count, f32 w);
+        void NormalizeQuaternions(const Quaternion<f32> *quaternions, Quaternion<f32> *result, size count);
+        void Nlerp(const Quaternion<f32> *from, const Quaternion<f32> *to, const f32 *t, Quaternion<f32> *result,
+                   size count);
+        void Slerp(const Quaternion<f32> *from, const Quaternion<f32> *to, const f32 *t, Quaternion<f32> *result,
+                   size count);
+        void ComposeTransforms(const Float3 *positions, const Quaternion<f32> *rotations, const Float3 *scales,
+                               Mat4x4f *result, size count);
+        size CullBoundingBoxes(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                               const f32 *extentX, const f32 *extentY, const f32 *extentZ, size count, u32 firstIndex,
+                               u32 *visible);
+        size CullBoundingSpheres(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                                 const f32 *radii, size count, u32 firstIndex, u32 *visible);
+        void ConvertToHalf(const f32 *values, Half *result, size count);
+        void ConvertFromHalf(const Half *halves, f32 *result, size count);
+        void ConvertToSnorm16(const f32 *values, Snorm16 *result, size count);
+        void ConvertToUnorm8(const f32 *values, u8 *result, size count);
+        void EncodeOctahedral(const Float3 *normals, OctahedralNormal *result, size count);
+        void ConvertFromUnorm8(const u8 *values, f32 *result, size count);
+        void ConvertLinearToSrgb(const f32 *values, f32 *result, size count);
+        void ConvertSrgbToLinear(const f32 *values, f32 *result, size count);
+        void ConvertLinearToSrgb8(const f32 *rgba, u8 *result, size count);
+        void ConvertToR11G11B10(const f32 *rgb, R11G11B10 *result, size count);
+        void ConvertFromR11G11B10(const R11G11B10 *colors, f32 *rgb, size count);
+        void ConvertToRgb9E5(const f32 *rgb, Rgb9E5 *result, size count);
+        void ConvertFromRgb9E5(const Rgb9E5 *colors, f32 *rgb, size count);
+    } // namespace Sse
+
+    namespace Avx2
+    {
+        void TransformPacked(const Mat4x4f &matrix, const Float3 *input, Float3 *output, size count, f32 w);
+        void TransformStream(const Mat4x4f &matrix, const f32 *inX, const f32 *inY, const f32 *inZ, f32 *outX,
+                             f32 *outY, f32 *outZ, size count, f32 w);
+        void NormalizeQuaternions(const Quaternion<f32> *quaternions, Quaternion<f32> *result, size count);
+        void Nlerp(const Quaternion<f32> *from, const Quaternion<f32> *to, const f32 *t, Quaternion<f32> *result,
+                   size count);
+        void Slerp(const Quaternion<f32> *from, const Quaternion<f32> *to, const f32 *t, Quaternion<f32> *result,
+                   size count);
+        void ComposeTransforms(const Float3 *positions, const Quaternion<f32> *rotations, const Float3 *scales,
+                               Mat4x4f *result, size count);
+        size CullBoundingBoxes(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                               const f32 *extentX, const f32 *extentY, const f32 *extentZ, size count, u32 firstIndex,
+                               u32 *visible);
+        size CullBoundingSpheres(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                                 const f32 *radii, size count, u32 firstIndex, u32 *visible);
+        void ConvertToHalf(const f32 *values, Half *result, size count);
+        void ConvertFromHalf(const Half *halves, f32 *result, size count);
+        void ConvertToSnorm16(const f32 *values, Snorm16 *result, size count);
+        void ConvertToUnorm8(const f32 *values, u8 *result, size count);
+        void EncodeOctahedral(const Float3 *normals, OctahedralNormal *result, size count);
+        void ConvertFromUnorm8(const u8 *values, f32 *result, size count);
+        void ConvertLinearToSrgb(const f32 *values, f32 *result, size count);
+        void ConvertSrgbToLinear(const f32 *values, f32 *result, size count);
+        void ConvertLinearToSrgb8(const f32 *rgba, u8 *result, size count);
+        void ConvertToR11G11B10(const f32 *rgb, R11G11B10 *result, size count);
+        void ConvertFromR11G11B10(const R11G11B10 *colors, f32 *rgb, size count);
+        void ConvertToRgb9E5(const f32 *rgb, Rgb9E5 *result, size count);
+        void ConvertFromRgb9E5(const Rgb9E5 *colors, f32 *rgb, size count);
+    } // namespace Avx2
+
+    SSSENGINE_GLOBAL TransformPacked_t TransformPacked = Sse::TransformPacked;
+    SSSENGINE_GLOBAL TransformStream_t TransformStream = Sse::TransformStream;
+    SSSENGINE_GLOBAL NormalizeQuaternions_t NormalizeQuaternions = Sse::NormalizeQuaternions;
+    SSSENGINE_GLOBAL InterpolateQuaternions_t Nlerp = Sse::Nlerp;
+    SSSENGINE_GLOBAL InterpolateQuaternions_t Slerp = Sse::Slerp;
+    SSSENGINE_GLOBAL ComposeTransforms_t ComposeTransforms = Sse::ComposeTransforms;
+    SSSENGINE_GLOBAL CullBoundingBoxes_t CullBoundingBoxes = Sse::CullBoundingBoxes;
+    SSSENGINE_GLOBAL CullBoundingSpheres_t CullBoundingSpheres = Sse::CullBoundingSpheres;
+    SSSENGINE_GLOBAL ConvertToHalf_t ConvertToHalf = Sse::ConvertToHalf;
+    SSSENGINE_GLOBAL ConvertFromHalf_t ConvertFromHalf = Sse::ConvertFromHalf;
+    SSSENGINE_GLOBAL ConvertToSnorm16_t ConvertToSnorm16 = Sse::ConvertToSnorm16;
+    SSSENGINE_GLOBAL ConvertToUnorm8_t ConvertToUnorm8 = Sse::ConvertToUnorm8;
+    SSSENGINE_GLOBAL EncodeOctahedral_t EncodeOctahedral = Sse::EncodeOctahedral;
+    SSSENGINE_GLOBAL ConvertFromUnorm8_t ConvertFromUnorm8 = Sse::ConvertFromUnorm8;
+    SSSENGINE_GLOBAL ConvertColorCurve_t ConvertLinearToSrgb = Sse::ConvertLinearToSrgb;
+    SSSENGINE_GLOBAL ConvertColorCurve_t ConvertSrgbToLinear = Sse::ConvertSrgbToLinear;
+    SSSENGINE_GLOBAL ConvertLinearToSrgb8_t ConvertLinearToSrgb8 = Sse::ConvertLinearToSrgb8;
+    SSSENGINE_GLOBAL ConvertToR11G11B10_t ConvertToR11G11B10 = Sse::ConvertToR11G11B10;
+    SSSENGINE_GLOBAL ConvertFromR11G11B10_t ConvertFromR11G11B10 = Sse::ConvertFromR11G11B10;
+    SSSENGINE_GLOBAL ConvertToRgb9E5_t ConvertToRgb9E5 = Sse::ConvertToRgb9E5;
+    SSSENGINE_GLOBAL ConvertFromRgb9E5_t ConvertFromRgb9E5 = Sse::ConvertFromRgb9E5;
+
+    /**
+     * @brief Points every kernel to the best implementation for the level. Must be called before other threads use the
+     * kernels, usually once at startup
+     *
+     * @param level The highest level the CPU supports. @see Platform::GetSimdLevel
+     * @return The level of the kernels that were loaded, which can be lower than level
+     */
+    SimdLevel LoadKernels(SimdLevel level);
+} // namespace SSSEngine::Math::Kernels
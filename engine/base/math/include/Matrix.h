@@ -28,8 +28,11 @@
 #include "Types.h"
 #include "Concepts.h"
 #include "Debug.h"
+#include "MatrixSimd.h"
+#include "Vector.h"
 #include <concepts>
 #include <type_traits>
+#include <utility>
 
 namespace SSSEngine::Math
 {
@@ -125,29 +128,341 @@ namespace SSSEngine::Math
     SSSENGINE_STATIC_ASSERT((SquareMatrixConcept<Matrix<float, 4, 4>>), "A 4x4 matrix is a square matrix");
     SSSENGINE_STATIC_ASSERT((!SquareMatrixConcept<Matrix<float, 3, 4>>), "A 3x4 matrix is not a square matrix");
 
-    template<MatrixTypeConcept T, MatrixTypeConcept V>
-        requires(std::same_as<T, V>) && (T::Columns() == V::Rows())
-    SSSENGINE_GLOBAL constexpr auto operator*(const T &lhs, const V &rhs)
+    namespace Detail
     {
-        using Type = typename T::Type;
-        constexpr MatrixSize RowsLhs = T::Rows();
-        constexpr MatrixSize RowsRhs = V::Rows();
-        constexpr MatrixSize ColumnsRhs = V::Columns();
+        /**
+         * @brief Scalar matrix multiplication. Used as the reference for the lazily evaluated products
+         *
+         * @param lhs The left hand side matrix
+         * @param rhs The right hand side matrix
+         * @return lhs * rhs
+         */
+        template<MatrixTypeConcept T, MatrixTypeConcept V>
+            requires(std::same_as<typename T::Type, typename V::Type>) && (T::Columns() == V::Rows())
+        constexpr Matrix<typename T::Type, V::Columns(), T::Rows()> MultiplyScalar(const T &lhs, const V &rhs)
+        {
+            constexpr MatrixSize Rows = T::Rows();
+            constexpr MatrixSize Inner = T::Columns();
+            constexpr MatrixSize Columns = V::Columns();
+
+            Matrix<typename T::Type, Columns, Rows> result;
+
+            // NOTE: Accessing data directly avoids the bounds checking done by the subscript operator
+            for(MatrixSize i = 0; i < Rows; ++i)
+            {
+                for(MatrixSize k = 0; k < Inner; ++k)
+                {
+                    for(MatrixSize j = 0; j < Columns; ++j)
+                    {
+                        result.data[i * Columns + j] += lhs.data[i * Inner + k] * rhs.data[k * Columns + j];
+                    }
+                }
+            }
 
-        Matrix<Type, ColumnsRhs, RowsRhs> result;
+            return result;
+        }
+    } // namespace Detail
+
+    template<typename Lhs, typename Rhs>
+    class MatrixProduct;
+
+    /**
+     * @brief Checks if Type T is a lazily evaluated MatrixProduct
+     */
+    template<typename T>
+    struct IsMatrixProduct : std::false_type
+    {
+    };
 
-        for(MatrixSize i = 0; i < RowsLhs; ++i)
+    template<typename Lhs, typename Rhs>
+    struct IsMatrixProduct<MatrixProduct<Lhs, Rhs>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief Anything that can be used as an operand of a matrix product: a Matrix or a MatrixProduct
+     */
+    template<typename T>
+    concept MatrixExpressionConcept =
+        MatrixTypeConcept<std::remove_cvref_t<T>> || IsMatrixProduct<std::remove_cvref_t<T>>::value;
+
+    /**
+     * @class MatrixProduct
+     * @brief A lazily evaluated product of matrices. Converts to the resulting Matrix, evaluating the whole chain in
+     * one pass row by row so a chain like world * view * projection never stores the intermediate matrices
+     * The right hand side is always a matrix, a product on the right hand side is evaluated when building the
+     * expression
+     *
+     * @tparam Lhs A Matrix or MatrixProduct. Matrices that are lvalues are stored by reference, everything else by
+     * value so a product can outlive the temporaries it was built from
+     * @tparam Rhs A Matrix, stored the same way as Lhs
+     */
+    template<typename Lhs, typename Rhs>
+    class MatrixProduct
+    {
+        using LhsType = std::remove_cvref_t<Lhs>;
+        using RhsType = std::remove_cvref_t<Rhs>;
+
+        public:
+        using Type = typename LhsType::Type;
+
+        static consteval MatrixSize Rows()
         {
-            for(MatrixSize k = 0; k < RowsLhs; ++k)
+            return LhsType::Rows();
+        }
+
+        static consteval MatrixSize Columns()
+        {
+            return RhsType::Columns();
+        }
+
+        using Result = Matrix<Type, Columns(), Rows()>;
+
+        /**
+         * @brief Every step of the chain is a 4x4 f32 product so every row fits in a SIMD register
+         */
+        static consteval bool IsSimd4x4()
+        {
+            if constexpr(std::same_as<Type, f32> && Rows() == 4 && Columns() == 4 && LhsType::Columns() == 4)
             {
-                for(MatrixSize j = 0; j < RowsLhs; ++j)
+                if constexpr(IsMatrixProduct<LhsType>::value)
                 {
-                    result[i, j] += lhs[i, k] * rhs[k, j];
+                    return LhsType::IsSimd4x4();
                 }
+                return true;
             }
+            return false;
         }
 
-        return result;
+        constexpr MatrixProduct(Lhs lhs, Rhs rhs) : m_Lhs{std::forward<Lhs>(lhs)}, m_Rhs{std::forward<Rhs>(rhs)} {}
+
+        /**
+         * @brief Evaluates a single row of the product
+         *
+         * @param row The row to evaluate
+         * @param result Where to write the Columns() elements of the row
+         */
+        constexpr void EvaluateRow(MatrixSize row, Type *result) const
+        {
+            constexpr MatrixSize Inner = LhsType::Columns();
+
+            Type buffer[Inner]{};
+            const Type *lhsRow = nullptr;
+            if constexpr(IsMatrixProduct<LhsType>::value)
+            {
+                m_Lhs.EvaluateRow(row, buffer);
+                lhsRow = buffer;
+            }
+            else
+            {
+                lhsRow = &m_Lhs.data[row * Inner];
+            }
+
+            const Type *rhs = m_Rhs.data;
+            for(MatrixSize j = 0; j < Columns(); ++j)
+            {
+                result[j] = lhsRow[0] * rhs[j];
+            }
+            for(MatrixSize k = 1; k < Inner; ++k)
+            {
+                for(MatrixSize j = 0; j < Columns(); ++j)
+                {
+                    result[j] += lhsRow[k] * rhs[k * Columns() + j];
+                }
+            }
+        }
+
+        /**
+         * @brief Evaluates a single row of a 4x4 f32 chain in a register. @see IsSimd4x4
+         */
+        SSSENGINE_FORCE_INLINE Vector128 EvaluateRow128(MatrixSize row) const
+            requires(IsSimd4x4())
+        {
+            if constexpr(IsMatrixProduct<LhsType>::value)
+            {
+                return Simd::MultiplyRow(m_Lhs.EvaluateRow128(row), m_Rhs.data);
+            }
+            else
+            {
+                return Simd::MultiplyRow(Simd::LoadRow(&m_Lhs.data[row * 4]), m_Rhs.data);
+            }
+        }
+
+#ifdef SSSENGINE_SIMD_AVX
+        /**
+         * @brief Evaluates two consecutive rows of a 4x4 f32 chain in a register. @see IsSimd4x4
+         */
+        SSSENGINE_FORCE_INLINE Vector256 EvaluateTwoRows256(MatrixSize row) const
+            requires(IsSimd4x4())
+        {
+            if constexpr(IsMatrixProduct<LhsType>::value)
+            {
+                return Simd::MultiplyTwoRows(m_Lhs.EvaluateTwoRows256(row), m_Rhs.data);
+            }
+            else
+            {
+                return Simd::MultiplyTwoRows(Simd::LoadTwoRows(&m_Lhs.data[row * 4]), m_Rhs.data);
+            }
+        }
+#endif
+
+        constexpr Result Evaluate() const
+        {
+            Result result;
+
+            if consteval
+            {
+                EvaluateRows(result);
+            }
+            else
+            {
+                if constexpr(IsSimd4x4() && !IsMatrixProduct<LhsType>::value)
+                {
+                    Simd::MultiplyMatrix4x4(m_Lhs.data, m_Rhs.data, result.data);
+                }
+                else if constexpr(IsSimd4x4())
+                {
+#ifdef SSSENGINE_SIMD_AVX
+                    Simd::StoreTwoRows(result.data, EvaluateTwoRows256(0));
+                    Simd::StoreTwoRows(&result.data[8], EvaluateTwoRows256(2));
+#else
+                    for(MatrixSize row = 0; row < 4; ++row)
+                    {
+                        Simd::StoreRow(&result.data[row * 4], EvaluateRow128(row));
+                    }
+#endif
+                }
+                else
+                {
+                    EvaluateRows(result);
+                }
+            }
+
+            return result;
+        }
+
+        // NOLINTNEXTLINE(*-explicit-constructor)
+        constexpr operator Result() const
+        {
+            return Evaluate();
+        }
+
+        private:
+        constexpr void EvaluateRows(Result &result) const
+        {
+            for(MatrixSize row = 0; row < Rows(); ++row)
+            {
+                EvaluateRow(row, &result.data[row * Columns()]);
+            }
+        }
+
+        Lhs m_Lhs;
+        Rhs m_Rhs;
+    };
+
+    /**
+     * @brief The resulting Matrix of an expression. Matrices are returned as they are
+     */
+    template<MatrixExpressionConcept T>
+    SSSENGINE_GLOBAL constexpr decltype(auto) Evaluate(const T &expression)
+    {
+        if constexpr(IsMatrixProduct<T>::value)
+        {
+            return expression.Evaluate();
+        }
+        else
+        {
+            return (expression);
+        }
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief How an operand is stored in a MatrixProduct. @see MatrixProduct
+         */
+        template<typename T>
+        using MatrixOperand =
+            std::conditional_t<std::is_lvalue_reference_v<T> && MatrixTypeConcept<std::remove_cvref_t<T>>,
+                               const std::remove_cvref_t<T> &,
+                               std::remove_cvref_t<T>>;
+    } // namespace Detail
+
+    /**
+     * @brief Multiplies two matrices or matrix expressions. The dimensions are checked at compile time
+     *
+     * @return A MatrixProduct that is evaluated when converted to a Matrix
+     */
+    template<MatrixExpressionConcept Lhs, MatrixExpressionConcept Rhs>
+        requires(std::same_as<typename std::remove_cvref_t<Lhs>::Type, typename std::remove_cvref_t<Rhs>::Type>) &&
+                (std::remove_cvref_t<Lhs>::Columns() == std::remove_cvref_t<Rhs>::Rows())
+    SSSENGINE_GLOBAL constexpr auto operator*(Lhs &&lhs, Rhs &&rhs)
+    {
+        using LhsOperand = Detail::MatrixOperand<Lhs>;
+
+        if constexpr(IsMatrixProduct<std::remove_cvref_t<Rhs>>::value)
+        {
+            using RhsOperand = typename std::remove_cvref_t<Rhs>::Result;
+            return MatrixProduct<LhsOperand, RhsOperand>{std::forward<Lhs>(lhs), rhs.Evaluate()};
+        }
+        else
+        {
+            return MatrixProduct<LhsOperand, Detail::MatrixOperand<Rhs>>{std::forward<Lhs>(lhs),
+                                                                         std::forward<Rhs>(rhs)};
+        }
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Scalar row vector transformation. Used for constant evaluation and for non f32 types
+         *
+         * @param vector The vector to transform
+         * @param matrix The transformation matrix
+         * @return vector * matrix
+         */
+        template<SSSEngine::NumberConcept T>
+        constexpr Vector4<T> TransformScalar(const Vector4<T> &vector, const Matrix<T, 4, 4> &matrix)
+        {
+            const T *m = matrix.data;
+
+            return {
+                vector.X * m[0] + vector.Y * m[4] + vector.Z * m[8] + vector.W * m[12],
+                vector.X * m[1] + vector.Y * m[5] + vector.Z * m[9] + vector.W * m[13],
+                vector.X * m[2] + vector.Y * m[6] + vector.Z * m[10] + vector.W * m[14],
+                vector.X * m[3] + vector.Y * m[7] + vector.Z * m[11] + vector.W * m[15],
+            };
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Transforms a row vector by a matrix (vector * matrix)
+     *
+     * @param vector The vector to transform
+     * @param matrix The transformation matrix
+     * @return The transformed vector
+     */
+    template<SSSEngine::NumberConcept T>
+    SSSENGINE_GLOBAL constexpr Vector4<T> operator*(const Vector4<T> &vector, const Matrix<T, 4, 4> &matrix)
+    {
+        if consteval
+        {
+            return Detail::TransformScalar(vector, matrix);
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                Vector4<T> result;
+                Simd::TransformVector4(&vector.X, matrix.data, &result.X);
+
+                return result;
+            }
+            else
+            {
+                return Detail::TransformScalar(vector, matrix);
+            }
+        }
     }
 
     template<MatrixTypeConcept T>
@@ -174,6 +489,285 @@ namespace SSSEngine::Math
         return !(lhs == rhs);
     }
 
+    template<MatrixExpressionConcept Lhs, MatrixExpressionConcept Rhs>
+        requires(IsMatrixProduct<Lhs>::value || IsMatrixProduct<Rhs>::value)
+    SSSENGINE_GLOBAL constexpr bool operator==(const Lhs &lhs, const Rhs &rhs)
+    {
+        return Evaluate(lhs) == Evaluate(rhs);
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief The 2x2 sub determinants of the top two rows (s) and the bottom two rows (c) shared by the scalar
+         * determinant and inverse
+         */
+        template<SSSEngine::RealConcept T>
+        struct SubDeterminants4x4
+        {
+            T s[6];
+            T c[6];
+
+            constexpr explicit SubDeterminants4x4(const T *m)
+                : s{m[0] * m[5] - m[4] * m[1],
+                    m[0] * m[6] - m[4] * m[2],
+                    m[0] * m[7] - m[4] * m[3],
+                    m[1] * m[6] - m[5] * m[2],
+                    m[1] * m[7] - m[5] * m[3],
+                    m[2] * m[7] - m[6] * m[3]},
+                  c{m[8] * m[13] - m[12] * m[9],
+                    m[8] * m[14] - m[12] * m[10],
+                    m[8] * m[15] - m[12] * m[11],
+                    m[9] * m[14] - m[13] * m[10],
+                    m[9] * m[15] - m[13] * m[11],
+                    m[10] * m[15] - m[14] * m[11]}
+            {
+            }
+
+            constexpr T Determinant() const
+            {
+                return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+            }
+        };
+
+        /**
+         * @brief Scalar 4x4 inverse by cofactors. Used for constant evaluation and for non f32 types
+         *
+         * @param matrix The matrix to invert
+         * @param result Where to write the inverse
+         * @return The determinant of matrix
+         */
+        template<SSSEngine::RealConcept T>
+        constexpr T InverseScalar(const Matrix<T, 4, 4> &matrix, Matrix<T, 4, 4> &result)
+        {
+            const T *m = matrix.data;
+            const SubDeterminants4x4<T> sub{m};
+            const T *s = sub.s;
+            const T *c = sub.c;
+
+            const T determinant = sub.Determinant();
+            const T inverse = T{1} / determinant;
+
+            result = Matrix<T, 4, 4>{
+                (m[5] * c[5] - m[6] * c[4] + m[7] * c[3]) * inverse,
+                (-m[1] * c[5] + m[2] * c[4] - m[3] * c[3]) * inverse,
+                (m[13] * s[5] - m[14] * s[4] + m[15] * s[3]) * inverse,
+                (-m[9] * s[5] + m[10] * s[4] - m[11] * s[3]) * inverse,
+
+                (-m[4] * c[5] + m[6] * c[2] - m[7] * c[1]) * inverse,
+                (m[0] * c[5] - m[2] * c[2] + m[3] * c[1]) * inverse,
+                (-m[12] * s[5] + m[14] * s[2] - m[15] * s[1]) * inverse,
+                (m[8] * s[5] - m[10] * s[2] + m[11] * s[1]) * inverse,
+
+                (m[4] * c[4] - m[5] * c[2] + m[7] * c[0]) * inverse,
+                (-m[0] * c[4] + m[1] * c[2] - m[3] * c[0]) * inverse,
+                (m[12] * s[4] - m[13] * s[2] + m[15] * s[0]) * inverse,
+                (-m[8] * s[4] + m[9] * s[2] - m[11] * s[0]) * inverse,
+
+                (-m[4] * c[3] + m[5] * c[1] - m[6] * c[0]) * inverse,
+                (m[0] * c[3] - m[1] * c[1] + m[2] * c[0]) * inverse,
+                (-m[12] * s[3] + m[13] * s[1] - m[14] * s[0]) * inverse,
+                (m[8] * s[3] - m[9] * s[1] + m[10] * s[0]) * inverse,
+            };
+
+            return determinant;
+        }
+
+        /**
+         * @brief Writes the inverse of a transform given the inverse of its upper 3x3 part. @see Simd::InverseAffine4x4
+         */
+        template<SSSEngine::RealConcept T>
+        constexpr void StoreTransformInverse(Matrix<T, 4, 4> &result, const Matrix<T, 4, 4> &matrix)
+        {
+            const T *t = &matrix.data[12];
+            for(MatrixSize column = 0; column < 3; ++column)
+            {
+                result.data[12 + column] =
+                    -(t[0] * result.data[column] + t[1] * result.data[4 + column] + t[2] * result.data[8 + column]);
+            }
+            result.data[3] = result.data[7] = result.data[11] = 0;
+            result.data[15] = 1;
+        }
+
+        /**
+         * @brief Scalar affine inverse. Used for constant evaluation and for non f32 types
+         *
+         * @return The determinant of matrix
+         */
+        template<SSSEngine::RealConcept T>
+        constexpr T InverseAffineScalar(const Matrix<T, 4, 4> &matrix, Matrix<T, 4, 4> &result)
+        {
+            const T *m = matrix.data;
+
+            // NOTE: Transposed cofactors of the upper 3x3 part
+            const T c00 = m[5] * m[10] - m[6] * m[9];
+            const T c01 = m[2] * m[9] - m[1] * m[10];
+            const T c02 = m[1] * m[6] - m[2] * m[5];
+            const T c10 = m[6] * m[8] - m[4] * m[10];
+            const T c11 = m[0] * m[10] - m[2] * m[8];
+            const T c12 = m[2] * m[4] - m[0] * m[6];
+            const T c20 = m[4] * m[9] - m[5] * m[8];
+            const T c21 = m[1] * m[8] - m[0] * m[9];
+            const T c22 = m[0] * m[5] - m[1] * m[4];
+
+            const T determinant = m[0] * c00 + m[1] * c10 + m[2] * c20;
+            const T inverse = T{1} / determinant;
+
+            Matrix<T, 4, 4> inverted{
+                c00 * inverse, c01 * inverse, c02 * inverse, 0,
+                c10 * inverse, c11 * inverse, c12 * inverse, 0,
+                c20 * inverse, c21 * inverse, c22 * inverse, 0,
+                0, 0, 0, 1,
+            };
+            StoreTransformInverse(inverted, matrix);
+            result = inverted;
+
+            return determinant;
+        }
+
+        /**
+         * @brief Scalar rigid inverse. Used for constant evaluation and for non f32 types
+         */
+        template<SSSEngine::RealConcept T>
+        constexpr void InverseRigidScalar(const Matrix<T, 4, 4> &matrix, Matrix<T, 4, 4> &result)
+        {
+            const T *m = matrix.data;
+
+            Matrix<T, 4, 4> inverted{
+                m[0], m[4], m[8], 0,
+                m[1], m[5], m[9], 0,
+                m[2], m[6], m[10], 0,
+                0, 0, 0, 1,
+            };
+            StoreTransformInverse(inverted, matrix);
+            result = inverted;
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Computes the determinant of a 4x4 matrix
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr T Determinant(const Matrix<T, 4, 4> &matrix)
+    {
+        if consteval
+        {
+            return Detail::SubDeterminants4x4<T>{matrix.data}.Determinant();
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                return Simd::Determinant4x4(matrix.data);
+            }
+            else
+            {
+                return Detail::SubDeterminants4x4<T>{matrix.data}.Determinant();
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the inverse of any invertible 4x4 matrix
+     * Prefer InverseAffine or InverseRigid when the matrix is known to be a transform, they are cheaper
+     *
+     * @param matrix An invertible matrix
+     * @return The inverse of matrix
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Matrix<T, 4, 4> Inverse(const Matrix<T, 4, 4> &matrix)
+    {
+        Matrix<T, 4, 4> result;
+        T determinant;
+
+        if consteval
+        {
+            determinant = Detail::InverseScalar(matrix, result);
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                determinant = Simd::InverseMatrix4x4(matrix.data, result.data);
+            }
+            else
+            {
+                determinant = Detail::InverseScalar(matrix, result);
+            }
+        }
+
+        SSSENGINE_ASSERT(determinant != 0);
+
+        return result;
+    }
+
+    /**
+     * @brief Computes the inverse of an affine transform, for example a world matrix with scale
+     *
+     * @param matrix An invertible transform. The last column must be (0, 0, 0, 1)
+     * @return The inverse of matrix
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Matrix<T, 4, 4> InverseAffine(const Matrix<T, 4, 4> &matrix)
+    {
+        SSSENGINE_ASSERT(matrix.data[3] == 0 && matrix.data[7] == 0 && matrix.data[11] == 0 && matrix.data[15] == 1);
+
+        Matrix<T, 4, 4> result;
+        T determinant;
+
+        if consteval
+        {
+            determinant = Detail::InverseAffineScalar(matrix, result);
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                determinant = Simd::InverseAffine4x4(matrix.data, result.data);
+            }
+            else
+            {
+                determinant = Detail::InverseAffineScalar(matrix, result);
+            }
+        }
+
+        SSSENGINE_ASSERT(determinant != 0);
+
+        return result;
+    }
+
+    /**
+     * @brief Computes the inverse of a rigid transform, for example a view matrix
+     *
+     * @param matrix A rotation followed by a translation, without any scale. The last column must be (0, 0, 0, 1)
+     * @return The inverse of matrix
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Matrix<T, 4, 4> InverseRigid(const Matrix<T, 4, 4> &matrix)
+    {
+        SSSENGINE_ASSERT(matrix.data[3] == 0 && matrix.data[7] == 0 && matrix.data[11] == 0 && matrix.data[15] == 1);
+
+        Matrix<T, 4, 4> result;
+
+        if consteval
+        {
+            Detail::InverseRigidScalar(matrix, result);
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                Simd::InverseRigid4x4(matrix.data, result.data);
+            }
+            else
+            {
+                Detail::InverseRigidScalar(matrix, result);
+            }
+        }
+
+        return result;
+    }
+
     /**
      * @brief Get a matrix where column == row is set to 1 and 0 otherwise
      *
@@ -0,0 +1,383 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief SIMD kernels used by the matrix operations at runtime
+ * Every kernel works on row major 4x4 f32 matrices and row vectors (v * M) and does not require aligned memory
+ */
+
+#pragma once
+
+#include "Attributes.h"
+#include "Intrinsics.h"
+#include "Types.h"
+#include "VectorSimd.h"
+
+namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
+{
+    /**
+     * @brief Computes the dot product of a row with every column of the matrix represented by rows
+     *
+     * @param row The row (or row vector) to multiply
+     * @return The row multiplied by the matrix
+     */
+    SSSENGINE_FORCE_INLINE Vector128 MultiplyRow(Vector128 row, Vector128 row0, Vector128 row1, Vector128 row2,
+                                                 Vector128 row3)
+    {
+        Vector128 result = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+
+        return result;
+    }
+
+#ifdef SSSENGINE_SIMD_AVX
+    /**
+     * @brief Multiplies two rows at once. Each 128 bit lane of rows holds one row of the left hand side
+     *
+     * @param rows Two rows of the left hand side
+     * @param row0 The first row of the right hand side broadcasted to both lanes. Same for the others
+     * @return The two rows of the result
+     */
+    SSSENGINE_FORCE_INLINE Vector256 MultiplyTwoRows(Vector256 rows, Vector256 row0, Vector256 row1, Vector256 row2,
+                                                     Vector256 row3)
+    {
+        Vector256 result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+    #ifdef SSSENGINE_SIMD_FMA
+        result = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), row1, result);
+        result = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), row2, result);
+        result = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), row3, result);
+    #else
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+    #endif
+
+        return result;
+    }
+#endif
+
+#ifdef SSSENGINE_SIMD_AVX
+    SSSENGINE_FORCE_INLINE Vector256 LoadTwoRows(const f32 *rows)
+    {
+        return _mm256_loadu_ps(rows);
+    }
+
+    SSSENGINE_FORCE_INLINE void StoreTwoRows(f32 *destination, Vector256 rows)
+    {
+        _mm256_storeu_ps(destination, rows);
+    }
+
+    /**
+     * @brief Multiplies two rows held in a register by a 4x4 matrix
+     *
+     * @param matrix The 16 elements of the matrix
+     */
+    SSSENGINE_FORCE_INLINE Vector256 MultiplyTwoRows(Vector256 rows, const f32 *matrix)
+    {
+        return MultiplyTwoRows(rows,
+                               _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(matrix)),
+                               _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(matrix + 4)),
+                               _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(matrix + 8)),
+                               _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(matrix + 12)));
+    }
+#endif
+
+    /**
+     * @brief Multiplies two 4x4 matrices (lhs * rhs)
+     *
+     * @param lhs The 16 elements of the left hand side matrix
+     * @param rhs The 16 elements of the right hand side matrix
+     * @param result Where to write the 16 elements of the result. Must not overlap lhs or rhs
+     */
+    SSSENGINE_FORCE_INLINE void MultiplyMatrix4x4(const f32 *lhs, const f32 *rhs, f32 *result)
+    {
+#ifdef SSSENGINE_SIMD_AVX
+        const Vector256 row0 = _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(rhs));
+        const Vector256 row1 = _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(rhs + 4));
+        const Vector256 row2 = _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(rhs + 8));
+        const Vector256 row3 = _mm256_broadcast_ps(reinterpret_cast<const Vector128 *>(rhs + 12));
+
+        _mm256_storeu_ps(result, MultiplyTwoRows(_mm256_loadu_ps(lhs), row0, row1, row2, row3));
+        _mm256_storeu_ps(result + 8, MultiplyTwoRows(_mm256_loadu_ps(lhs + 8), row0, row1, row2, row3));
+#else
+        const Vector128 row0 = _mm_loadu_ps(rhs);
+        const Vector128 row1 = _mm_loadu_ps(rhs + 4);
+        const Vector128 row2 = _mm_loadu_ps(rhs + 8);
+        const Vector128 row3 = _mm_loadu_ps(rhs + 12);
+
+        _mm_storeu_ps(result, MultiplyRow(_mm_loadu_ps(lhs), row0, row1, row2, row3));
+        _mm_storeu_ps(result + 4, MultiplyRow(_mm_loadu_ps(lhs + 4), row0, row1, row2, row3));
+        _mm_storeu_ps(result + 8, MultiplyRow(_mm_loadu_ps(lhs + 8), row0, row1, row2, row3));
+        _mm_storeu_ps(result + 12, MultiplyRow(_mm_loadu_ps(lhs + 12), row0, row1, row2, row3));
+#endif
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 LoadRow(const f32 *row)
+    {
+        return _mm_loadu_ps(row);
+    }
+
+    SSSENGINE_FORCE_INLINE void StoreRow(f32 *destination, Vector128 row)
+    {
+        _mm_storeu_ps(destination, row);
+    }
+
+    /**
+     * @brief Multiplies a row held in a register by a 4x4 matrix (row * matrix)
+     *
+     * @param matrix The 16 elements of the matrix
+     */
+    SSSENGINE_FORCE_INLINE Vector128 MultiplyRow(Vector128 row, const f32 *matrix)
+    {
+        return MultiplyRow(
+            row, _mm_loadu_ps(matrix), _mm_loadu_ps(matrix + 4), _mm_loadu_ps(matrix + 8), _mm_loadu_ps(matrix + 12));
+    }
+
+    /**
+     * @brief Transforms a row vector by a 4x4 matrix (vector * matrix)
+     *
+     * @param vector The 4 elements of the vector
+     * @param matrix The 16 elements of the matrix
+     * @param result Where to write the 4 elements of the result
+     */
+    SSSENGINE_FORCE_INLINE void TransformVector4(const f32 *vector, const f32 *matrix, f32 *result)
+    {
+        _mm_storeu_ps(result,
+                      MultiplyRow(_mm_loadu_ps(vector),
+                                  _mm_loadu_ps(matrix),
+                                  _mm_loadu_ps(matrix + 4),
+                                  _mm_loadu_ps(matrix + 8),
+                                  _mm_loadu_ps(matrix + 12)));
+    }
+    /**
+     * @brief Takes the first two elements from lhs and the last two from rhs
+     */
+    template<int X, int Y, int Z, int W>
+    SSSENGINE_FORCE_INLINE Vector128 Combine(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    /**
+     * @brief Sum of every element broadcasted to every element
+     */
+    SSSENGINE_FORCE_INLINE Vector128 HorizontalSum(Vector128 vector)
+    {
+        vector = _mm_add_ps(vector, Swizzle<2, 3, 0, 1>(vector));
+        return _mm_add_ps(vector, Swizzle<1, 0, 3, 2>(vector));
+    }
+
+    /**
+     * @brief Multiplies two 2x2 matrices stored in a register (lhs * rhs)
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Multiply2x2(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_add_ps(_mm_mul_ps(lhs, Swizzle<0, 3, 0, 3>(rhs)),
+                          _mm_mul_ps(Swizzle<1, 0, 3, 2>(lhs), Swizzle<2, 1, 2, 1>(rhs)));
+    }
+
+    /**
+     * @brief Multiplies the adjugate of a 2x2 matrix by another (adjugate(lhs) * rhs)
+     */
+    SSSENGINE_FORCE_INLINE Vector128 AdjugateMultiply2x2(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(lhs), rhs),
+                          _mm_mul_ps(Swizzle<1, 1, 2, 2>(lhs), Swizzle<2, 3, 0, 1>(rhs)));
+    }
+
+    /**
+     * @brief Multiplies a 2x2 matrix by the adjugate of another (lhs * adjugate(rhs))
+     */
+    SSSENGINE_FORCE_INLINE Vector128 MultiplyAdjugate2x2(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_sub_ps(_mm_mul_ps(lhs, Swizzle<3, 0, 3, 0>(rhs)),
+                          _mm_mul_ps(Swizzle<1, 0, 3, 2>(lhs), Swizzle<2, 1, 2, 1>(rhs)));
+    }
+
+    /**
+     * @brief The 2x2 blocks of a 4x4 matrix and the values shared by its determinant and inverse
+     * The matrix is seen as | A B |
+     *                       | C D |
+     */
+    struct BlockMatrix4x4
+    {
+        Vector128 A, B, C, D;
+        // NOTE: The determinants of A, B, C and D in that order
+        Vector128 SubDeterminants;
+        Vector128 AdjugateAB, AdjugateDC;
+        // NOTE: The determinant of the whole matrix broadcasted to every element
+        Vector128 Determinant;
+    };
+
+    SSSENGINE_FORCE_INLINE BlockMatrix4x4 LoadBlocks(const f32 *matrix)
+    {
+        const Vector128 row0 = _mm_loadu_ps(matrix);
+        const Vector128 row1 = _mm_loadu_ps(matrix + 4);
+        const Vector128 row2 = _mm_loadu_ps(matrix + 8);
+        const Vector128 row3 = _mm_loadu_ps(matrix + 12);
+
+        BlockMatrix4x4 blocks;
+        blocks.A = _mm_movelh_ps(row0, row1);
+        blocks.B = _mm_movehl_ps(row1, row0);
+        blocks.C = _mm_movelh_ps(row2, row3);
+        blocks.D = _mm_movehl_ps(row3, row2);
+
+        blocks.SubDeterminants =
+            _mm_sub_ps(_mm_mul_ps(Combine<0, 2, 0, 2>(row0, row2), Combine<1, 3, 1, 3>(row1, row3)),
+                       _mm_mul_ps(Combine<1, 3, 1, 3>(row0, row2), Combine<0, 2, 0, 2>(row1, row3)));
+
+        blocks.AdjugateAB = AdjugateMultiply2x2(blocks.A, blocks.B);
+        blocks.AdjugateDC = AdjugateMultiply2x2(blocks.D, blocks.C);
+
+        // NOTE: |M| = |A||D| + |B||C| - trace(adjugate(A)B adjugate(D)C)
+        const Vector128 determinants = _mm_mul_ps(blocks.SubDeterminants, Swizzle<3, 2, 1, 0>(blocks.SubDeterminants));
+        const Vector128 trace = HorizontalSum(_mm_mul_ps(blocks.AdjugateAB, Swizzle<0, 2, 1, 3>(blocks.AdjugateDC)));
+        blocks.Determinant =
+            _mm_sub_ps(_mm_add_ps(Swizzle<0, 0, 0, 0>(determinants), Swizzle<1, 1, 1, 1>(determinants)), trace);
+
+        return blocks;
+    }
+
+    /**
+     * @brief Computes the determinant of a 4x4 matrix
+     *
+     * @param matrix The 16 elements of the matrix
+     * @return The determinant
+     */
+    SSSENGINE_FORCE_INLINE f32 Determinant4x4(const f32 *matrix)
+    {
+        return _mm_cvtss_f32(LoadBlocks(matrix).Determinant);
+    }
+
+    /**
+     * @brief Computes the inverse of a 4x4 matrix with the block matrix method
+     *
+     * @param matrix The 16 elements of the matrix
+     * @param result Where to write the 16 elements of the inverse. Can be the same as matrix
+     * @return The determinant of the matrix. When it is 0 the result is not finite
+     */
+    SSSENGINE_FORCE_INLINE f32 InverseMatrix4x4(const f32 *matrix, f32 *result)
+    {
+        const BlockMatrix4x4 blocks = LoadBlocks(matrix);
+
+        const Vector128 detA = Swizzle<0, 0, 0, 0>(blocks.SubDeterminants);
+        const Vector128 detB = Swizzle<1, 1, 1, 1>(blocks.SubDeterminants);
+        const Vector128 detC = Swizzle<2, 2, 2, 2>(blocks.SubDeterminants);
+        const Vector128 detD = Swizzle<3, 3, 3, 3>(blocks.SubDeterminants);
+
+        // NOTE: The adjugates of the blocks of the inverse | X Y |
+        //                                                  | Z W |
+        Vector128 x = _mm_sub_ps(_mm_mul_ps(detD, blocks.A), Multiply2x2(blocks.B, blocks.AdjugateDC));
+        Vector128 w = _mm_sub_ps(_mm_mul_ps(detA, blocks.D), Multiply2x2(blocks.C, blocks.AdjugateAB));
+        Vector128 y = _mm_sub_ps(_mm_mul_ps(detB, blocks.C), MultiplyAdjugate2x2(blocks.D, blocks.AdjugateAB));
+        Vector128 z = _mm_sub_ps(_mm_mul_ps(detC, blocks.B), MultiplyAdjugate2x2(blocks.A, blocks.AdjugateDC));
+
+        // NOTE: The signs of the adjugate are applied together with the division by the determinant
+        const Vector128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1, -1, -1, 1), blocks.Determinant);
+        x = _mm_mul_ps(x, inverseDeterminant);
+        y = _mm_mul_ps(y, inverseDeterminant);
+        z = _mm_mul_ps(z, inverseDeterminant);
+        w = _mm_mul_ps(w, inverseDeterminant);
+
+        // NOTE: Reordering each adjugate into its place transposes it as well
+        _mm_storeu_ps(result, Combine<3, 1, 3, 1>(x, y));
+        _mm_storeu_ps(result + 4, Combine<2, 0, 2, 0>(x, y));
+        _mm_storeu_ps(result + 8, Combine<3, 1, 3, 1>(z, w));
+        _mm_storeu_ps(result + 12, Combine<2, 0, 2, 0>(z, w));
+
+        return _mm_cvtss_f32(blocks.Determinant);
+    }
+
+    /**
+     * @brief Writes the inverse of a transform given the inverse of its upper 3x3 part
+     * The inverse of | L 0 | is | inverse(L)     0 |
+     *                | t 1 |    | -t inverse(L)  1 |
+     *
+     * @param translation The last row of the transform
+     */
+    SSSENGINE_FORCE_INLINE void StoreTransformInverse(Vector128 row0, Vector128 row1, Vector128 row2,
+                                                      Vector128 translation, f32 *result)
+    {
+        Vector128 inverseTranslation = _mm_mul_ps(Swizzle<0, 0, 0, 0>(translation), row0);
+        inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(Swizzle<1, 1, 1, 1>(translation), row1));
+        inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(Swizzle<2, 2, 2, 2>(translation), row2));
+        inverseTranslation = _mm_sub_ps(_mm_setr_ps(0, 0, 0, 1), inverseTranslation);
+
+        _mm_storeu_ps(result, row0);
+        _mm_storeu_ps(result + 4, row1);
+        _mm_storeu_ps(result + 8, row2);
+        _mm_storeu_ps(result + 12, inverseTranslation);
+    }
+
+    /**
+     * @brief Computes the inverse of an affine transform. The last column must be (0, 0, 0, 1)
+     *
+     * @param matrix The 16 elements of the matrix
+     * @param result Where to write the 16 elements of the inverse. Can be the same as matrix
+     * @return The determinant of the matrix. When it is 0 the result is not finite
+     */
+    SSSENGINE_FORCE_INLINE f32 InverseAffine4x4(const f32 *matrix, f32 *result)
+    {
+        const Vector128 row0 = _mm_loadu_ps(matrix);
+        const Vector128 row1 = _mm_loadu_ps(matrix + 4);
+        const Vector128 row2 = _mm_loadu_ps(matrix + 8);
+
+        // NOTE: The inverse of a 3x3 matrix is the transpose of the cross products of its rows over its determinant
+        Vector128 cofactor0 = Cross(row1, row2);
+        Vector128 cofactor1 = Cross(row2, row0);
+        Vector128 cofactor2 = Cross(row0, row1);
+        Vector128 cofactor3 = _mm_setzero_ps();
+
+        const Vector128 determinant = HorizontalSum(_mm_mul_ps(row0, cofactor0));
+        const Vector128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1), determinant);
+
+        _MM_TRANSPOSE4_PS(cofactor0, cofactor1, cofactor2, cofactor3);
+
+        StoreTransformInverse(_mm_mul_ps(cofactor0, inverseDeterminant),
+                              _mm_mul_ps(cofactor1, inverseDeterminant),
+                              _mm_mul_ps(cofactor2, inverseDeterminant),
+                              _mm_loadu_ps(matrix + 12),
+                              result);
+
+        return _mm_cvtss_f32(determinant);
+    }
+
+    /**
+     * @brief Computes the inverse of a rigid transform (a rotation followed by a translation)
+     *
+     * @param matrix The 16 elements of the matrix
+     * @param result Where to write the 16 elements of the inverse. Can be the same as matrix
+     */
+    SSSENGINE_FORCE_INLINE void InverseRigid4x4(const f32 *matrix, f32 *result)
+    {
+        // NOTE: The inverse of a rotation is its transpose
+        Vector128 row0 = _mm_loadu_ps(matrix);
+        Vector128 row1 = _mm_loadu_ps(matrix + 4);
+        Vector128 row2 = _mm_loadu_ps(matrix + 8);
+        Vector128 row3 = _mm_setzero_ps();
+        const Vector128 translation = _mm_loadu_ps(matrix + 12);
+
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        StoreTransformInverse(row0, row1, row2, translation, result);
+    }
+} // namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
@@ -0,0 +1,582 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Compact formats for vertex attributes and the conversions from the float types
+ * Half is an IEEE 754 binary16, Snorm16 maps [-1, 1] to [-32767, 32767] and unorm8 maps [0, 1] to [0, 255], like the
+ * matching DXGI formats. The batch conversions go through the kernel tables so they use F16C when the CPU has it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <span>
+#include "Attributes.h"
+#include "BatchTransform.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "MathKernels.h"
+#include "SimdOperations.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    /**
+     * @class Half
+     * @brief 16 bit float. Only used for storage, convert to f32 for math
+     *
+     */
+    struct Half
+    {
+        u16 Bits{0};
+
+        friend SSSENGINE_GLOBAL bool operator==(Half lhs, Half rhs)
+        {
+            return lhs.Bits == rhs.Bits;
+        }
+    };
+
+    struct Half2
+    {
+        Half X, Y;
+    };
+
+    struct Half4
+    {
+        Half X, Y, Z, W;
+    };
+
+    /**
+     * @class Snorm16
+     * @brief Signed normalized value in [-1, 1] stored in 16 bits
+     *
+     */
+    struct Snorm16
+    {
+        i16 Value{0};
+
+        friend SSSENGINE_GLOBAL bool operator==(Snorm16 lhs, Snorm16 rhs)
+        {
+            return lhs.Value == rhs.Value;
+        }
+    };
+
+    /**
+     * @class OctahedralNormal
+     * @brief Unit vector projected on an octahedron unfolded into a square (Q. Meyer et al., On Floating-Point Normal
+     * Vectors). 4 bytes instead of 12 with an error below 1e-4
+     *
+     */
+    struct OctahedralNormal
+    {
+        Snorm16 X, Y;
+    };
+
+    SSSENGINE_STATIC_ASSERT(sizeof(Half) == 2, "Half must be 2 bytes")
+    SSSENGINE_STATIC_ASSERT(sizeof(Half4) == 8, "Half4 must be tightly packed")
+    SSSENGINE_STATIC_ASSERT(sizeof(OctahedralNormal) == 4, "OctahedralNormal must be tightly packed")
+
+    namespace Detail
+    {
+        constexpr u32 F32SignMask = 0x8000'0000u;
+        constexpr u32 F32Infinity = 255u << 23;
+        // NOTE: The smallest float that is infinity as a half after rounding, 2^16
+        constexpr u32 F16Overflow = (127u + 16u) << 23;
+        // NOTE: The smallest float that is a normal half, 2^-14
+        constexpr u32 F16SmallestNormal = 113u << 23;
+        // NOTE: Adding 0.5 makes the FPU round the mantissa of a denormal half into place
+        constexpr u32 F16DenormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        // NOTE: Rebiases the exponent from 15 to 127 and adds the rounding bias of the 13 dropped bits
+        constexpr u32 F16Rebias = ((15u - 127u) << 23) + 0xFFFu;
+        constexpr u32 F16ToF32Magic = (254u - 15u) << 23;
+        constexpr u16 F16QuietNan = 0x7E00;
+        constexpr u16 F16Infinity = 0x7C00;
+    } // namespace Detail
+
+    /**
+     * @brief Rounds to the nearest half, ties to even. Values too large become infinity
+     */
+    SSSENGINE_GLOBAL constexpr Half ToHalf(f32 value)
+    {
+        using namespace Detail;
+
+        // NOTE: F. Giesen, float_to_half_fast3_rtne
+        u32 bits = std::bit_cast<u32>(value);
+        const u32 sign = bits & F32SignMask;
+        bits ^= sign;
+
+        u32 result;
+        if(bits >= F16Overflow)
+        {
+            result = bits > F32Infinity ? F16QuietNan : F16Infinity;
+        }
+        else if(bits < F16SmallestNormal)
+        {
+            const f32 denormal = std::bit_cast<f32>(bits) + std::bit_cast<f32>(F16DenormalMagic);
+            result = std::bit_cast<u32>(denormal) - F16DenormalMagic;
+        }
+        else
+        {
+            const u32 mantissaOdd = (bits >> 13) & 1;
+            result = (bits + F16Rebias + mantissaOdd) >> 13;
+        }
+
+        return {static_cast<u16>(result | (sign >> 16))};
+    }
+
+    SSSENGINE_GLOBAL constexpr f32 FromHalf(Half half)
+    {
+        using namespace Detail;
+
+        // NOTE: The multiplication rebiases the exponent and normalizes the denormals at the same time
+        f32 value = std::bit_cast<f32>(static_cast<u32>(half.Bits & 0x7FFFu) << 13) * std::bit_cast<f32>(F16ToF32Magic);
+        if(value >= std::bit_cast<f32>(F16Overflow))
+        {
+            value = std::bit_cast<f32>(std::bit_cast<u32>(value) | F32Infinity);
+        }
+
+        return std::bit_cast<f32>(std::bit_cast<u32>(value) | (static_cast<u32>(half.Bits & 0x8000u) << 16));
+    }
+
+    /**
+     * @brief Clamps to [-1, 1] and rounds to the nearest snorm16
+     */
+    SSSENGINE_GLOBAL Snorm16 ToSnorm16(f32 value)
+    {
+        return {static_cast<i16>(std::nearbyint(std::clamp(value, -1.0f, 1.0f) * 32767))};
+    }
+
+    SSSENGINE_GLOBAL constexpr f32 FromSnorm16(Snorm16 value)
+    {
+        // NOTE: -32768 and -32767 are both -1
+        return std::max(static_cast<f32>(value.Value) / 32767, -1.0f);
+    }
+
+    /**
+     * @brief Clamps to [0, 1] and rounds to the nearest unorm8
+     */
+    SSSENGINE_GLOBAL u8 ToUnorm8(f32 value)
+    {
+        return static_cast<u8>(std::nearbyint(std::clamp(value, 0.0f, 1.0f) * 255));
+    }
+
+    SSSENGINE_GLOBAL constexpr f32 FromUnorm8(u8 value)
+    {
+        return static_cast<f32>(value) / 255;
+    }
+
+    /**
+     * @param normal Must be a unit vector
+     */
+    SSSENGINE_GLOBAL OctahedralNormal EncodeOctahedral(Float3 normal)
+    {
+        const f32 inverseLength = 1 / (std::abs(normal.X) + std::abs(normal.Y) + std::abs(normal.Z));
+        f32 x = normal.X * inverseLength;
+        f32 y = normal.Y * inverseLength;
+
+        // NOTE: The lower hemisphere is folded over the diagonals
+        if(normal.Z < 0)
+        {
+            const f32 foldedX = (1 - std::abs(y)) * std::copysign(1.0f, x);
+            y = (1 - std::abs(x)) * std::copysign(1.0f, y);
+            x = foldedX;
+        }
+
+        return {ToSnorm16(x), ToSnorm16(y)};
+    }
+
+    SSSENGINE_GLOBAL Float3 DecodeOctahedral(OctahedralNormal encoded)
+    {
+        f32 x = FromSnorm16(encoded.X);
+        f32 y = FromSnorm16(encoded.Y);
+        const f32 z = 1 - std::abs(x) - std::abs(y);
+
+        // NOTE: Unfolds the lower hemisphere without branches (R. Stubbe)
+        const f32 fold = std::max(-z, 0.0f);
+        x += x >= 0 ? -fold : fold;
+        y += y >= 0 ? -fold : fold;
+
+        const f32 inverseLength = 1 / std::sqrt(x * x + y * y + z * z);
+        return {x * inverseLength, y * inverseLength, z * inverseLength};
+    }
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        SSSENGINE_FORCE_INLINE __m128i Set1Integer(u32 value)
+        {
+            return _mm_set1_epi32(static_cast<i32>(value));
+        }
+
+        SSSENGINE_FORCE_INLINE __m128i SelectInteger(__m128i mask, __m128i onTrue, __m128i onFalse)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, onTrue), _mm_andnot_si128(mask, onFalse));
+        }
+
+        /**
+         * @brief Lane wise ToHalf
+         *
+         * @return The 4 halves in the low 64 bits
+         */
+        SSSENGINE_FORCE_INLINE __m128i ToHalf4(Vector128 value)
+        {
+            using namespace Detail;
+#ifdef SSSENGINE_SIMD_F16C
+            return _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+            const __m128i original = _mm_castps_si128(value);
+            const __m128i sign = _mm_and_si128(original, Set1Integer(F32SignMask));
+            const __m128i bits = _mm_xor_si128(original, sign);
+
+            const Vector128 denormal =
+                _mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(Set1Integer(F16DenormalMagic)));
+            const __m128i denormalResult = _mm_sub_epi32(_mm_castps_si128(denormal), Set1Integer(F16DenormalMagic));
+
+            const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+            const __m128i normalResult = _mm_srli_epi32(
+                _mm_add_epi32(_mm_add_epi32(bits, Set1Integer(F16Rebias)), mantissaOdd), 13);
+
+            const __m128i special = SelectInteger(_mm_cmpgt_epi32(bits, Set1Integer(F32Infinity)),
+                                                  _mm_set1_epi32(F16QuietNan),
+                                                  _mm_set1_epi32(F16Infinity));
+
+            // NOTE: Without the sign every value is a positive integer so the signed compares work
+            __m128i result =
+                SelectInteger(_mm_cmplt_epi32(bits, Set1Integer(F16SmallestNormal)), denormalResult, normalResult);
+            result = SelectInteger(_mm_cmpgt_epi32(bits, Set1Integer(F16Overflow - 1)), special, result);
+            result = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+            // NOTE: Sign extends from 16 bits so the saturation of the pack does not change the values
+            result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+            return _mm_packs_epi32(result, result);
+#endif
+        }
+
+        /**
+         * @brief Lane wise FromHalf
+         *
+         * @param halves 4 halves in the low 64 bits
+         */
+        SSSENGINE_FORCE_INLINE Vector128 FromHalf4(__m128i halves)
+        {
+            using namespace Detail;
+#ifdef SSSENGINE_SIMD_F16C
+            return _mm_cvtph_ps(halves);
+#else
+            const __m128i bits = _mm_unpacklo_epi16(halves, _mm_setzero_si128());
+
+            Vector128 value = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7FFF)), 13));
+            value = _mm_mul_ps(value, _mm_castsi128_ps(Set1Integer(F16ToF32Magic)));
+
+            const Vector128 infinityOrNan = _mm_cmpge_ps(value, _mm_castsi128_ps(Set1Integer(F16Overflow)));
+            value = _mm_or_ps(value, _mm_and_ps(infinityOrNan, _mm_castsi128_ps(Set1Integer(F32Infinity))));
+
+            const __m128i sign = _mm_slli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x8000)), 16);
+            return _mm_or_ps(value, _mm_castsi128_ps(sign));
+#endif
+        }
+
+        /**
+         * @brief Lane wise ToSnorm16 as 32 bit integers
+         */
+        SSSENGINE_FORCE_INLINE __m128i ToSnorm16x4(Vector128 value)
+        {
+            const Vector128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1)), _mm_set1_ps(1));
+            return _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(32767)));
+        }
+
+        /**
+         * @brief Lane wise ToUnorm8 as 32 bit integers
+         */
+        SSSENGINE_FORCE_INLINE __m128i ToUnorm8x4(Vector128 value)
+        {
+            const Vector128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1));
+            return _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(255)));
+        }
+
+        /**
+         * @brief Lane wise EncodeOctahedral
+         *
+         * @return The 4 encoded normals, x and y interleaved
+         */
+        SSSENGINE_FORCE_INLINE __m128i EncodeOctahedral4(Vector128 x, Vector128 y, Vector128 z)
+        {
+            const Vector128 signBit = _mm_set1_ps(-0.0f);
+            const Vector128 one = _mm_set1_ps(1);
+            auto absolute = [signBit](Vector128 value) { return _mm_andnot_ps(signBit, value); };
+            auto signOne = [signBit, one](Vector128 value) { return _mm_or_ps(one, _mm_and_ps(value, signBit)); };
+
+            const Vector128 inverseLength =
+                _mm_div_ps(one, _mm_add_ps(_mm_add_ps(absolute(x), absolute(y)), absolute(z)));
+            x = _mm_mul_ps(x, inverseLength);
+            y = _mm_mul_ps(y, inverseLength);
+
+            const Vector128 lowerHemisphere = _mm_cmplt_ps(z, _mm_setzero_ps());
+            const Vector128 foldedX = _mm_mul_ps(_mm_sub_ps(one, absolute(y)), signOne(x));
+            const Vector128 foldedY = _mm_mul_ps(_mm_sub_ps(one, absolute(x)), signOne(y));
+            x = Select(lowerHemisphere, foldedX, x);
+            y = Select(lowerHemisphere, foldedY, y);
+
+            // NOTE: x0 x1 x2 x3 y0 y1 y2 y3 interleaved into x0 y0 x1 y1...
+            const __m128i packed = _mm_packs_epi32(ToSnorm16x4(x), ToSnorm16x4(y));
+            return _mm_unpacklo_epi16(packed, _mm_srli_si128(packed, 8));
+        }
+
+        // NOTE: Like the other batches the remainder goes through the SIMD path with padding so every element gets the
+        // same result no matter where it is
+
+        SSSENGINE_FORCE_INLINE void ConvertToHalfBatch(const f32 *values, Half *result, size count)
+        {
+            size i = 0;
+#ifdef SSSENGINE_SIMD_F16C
+            for(; i + 8 <= count; i += 8)
+            {
+                const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(&values[i]), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&result[i]), halves);
+            }
+#endif
+            for(; i + 4 <= count; i += 4)
+            {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(&result[i]), ToHalf4(_mm_loadu_ps(&values[i])));
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[4]{};
+                Half paddedResult[4];
+                CopyElements(&values[i], padded, remainder);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(paddedResult), ToHalf4(_mm_loadu_ps(padded)));
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        SSSENGINE_FORCE_INLINE void ConvertFromHalfBatch(const Half *halves, f32 *result, size count)
+        {
+            size i = 0;
+#ifdef SSSENGINE_SIMD_F16C
+            for(; i + 8 <= count; i += 8)
+            {
+                const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&halves[i]));
+                _mm256_storeu_ps(&result[i], _mm256_cvtph_ps(packed));
+            }
+#endif
+            for(; i + 4 <= count; i += 4)
+            {
+                _mm_storeu_ps(&result[i], FromHalf4(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&halves[i]))));
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                Half padded[4]{};
+                f32 paddedResult[4];
+                CopyElements(&halves[i], padded, remainder);
+                _mm_storeu_ps(paddedResult, FromHalf4(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(padded))));
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        SSSENGINE_FORCE_INLINE void ConvertToSnorm16Batch(const f32 *values, Snorm16 *result, size count)
+        {
+            size i = 0;
+            for(; i + 8 <= count; i += 8)
+            {
+                const __m128i packed =
+                    _mm_packs_epi32(ToSnorm16x4(_mm_loadu_ps(&values[i])), ToSnorm16x4(_mm_loadu_ps(&values[i + 4])));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&result[i]), packed);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[8]{};
+                Snorm16 paddedResult[8];
+                CopyElements(&values[i], padded, remainder);
+                const __m128i packed =
+                    _mm_packs_epi32(ToSnorm16x4(_mm_loadu_ps(padded)), ToSnorm16x4(_mm_loadu_ps(&padded[4])));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(paddedResult), packed);
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        SSSENGINE_FORCE_INLINE __m128i ToUnorm8x16(const f32 *values)
+        {
+            const __m128i low = _mm_packs_epi32(ToUnorm8x4(_mm_loadu_ps(values)), ToUnorm8x4(_mm_loadu_ps(&values[4])));
+            const __m128i high =
+                _mm_packs_epi32(ToUnorm8x4(_mm_loadu_ps(&values[8])), ToUnorm8x4(_mm_loadu_ps(&values[12])));
+            return _mm_packus_epi16(low, high);
+        }
+
+        SSSENGINE_FORCE_INLINE void ConvertToUnorm8Batch(const f32 *values, u8 *result, size count)
+        {
+            size i = 0;
+            for(; i + 16 <= count; i += 16)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&result[i]), ToUnorm8x16(&values[i]));
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                f32 padded[16]{};
+                u8 paddedResult[16];
+                CopyElements(&values[i], padded, remainder);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(paddedResult), ToUnorm8x16(padded));
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        /**
+         * @brief FromUnorm8 on 16 values
+         */
+        SSSENGINE_FORCE_INLINE void FromUnorm8x16(const u8 *values, f32 *result)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values));
+            const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+            // NOTE: Divides instead of multiplying by the inverse so the result is the same as the scalar version
+            const Vector128 maximum = _mm_set1_ps(255);
+            _mm_storeu_ps(result, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), maximum));
+            _mm_storeu_ps(&result[4], _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), maximum));
+            _mm_storeu_ps(&result[8], _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), maximum));
+            _mm_storeu_ps(&result[12], _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), maximum));
+        }
+
+        SSSENGINE_FORCE_INLINE void ConvertFromUnorm8Batch(const u8 *values, f32 *result, size count)
+        {
+            size i = 0;
+            for(; i + 16 <= count; i += 16)
+            {
+                FromUnorm8x16(&values[i], &result[i]);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                u8 padded[16]{};
+                f32 paddedResult[16];
+                CopyElements(&values[i], padded, remainder);
+                FromUnorm8x16(padded, paddedResult);
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+
+        SSSENGINE_FORCE_INLINE void EncodeOctahedralBatch(const Float3 *normals, OctahedralNormal *result, size count)
+        {
+            auto encode = [](const Float3 *input, OctahedralNormal *output)
+            {
+                const f32 *in = &input->X;
+                Vector128 x, y, z;
+                Transpose3x4(_mm_loadu_ps(in), _mm_loadu_ps(&in[4]), _mm_loadu_ps(&in[8]), x, y, z);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output), EncodeOctahedral4(x, y, z));
+            };
+
+            size i = 0;
+            for(; i + 4 <= count; i += 4)
+            {
+                encode(&normals[i], &result[i]);
+            }
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                // NOTE: Padded with a valid normal so the padding lanes do not divide by 0
+                Float3 padded[4]{{0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}};
+                OctahedralNormal paddedResult[4];
+                CopyElements(&normals[i], padded, remainder);
+                encode(padded, paddedResult);
+                CopyElements(paddedResult, &result[i], remainder);
+            }
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+
+    /**
+     * @brief ToHalf on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertToHalf(std::span<const f32> values, std::span<Half> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertToHalf(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief FromHalf on every half
+     *
+     * @param result Must be able to hold every half
+     */
+    SSSENGINE_GLOBAL void ConvertFromHalf(std::span<const Half> halves, std::span<f32> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= halves.size());
+
+        Kernels::ConvertFromHalf(halves.data(), result.data(), halves.size());
+    }
+
+    /**
+     * @brief ToSnorm16 on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertToSnorm16(std::span<const f32> values, std::span<Snorm16> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertToSnorm16(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief ToUnorm8 on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertToUnorm8(std::span<const f32> values, std::span<u8> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertToUnorm8(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief FromUnorm8 on every value
+     *
+     * @param result Must be able to hold every value
+     */
+    SSSENGINE_GLOBAL void ConvertFromUnorm8(std::span<const u8> values, std::span<f32> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= values.size());
+
+        Kernels::ConvertFromUnorm8(values.data(), result.data(), values.size());
+    }
+
+    /**
+     * @brief EncodeOctahedral on every normal
+     *
+     * @param normals Must all be unit vectors
+     * @param result Must be able to hold every normal
+     */
+    SSSENGINE_GLOBAL void EncodeOctahedral(std::span<const Float3> normals, std::span<OctahedralNormal> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= normals.size());
+
+        Kernels::EncodeOctahedral(normals.data(), result.data(), normals.size());
+    }
+} // namespace SSSEngine::Math
@@ -0,0 +1,606 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Quaternions to represent rotations and their batched operations
+ * Follows the same row vector convention as the matrices: combining rotations a then b is a * b, just like their
+ * matrices
+ */
+
+#pragma once
+
+#include <cmath>
+#include <span>
+#include "Attributes.h"
+#include "Concepts.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "MathKernels.h"
+#include "Matrix.h"
+#include "SimdOperations.h"
+#include "Types.h"
+#include "Vector.h"
+
+namespace SSSEngine::Math
+{
+    /**
+     * @brief A quaternion. Rotations are represented by unit quaternions. The default is the identity rotation
+     *
+     * @tparam T A floating point type
+     */
+    template<SSSEngine::RealConcept T>
+    struct Quaternion
+    {
+        T X{0};
+        T Y{0};
+        T Z{0};
+        T W{1};
+
+        /**
+         * @brief Combines two rotations. The result rotates by lhs first and then by rhs
+         */
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator*(Quaternion<T> lhs, Quaternion<T> rhs)
+        {
+            // NOTE: Hamilton product rhs * lhs so the order matches the row vector matrices
+            return {
+                rhs.W * lhs.X + rhs.X * lhs.W + rhs.Y * lhs.Z - rhs.Z * lhs.Y,
+                rhs.W * lhs.Y - rhs.X * lhs.Z + rhs.Y * lhs.W + rhs.Z * lhs.X,
+                rhs.W * lhs.Z + rhs.X * lhs.Y - rhs.Y * lhs.X + rhs.Z * lhs.W,
+                rhs.W * lhs.W - rhs.X * lhs.X - rhs.Y * lhs.Y - rhs.Z * lhs.Z,
+            };
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator+(Quaternion<T> lhs, Quaternion<T> rhs)
+        {
+            return {lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z, lhs.W + rhs.W};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator-(Quaternion<T> lhs, Quaternion<T> rhs)
+        {
+            return {lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z, lhs.W - rhs.W};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator-(Quaternion<T> quaternion)
+        {
+            return {-quaternion.X, -quaternion.Y, -quaternion.Z, -quaternion.W};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator*(Quaternion<T> quaternion, T scalar)
+        {
+            return {quaternion.X * scalar, quaternion.Y * scalar, quaternion.Z * scalar, quaternion.W * scalar};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Quaternion<T> operator*(T scalar, Quaternion<T> quaternion)
+        {
+            return quaternion * scalar;
+        }
+
+        friend SSSENGINE_GLOBAL constexpr bool operator==(Quaternion<T> lhs, Quaternion<T> rhs)
+        {
+            return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z && lhs.W == rhs.W;
+        }
+    };
+
+    using Quaternionf = Quaternion<f32>;
+
+    SSSENGINE_STATIC_ASSERT(sizeof(Quaternionf) == 4 * sizeof(f32), "Quaternionf must be tightly packed for batches")
+
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr T Dot(Quaternion<T> lhs, Quaternion<T> rhs)
+    {
+        return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z + lhs.W * rhs.W;
+    }
+
+    /**
+     * @brief The conjugate. For unit quaternions it is the inverse rotation
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Quaternion<T> Conjugate(Quaternion<T> quaternion)
+    {
+        return {-quaternion.X, -quaternion.Y, -quaternion.Z, quaternion.W};
+    }
+
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Quaternion<T> Normalize(Quaternion<T> quaternion)
+    {
+        const T length = std::sqrt(Dot(quaternion, quaternion));
+        SSSENGINE_ASSERT(length > 0);
+
+        return quaternion * (T{1} / length);
+    }
+
+    /**
+     * @brief Creates a rotation around an axis
+     *
+     * @param axis A normalized axis
+     * @param angle The angle in radians
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Quaternion<T> QuaternionFromAxisAngle(Vector3<T> axis, T angle)
+    {
+        const T halfAngle = angle * T{0.5};
+        const T sine = std::sin(halfAngle);
+
+        return {axis.X * sine, axis.Y * sine, axis.Z * sine, std::cos(halfAngle)};
+    }
+
+    /**
+     * @brief Creates a rotation from euler angles. Applies roll (Z) first, then pitch (X) and then yaw (Y)
+     *
+     * @param pitchYawRoll The angles in radians around X, Y and Z respectively
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Quaternion<T> QuaternionFromEuler(Vector3<T> pitchYawRoll)
+    {
+        const T sp = std::sin(pitchYawRoll.X * T{0.5});
+        const T cp = std::cos(pitchYawRoll.X * T{0.5});
+        const T sy = std::sin(pitchYawRoll.Y * T{0.5});
+        const T cy = std::cos(pitchYawRoll.Y * T{0.5});
+        const T sr = std::sin(pitchYawRoll.Z * T{0.5});
+        const T cr = std::cos(pitchYawRoll.Z * T{0.5});
+
+        return {
+            cr * sp * cy + sr * cp * sy,
+            cr * cp * sy - sr * sp * cy,
+            sr * cp * cy - cr * sp * sy,
+            cr * cp * cy + sr * sp * sy,
+        };
+    }
+
+    /**
+     * @brief Rotates a vector. Same as multiplying the row vector by the rotation matrix
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Vector3<T> Rotate(Vector3<T> vector, Quaternion<T> rotation)
+    {
+        // NOTE: v' = v + 2w(q x v) + 2q x (q x v)
+        const Vector3<T> q{rotation.X, rotation.Y, rotation.Z};
+        auto cross = [](Vector3<T> a, Vector3<T> b) -> Vector3<T>
+        { return {a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X}; };
+
+        const Vector3<T> t = cross(q, vector) * T{2};
+
+        return vector + t * rotation.W + cross(q, t);
+    }
+
+    /**
+     * @brief Normalized linear interpolation. Cheaper than Slerp but the angular velocity is not constant
+     *
+     * @param from The rotation at t = 0
+     * @param to The rotation at t = 1
+     * @param t The interpolation factor between 0 and 1
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Quaternion<T> Nlerp(Quaternion<T> from, Quaternion<T> to, T t)
+    {
+        // NOTE: q and -q are the same rotation. Take the shortest path
+        if(Dot(from, to) < 0)
+        {
+            to = -to;
+        }
+
+        return Normalize(from + (to - from) * t);
+    }
+
+    /**
+     * @brief Spherical linear interpolation. Interpolates with constant angular velocity along the shortest path
+     *
+     * @param from The rotation at t = 0
+     * @param to The rotation at t = 1
+     * @param t The interpolation factor between 0 and 1
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Quaternion<T> Slerp(Quaternion<T> from, Quaternion<T> to, T t)
+    {
+        T cosine = Dot(from, to);
+        if(cosine < 0)
+        {
+            to = -to;
+            cosine = -cosine;
+        }
+
+        // NOTE: Too close to divide by the sine, linear interpolation is accurate enough
+        if(cosine > T{0.9995})
+        {
+            return Normalize(from + (to - from) * t);
+        }
+
+        const T angle = std::acos(cosine);
+        const T sine = std::sin(angle);
+
+        return from * (std::sin((1 - t) * angle) / sine) + to * (std::sin(t * angle) / sine);
+    }
+
+    /**
+     * @brief The rotation matrix for the row vector convention (v * M)
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Matrix<T, 4, 4> ToMatrix(Quaternion<T> q)
+    {
+        const T xx = q.X * q.X, yy = q.Y * q.Y, zz = q.Z * q.Z;
+        const T xy = q.X * q.Y, xz = q.X * q.Z, yz = q.Y * q.Z;
+        const T wx = q.W * q.X, wy = q.W * q.Y, wz = q.W * q.Z;
+
+        return {
+            1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy), 0,
+            2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx), 0,
+            2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy), 0,
+            0, 0, 0, 1,
+        };
+    }
+
+    /**
+     * @brief Builds the matrix of a transform that scales, then rotates and then translates (S * R * T)
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL constexpr Matrix<T, 4, 4> ComposeTransform(Vector3<T> position, Quaternion<T> rotation,
+                                                                 Vector3<T> scale)
+    {
+        Matrix<T, 4, 4> result = ToMatrix(rotation);
+        for(MatrixSize i = 0; i < 3; ++i)
+        {
+            result.data[i] *= scale.X;
+            result.data[4 + i] *= scale.Y;
+            result.data[8 + i] *= scale.Z;
+        }
+        result.data[12] = position.X;
+        result.data[13] = position.Y;
+        result.data[14] = position.Z;
+
+        return result;
+    }
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        /**
+         * @brief Quaternions in structure of arrays form, one register per component
+         */
+        template<typename Register>
+        struct QuaternionLanes
+        {
+            Register X, Y, Z, W;
+        };
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE QuaternionLanes<Register> LoadQuaternions(const Quaternionf *quaternions)
+        {
+            QuaternionLanes<Register> result;
+            LoadTransposed4(&quaternions->X, result.X, result.Y, result.Z, result.W);
+
+            return result;
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE void StoreQuaternions(Quaternionf *quaternions, const QuaternionLanes<Register> &lanes)
+        {
+            StoreTransposed4(&quaternions->X, lanes.X, lanes.Y, lanes.Z, lanes.W);
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register Dot(const QuaternionLanes<Register> &lhs, const QuaternionLanes<Register> &rhs)
+        {
+            return MulAdd(lhs.X, rhs.X, MulAdd(lhs.Y, rhs.Y, MulAdd(lhs.Z, rhs.Z, Mul(lhs.W, rhs.W))));
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE QuaternionLanes<Register> Scale(const QuaternionLanes<Register> &q, Register scale)
+        {
+            return {Mul(q.X, scale), Mul(q.Y, scale), Mul(q.Z, scale), Mul(q.W, scale)};
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE QuaternionLanes<Register> Normalize(const QuaternionLanes<Register> &q)
+        {
+            return Scale(q, Div(Set1<Register>(1), Sqrt(Dot(q, q))));
+        }
+
+        /**
+         * @brief Flips the sign of to on every lane where the dot product is negative so interpolation takes the
+         * shortest path
+         *
+         * @return The absolute value of the dot product
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register ShortestPath(const QuaternionLanes<Register> &from,
+                                                     QuaternionLanes<Register> &to)
+        {
+            const Register dot = Dot(from, to);
+            const Register sign = And(dot, Set1<Register>(-0.0f));
+            to = {Xor(to.X, sign), Xor(to.Y, sign), Xor(to.Z, sign), Xor(to.W, sign)};
+
+            return Xor(dot, sign);
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE QuaternionLanes<Register>
+        Nlerp(const QuaternionLanes<Register> &from, QuaternionLanes<Register> to, Register t)
+        {
+            ShortestPath(from, to);
+
+            return Normalize(QuaternionLanes<Register>{
+                MulAdd(Sub(to.X, from.X), t, from.X),
+                MulAdd(Sub(to.Y, from.Y), t, from.Y),
+                MulAdd(Sub(to.Z, from.Z), t, from.Z),
+                MulAdd(Sub(to.W, from.W), t, from.W),
+            });
+        }
+
+        /**
+         * @brief Approximates sin(t * angle) / sin(angle) for cos(angle) in [0, 1] without any trigonometric function
+         * See Eberly, "A Fast and Accurate Algorithm for Computing SLERP". The maximum absolute error is 2e-5
+         *
+         * @param cosineMinusOne cos(angle) - 1
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register SlerpCoefficient(Register t, Register cosineMinusOne)
+        {
+            constexpr int Terms = 8;
+            // NOTE: Corrects the truncation error of the last term
+            constexpr f32 Mu = 1.85298109240830f;
+
+            const Register tSquared = Mul(t, t);
+            Register result = Set1<Register>(1);
+            for(int i = Terms; i >= 1; --i)
+            {
+                const auto n = static_cast<f32>(i);
+                const f32 scale = i == Terms ? Mu : 1.0f;
+                const Register u = Set1<Register>(scale / (n * (2 * n + 1)));
+                const Register v = Set1<Register>(scale * n / (2 * n + 1));
+
+                const Register b = Mul(Sub(Mul(u, tSquared), v), cosineMinusOne);
+                result = MulAdd(b, result, Set1<Register>(1));
+            }
+
+            return Mul(t, result);
+        }
+
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE QuaternionLanes<Register>
+        Slerp(const QuaternionLanes<Register> &from, QuaternionLanes<Register> to, Register t)
+        {
+            const Register one = Set1<Register>(1);
+            const Register cosineMinusOne = Sub(ShortestPath(from, to), one);
+
+            const Register toScale = SlerpCoefficient(t, cosineMinusOne);
+            const Register fromScale = SlerpCoefficient(Sub(one, t), cosineMinusOne);
+
+            return {
+                MulAdd(from.X, fromScale, Mul(to.X, toScale)),
+                MulAdd(from.Y, fromScale, Mul(to.Y, toScale)),
+                MulAdd(from.Z, fromScale, Mul(to.Z, toScale)),
+                MulAdd(from.W, fromScale, Mul(to.W, toScale)),
+            };
+        }
+
+        /**
+         * @brief Builds LaneCount S * R * T matrices
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE void ComposeTransforms(const Float3 *positions, const Quaternionf *rotations,
+                                                      const Float3 *scales, Mat4x4f *result)
+        {
+            constexpr size Lanes = LaneCount<Register>;
+
+            const QuaternionLanes<Register> q = LoadQuaternions<Register>(rotations);
+
+            alignas(32) f32 scaleX[Lanes], scaleY[Lanes], scaleZ[Lanes];
+            for(size i = 0; i < Lanes; ++i)
+            {
+                scaleX[i] = scales[i].X;
+                scaleY[i] = scales[i].Y;
+                scaleZ[i] = scales[i].Z;
+            }
+
+            const Register two = Set1<Register>(2);
+            const Register one = Set1<Register>(1);
+            const Register x2 = Mul(q.X, two), y2 = Mul(q.Y, two), z2 = Mul(q.Z, two);
+            const Register xx = Mul(q.X, x2), yy = Mul(q.Y, y2), zz = Mul(q.Z, z2);
+            const Register xy = Mul(q.X, y2), xz = Mul(q.X, z2), yz = Mul(q.Y, z2);
+            const Register wx = Mul(q.W, x2), wy = Mul(q.W, y2), wz = Mul(q.W, z2);
+
+            const Register sx = Load<Register>(scaleX);
+            const Register sy = Load<Register>(scaleY);
+            const Register sz = Load<Register>(scaleZ);
+            const Register zero = Set1<Register>(0);
+
+            // NOTE: Each row is built in structure of arrays form and transposed into LaneCount rows of 4 floats
+            Register rows[3][4] = {
+                {Mul(Sub(one, Add(yy, zz)), sx), Mul(Add(xy, wz), sx), Mul(Sub(xz, wy), sx), zero},
+                {Mul(Sub(xy, wz), sy), Mul(Sub(one, Add(xx, zz)), sy), Mul(Add(yz, wx), sy), zero},
+                {Mul(Add(xz, wy), sz), Mul(Sub(yz, wx), sz), Mul(Sub(one, Add(xx, yy)), sz), zero},
+            };
+
+            alignas(32) f32 transposed[3][Lanes * 4];
+            for(size row = 0; row < 3; ++row)
+            {
+                StoreTransposed4(transposed[row], rows[row][0], rows[row][1], rows[row][2], rows[row][3]);
+            }
+
+            for(size i = 0; i < Lanes; ++i)
+            {
+                f32 *m = result[i].data;
+                for(size row = 0; row < 3; ++row)
+                {
+                    for(size column = 0; column < 4; ++column)
+                    {
+                        m[row * 4 + column] = transposed[row][i * 4 + column];
+                    }
+                }
+                m[12] = positions[i].X;
+                m[13] = positions[i].Y;
+                m[14] = positions[i].Z;
+                m[15] = 1;
+            }
+        }
+
+        // NOTE: The remainder of every batch goes through the 4 wide kernel with padding instead of the scalar
+        // functions so an element gets exactly the same result no matter where it is in the batch
+
+        SSSENGINE_FORCE_INLINE void NormalizeBatch(const Quaternionf *quaternions, Quaternionf *result, size count)
+        {
+            const size i = ForEachLanes(
+                count,
+                [&]<typename Register>(size index)
+                { StoreQuaternions(&result[index], Normalize(LoadQuaternions<Register>(&quaternions[index]))); });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                Quaternionf padded[4]{};
+                CopyElements(&quaternions[i], padded, remainder);
+                StoreQuaternions(padded, Normalize(LoadQuaternions<Vector128>(padded)));
+                CopyElements(padded, &result[i], remainder);
+            }
+        }
+
+        template<bool Spherical>
+        SSSENGINE_FORCE_INLINE void InterpolateBatch(const Quaternionf *from, const Quaternionf *to, const f32 *t,
+                                                     Quaternionf *result, size count)
+        {
+            auto interpolate = [&]<typename Register>(const Quaternionf *lhs, const Quaternionf *rhs, const f32 *factor,
+                                                      Quaternionf *output)
+            {
+                if constexpr(Spherical)
+                {
+                    StoreQuaternions(output,
+                                     Slerp(LoadQuaternions<Register>(lhs),
+                                           LoadQuaternions<Register>(rhs),
+                                           Load<Register>(factor)));
+                }
+                else
+                {
+                    StoreQuaternions(output,
+                                     Nlerp(LoadQuaternions<Register>(lhs),
+                                           LoadQuaternions<Register>(rhs),
+                                           Load<Register>(factor)));
+                }
+            };
+
+            const size i = ForEachLanes(count,
+                                        [&]<typename Register>(size index) {
+                                            interpolate.template operator()<Register>(
+                                                &from[index], &to[index], &t[index], &result[index]);
+                                        });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                Quaternionf paddedFrom[4]{};
+                Quaternionf paddedTo[4]{};
+                f32 paddedT[4]{};
+                CopyElements(&from[i], paddedFrom, remainder);
+                CopyElements(&to[i], paddedTo, remainder);
+                CopyElements(&t[i], paddedT, remainder);
+
+                Quaternionf padded[4];
+                interpolate.template operator()<Vector128>(paddedFrom, paddedTo, paddedT, padded);
+                CopyElements(padded, &result[i], remainder);
+            }
+        }
+
+        SSSENGINE_FORCE_INLINE void ComposeTransformsBatch(const Float3 *positions, const Quaternionf *rotations,
+                                                           const Float3 *scales, Mat4x4f *result, size count)
+        {
+            const size i = ForEachLanes(
+                count,
+                [&]<typename Register>(size index)
+                { ComposeTransforms<Register>(&positions[index], &rotations[index], &scales[index], &result[index]); });
+
+            if(const size remainder = count - i; remainder > 0)
+            {
+                Float3 paddedPositions[4]{};
+                Quaternionf paddedRotations[4]{};
+                Float3 paddedScales[4]{};
+                CopyElements(&positions[i], paddedPositions, remainder);
+                CopyElements(&rotations[i], paddedRotations, remainder);
+                CopyElements(&scales[i], paddedScales, remainder);
+
+                Mat4x4f padded[4];
+                ComposeTransforms<Vector128>(paddedPositions, paddedRotations, paddedScales, padded);
+                CopyElements(padded, &result[i], remainder);
+            }
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+
+    /**
+     * @brief Normalizes every quaternion
+     *
+     * @param quaternions The quaternions to normalize. None can have a length of 0
+     * @param result Where to write the result. Can be the same as quaternions
+     */
+    SSSENGINE_GLOBAL void NormalizeQuaternions(std::span<const Quaternionf> quaternions,
+                                               std::span<Quaternionf> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= quaternions.size());
+
+        Kernels::NormalizeQuaternions(quaternions.data(), result.data(), quaternions.size());
+    }
+
+    /**
+     * @brief Normalized linear interpolation of every pair of quaternions. @see Nlerp
+     *
+     * @param from The rotations at t = 0
+     * @param to The rotations at t = 1. Must have the same size as from
+     * @param t The interpolation factor of each pair. Must have the same size as from
+     * @param result Where to write the interpolated rotations. Can be the same as from or to
+     */
+    SSSENGINE_GLOBAL void Nlerp(std::span<const Quaternionf> from, std::span<const Quaternionf> to,
+                                std::span<const f32> t, std::span<Quaternionf> result)
+    {
+        SSSENGINE_ASSERT(to.size() == from.size() && t.size() == from.size());
+        SSSENGINE_ASSERT(result.size() >= from.size());
+
+        Kernels::Nlerp(from.data(), to.data(), t.data(), result.data(), from.size());
+    }
+
+    /**
+     * @brief Spherical linear interpolation of every pair of unit quaternions. @see Slerp
+     * Uses a polynomial approximation instead of trigonometric functions so the results differ from the scalar Slerp
+     * by at most 2e-5 per component
+     *
+     * @param from The rotations at t = 0
+     * @param to The rotations at t = 1. Must have the same size as from
+     * @param t The interpolation factor of each pair. Must have the same size as from
+     * @param result Where to write the interpolated rotations. Can be the same as from or to
+     */
+    SSSENGINE_GLOBAL void Slerp(std::span<const Quaternionf> from, std::span<const Quaternionf> to,
+                                std::span<const f32> t, std::span<Quaternionf> result)
+    {
+        SSSENGINE_ASSERT(to.size() == from.size() && t.size() == from.size());
+        SSSENGINE_ASSERT(result.size() >= from.size());
+
+        Kernels::Slerp(from.data(), to.data(), t.data(), result.data(), from.size());
+    }
+
+    /**
+     * @brief Builds the matrix of every transform. @see ComposeTransform
+     *
+     * @param positions The translation of each transform
+     * @param rotations The rotation of each transform. Must have the same size as positions
+     * @param scales The scale of each transform. Must have the same size as positions
+     * @param result Where to write the matrices
+     */
+    SSSENGINE_GLOBAL void ComposeTransforms(std::span<const Float3> positions, std::span<const Quaternionf> rotations,
+                                            std::span<const Float3> scales, std::span<Mat4x4f> result)
+    {
+        SSSENGINE_ASSERT(rotations.size() == positions.size() && scales.size() == positions.size());
+        SSSENGINE_ASSERT(result.size() >= positions.size());
+
+        Kernels::ComposeTransforms(positions.data(), rotations.data(), scales.data(), result.data(), positions.size());
+    }
+} // namespace SSSEngine::Math
@@ -0,0 +1,513 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Thin overloads over the SSE and AVX intrinsics so batch kernels can be written once as templates over the
+ * register type and instantiated for 4 (Vector128) or 8 (Vector256) lanes
+ */
+
+#pragma once
+
+#include "Attributes.h"
+#include "Intrinsics.h"
+#include "Types.h"
+
+namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
+{
+    // NOTE: Derived from the size instead of specialized per register. Naming __m128 or __m256 as an explicit template
+    // argument makes GCC warn that their alignment attributes are dropped
+    template<typename Register>
+    inline constexpr size LaneCount = sizeof(Register) / sizeof(f32);
+
+    template<typename Register>
+    Register Set1(f32 value);
+
+    template<typename Register>
+    Register Load(const f32 *address);
+
+    template<>
+    SSSENGINE_FORCE_INLINE Vector128 Set1<Vector128>(f32 value)
+    {
+        return _mm_set1_ps(value);
+    }
+
+    template<>
+    SSSENGINE_FORCE_INLINE Vector128 Load<Vector128>(const f32 *address)
+    {
+        return _mm_loadu_ps(address);
+    }
+
+    SSSENGINE_FORCE_INLINE void Store(f32 *address, Vector128 value)
+    {
+        _mm_storeu_ps(address, value);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Add(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_add_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Sub(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_sub_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Mul(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_mul_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Div(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_div_ps(lhs, rhs);
+    }
+
+    /**
+     * @brief a * b + c. Fused when the build targets FMA
+     */
+    SSSENGINE_FORCE_INLINE Vector128 MulAdd(Vector128 a, Vector128 b, Vector128 c)
+    {
+#ifdef SSSENGINE_SIMD_FMA
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Sqrt(Vector128 value)
+    {
+        return _mm_sqrt_ps(value);
+    }
+
+    /**
+     * @brief Approximation of 1 / sqrt(value) with a relative error of at most 1.5 * 2^-12
+     */
+    SSSENGINE_FORCE_INLINE Vector128 ReciprocalSqrtEstimate(Vector128 value)
+    {
+        return _mm_rsqrt_ps(value);
+    }
+
+    /**
+     * @brief 2^exponent. Every lane of exponent must be an integer in [-126, 127]
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Exp2Integer(Vector128 exponent)
+    {
+        const __m128i biased = _mm_add_epi32(_mm_cvtps_epi32(exponent), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(biased, 23));
+    }
+
+    /**
+     * @brief Rounds to the nearest integer, ties to even. Every lane must be below 2^22 in magnitude
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Round(Vector128 value)
+    {
+#ifdef SSSENGINE_SIMD_SSE41
+        return _mm_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        // NOTE: Adding 1.5 * 2^23 leaves no bits for the fraction so the FPU rounds it away
+        const Vector128 magic = _mm_set1_ps(12582912.0f);
+        return _mm_sub_ps(_mm_add_ps(value, magic), magic);
+#endif
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Min(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_min_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Max(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_max_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 And(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_and_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Or(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_or_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 Xor(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_xor_ps(lhs, rhs);
+    }
+
+    /**
+     * @brief ~lhs & rhs
+     */
+    SSSENGINE_FORCE_INLINE Vector128 AndNot(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_andnot_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 CompareLess(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_cmplt_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 CompareGreater(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_cmpgt_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 CompareEqual(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_cmpeq_ps(lhs, rhs);
+    }
+
+    /**
+     * @brief Converts the bits of every lane, read as a signed integer, to float
+     */
+    SSSENGINE_FORCE_INLINE Vector128 ConvertBitsToFloat(Vector128 value)
+    {
+        return _mm_cvtepi32_ps(_mm_castps_si128(value));
+    }
+
+    /**
+     * @brief Picks onTrue on lanes where every bit of mask is set and onFalse otherwise
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Select(Vector128 mask, Vector128 onTrue, Vector128 onFalse)
+    {
+#ifdef SSSENGINE_SIMD_SSE41
+        return _mm_blendv_ps(onFalse, onTrue, mask);
+#else
+        return _mm_or_ps(_mm_and_ps(mask, onTrue), _mm_andnot_ps(mask, onFalse));
+#endif
+    }
+
+    /**
+     * @brief A bit per lane set when the sign bit of the lane is set
+     */
+    SSSENGINE_FORCE_INLINE u32 MoveMask(Vector128 value)
+    {
+        return static_cast<u32>(_mm_movemask_ps(value));
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 UnpackLow(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_unpacklo_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector128 UnpackHigh(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_unpackhi_ps(lhs, rhs);
+    }
+
+    template<int Mask>
+    SSSENGINE_FORCE_INLINE Vector128 Shuffle(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_shuffle_ps(lhs, rhs, Mask);
+    }
+
+#ifdef SSSENGINE_SIMD_AVX
+    template<>
+    SSSENGINE_FORCE_INLINE Vector256 Set1<Vector256>(f32 value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    template<>
+    SSSENGINE_FORCE_INLINE Vector256 Load<Vector256>(const f32 *address)
+    {
+        return _mm256_loadu_ps(address);
+    }
+
+    SSSENGINE_FORCE_INLINE void Store(f32 *address, Vector256 value)
+    {
+        _mm256_storeu_ps(address, value);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Add(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_add_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Sub(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_sub_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Mul(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_mul_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Div(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_div_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 MulAdd(Vector256 a, Vector256 b, Vector256 c)
+    {
+    #ifdef SSSENGINE_SIMD_FMA
+        return _mm256_fmadd_ps(a, b, c);
+    #else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+    #endif
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Sqrt(Vector256 value)
+    {
+        return _mm256_sqrt_ps(value);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 ReciprocalSqrtEstimate(Vector256 value)
+    {
+        return _mm256_rsqrt_ps(value);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Exp2Integer(Vector256 exponent)
+    {
+    #ifdef SSSENGINE_SIMD_AVX2
+        const __m256i biased = _mm256_add_epi32(_mm256_cvtps_epi32(exponent), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(biased, 23));
+    #else
+        // NOTE: AVX has no 256 bit integer instructions
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(Exp2Integer(_mm256_castps256_ps128(exponent))),
+                                    Exp2Integer(_mm256_extractf128_ps(exponent, 1)),
+                                    1);
+    #endif
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Round(Vector256 value)
+    {
+        return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Min(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_min_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Max(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_max_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 And(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_and_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Or(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_or_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Xor(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_xor_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 AndNot(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_andnot_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 CompareLess(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 CompareGreater(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 CompareEqual(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 ConvertBitsToFloat(Vector256 value)
+    {
+        return _mm256_cvtepi32_ps(_mm256_castps_si256(value));
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 Select(Vector256 mask, Vector256 onTrue, Vector256 onFalse)
+    {
+        return _mm256_blendv_ps(onFalse, onTrue, mask);
+    }
+
+    SSSENGINE_FORCE_INLINE u32 MoveMask(Vector256 value)
+    {
+        return static_cast<u32>(_mm256_movemask_ps(value));
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 UnpackLow(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_unpacklo_ps(lhs, rhs);
+    }
+
+    SSSENGINE_FORCE_INLINE Vector256 UnpackHigh(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_unpackhi_ps(lhs, rhs);
+    }
+
+    template<int Mask>
+    SSSENGINE_FORCE_INLINE Vector256 Shuffle(Vector256 lhs, Vector256 rhs)
+    {
+        return _mm256_shuffle_ps(lhs, rhs, Mask);
+    }
+#endif
+
+    /**
+     * @brief Transposes a 4x4 block inside each 128 bit lane. Turns 4 packed 4 component elements into 4 registers
+     * with one component each (and back since it is its own inverse)
+     */
+    template<typename Register>
+    SSSENGINE_FORCE_INLINE void Transpose4x4(Register &r0, Register &r1, Register &r2, Register &r3)
+    {
+        const Register t0 = UnpackLow(r0, r1);
+        const Register t1 = UnpackLow(r2, r3);
+        const Register t2 = UnpackHigh(r0, r1);
+        const Register t3 = UnpackHigh(r2, r3);
+
+        r0 = Shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+        r1 = Shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+        r2 = Shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+        r3 = Shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+    }
+
+    /**
+     * @brief Loads LaneCount elements of 4 floats each (like Float4 or Quaternion) and transposes them so each register
+     * holds one component of every element
+     *
+     * @param elements LaneCount consecutive elements of 4 floats
+     */
+    template<typename Register>
+    SSSENGINE_FORCE_INLINE void LoadTransposed4(const f32 *elements, Register &x, Register &y, Register &z, Register &w)
+    {
+        if constexpr(LaneCount<Register> == 4)
+        {
+            x = _mm_loadu_ps(elements);
+            y = _mm_loadu_ps(elements + 4);
+            z = _mm_loadu_ps(elements + 8);
+            w = _mm_loadu_ps(elements + 12);
+        }
+#ifdef SSSENGINE_SIMD_AVX
+        else
+        {
+            // NOTE: The low lane gets elements 0-3 and the high lane 4-7 so lane order matches element order
+            auto loadLanes = [](const f32 *low, const f32 *high)
+            { return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1); };
+            x = loadLanes(elements, elements + 16);
+            y = loadLanes(elements + 4, elements + 20);
+            z = loadLanes(elements + 8, elements + 24);
+            w = loadLanes(elements + 12, elements + 28);
+        }
+#endif
+        Transpose4x4(x, y, z, w);
+    }
+
+    /**
+     * @brief The inverse of LoadTransposed4
+     */
+    template<typename Register>
+    SSSENGINE_FORCE_INLINE void StoreTransposed4(f32 *elements, Register x, Register y, Register z, Register w)
+    {
+        Transpose4x4(x, y, z, w);
+        if constexpr(LaneCount<Register> == 4)
+        {
+            _mm_storeu_ps(elements, x);
+            _mm_storeu_ps(elements + 4, y);
+            _mm_storeu_ps(elements + 8, z);
+            _mm_storeu_ps(elements + 12, w);
+        }
+#ifdef SSSENGINE_SIMD_AVX
+        else
+        {
+            auto storeLanes = [](f32 *low, f32 *high, Vector256 value)
+            {
+                _mm_storeu_ps(low, _mm256_castps256_ps128(value));
+                _mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+            };
+            storeLanes(elements, elements + 16, x);
+            storeLanes(elements + 4, elements + 20, y);
+            storeLanes(elements + 8, elements + 24, z);
+            storeLanes(elements + 12, elements + 28, w);
+        }
+#endif
+    }
+
+    /**
+     * @brief Runs kernel over LaneCount elements at a time with the widest register the build targets
+     *
+     * @return The amount of elements processed. The remainder must be done by the caller
+     */
+    template<typename Kernel>
+    SSSENGINE_FORCE_INLINE size ForEachLanes(size count, Kernel &&kernel)
+    {
+        size i = 0;
+#ifdef SSSENGINE_SIMD_AVX
+        for(; i + 8 <= count; i += 8)
+        {
+            kernel.template operator()<Vector256>(i);
+        }
+#endif
+        for(; i + 4 <= count; i += 4)
+        {
+            kernel.template operator()<Vector128>(i);
+        }
+
+        return i;
+    }
+
+    template<typename T>
+    SSSENGINE_FORCE_INLINE void CopyElements(const T *source, T *destination, size count)
+    {
+        for(size i = 0; i < count; ++i)
+        {
+            destination[i] = source[i];
+        }
+    }
+
+    // NOTE: Scalar helpers for the kernels. Inline functions outside this namespace, like the std ones, are emitted by
+    // every kernel translation unit under the same symbol and the linker keeps any of them, so the kernels only call
+    // code from this namespace or builtins
+
+    template<typename To, typename From>
+    SSSENGINE_FORCE_INLINE constexpr To BitCast(const From &value) noexcept
+    {
+        return __builtin_bit_cast(To, value);
+    }
+
+    SSSENGINE_FORCE_INLINE f32 Abs(f32 value) noexcept
+    {
+        return BitCast<f32>(BitCast<u32>(value) & 0x7FFF'FFFFu);
+    }
+
+    /**
+     * @brief The index of the lowest set bit. mask must not be 0
+     */
+    SSSENGINE_FORCE_INLINE u32 CountTrailingZeros(u32 mask) noexcept
+    {
+#ifdef SSSENGINE_MSVC
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<u32>(index);
+#else
+        return static_cast<u32>(__builtin_ctz(mask));
+#endif
+    }
+} // namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
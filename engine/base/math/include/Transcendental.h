@@ -0,0 +1,419 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Fast approximations of sin, cos, atan2, exp, log, pow and 1 / sqrt with bounded error
+ * Every function has a scalar version and a SIMD version over Vector128 and Vector256 so whole batches (particles,
+ * bones, camera paths...) can be evaluated at once. The scalar and SIMD versions use the same approximations but can
+ * differ in the last bits since the SIMD versions use FMA when the build targets it.
+ * The error bounds documented are the ones measured by the tests over the documented domain.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <numbers>
+#include "Attributes.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "SimdOperations.h"
+#include "Types.h"
+
+namespace SSSEngine::Math
+{
+    namespace Detail
+    {
+        constexpr f32 TwoOverPi = 2 / std::numbers::pi_v<f32>;
+        // NOTE: pi / 2 split in three so quadrant * PiOver2High is exact (Cody-Waite reduction)
+        constexpr f32 PiOver2High = 1.5703125f;
+        constexpr f32 PiOver2Middle = 4.837512969970703125e-4f;
+        constexpr f32 PiOver2Low = 7.54978995489188216e-8f;
+
+        // NOTE: Minimax polynomials of sin and cos in [-pi / 4, pi / 4] (S. Moshier, Cephes)
+        constexpr f32 Sin0 = -1.9515295891e-4f;
+        constexpr f32 Sin1 = 8.3321608736e-3f;
+        constexpr f32 Sin2 = -1.6666654611e-1f;
+        constexpr f32 Cos0 = 2.443315711809948e-5f;
+        constexpr f32 Cos1 = -1.388731625493765e-3f;
+        constexpr f32 Cos2 = 4.166664568298827e-2f;
+
+        // NOTE: Minimax polynomial of atan in [-tan(pi / 8), tan(pi / 8)] (S. Moshier, Cephes)
+        constexpr f32 TanPiOver8 = 0.414213562373095f;
+        constexpr f32 Atan0 = 8.05374449538e-2f;
+        constexpr f32 Atan1 = -1.38776856032e-1f;
+        constexpr f32 Atan2 = 1.99777106478e-1f;
+        constexpr f32 Atan3 = -3.33329491539e-1f;
+
+        // NOTE: The range where exp and 2^n are normal floats
+        constexpr f32 ExpMinimum = -87.0f;
+        constexpr f32 ExpMaximum = 88.0f;
+        constexpr f32 Log2E = std::numbers::log2e_v<f32>;
+        // NOTE: ln(2) split in two so n * Ln2High is exact
+        constexpr f32 Ln2High = 0.693359375f;
+        constexpr f32 Ln2Low = -2.12194440e-4f;
+        // NOTE: Minimax polynomial of (exp(x) - 1 - x) / x^2 in [-ln(2) / 2, ln(2) / 2] (S. Moshier, Cephes)
+        constexpr f32 Exp0 = 1.9875691500e-4f;
+        constexpr f32 Exp1 = 1.3981999507e-3f;
+        constexpr f32 Exp2 = 8.3334519073e-3f;
+        constexpr f32 Exp3 = 4.1665795894e-2f;
+        constexpr f32 Exp4 = 1.6666665459e-1f;
+        constexpr f32 Exp5 = 5.0000001201e-1f;
+
+        constexpr f32 SqrtHalf = std::numbers::sqrt2_v<f32> / 2;
+        // NOTE: Minimax polynomial of (log(1 + x) - x + x^2 / 2) / x^3 in [sqrt(0.5) - 1, sqrt(2) - 1] (S. Moshier,
+        // Cephes)
+        constexpr f32 Log0 = 7.0376836292e-2f;
+        constexpr f32 Log1 = -1.1514610310e-1f;
+        constexpr f32 Log2 = 1.1676998740e-1f;
+        constexpr f32 Log3 = -1.2420140846e-1f;
+        constexpr f32 Log4 = 1.4249322787e-1f;
+        constexpr f32 Log5 = -1.6668057665e-1f;
+        constexpr f32 Log6 = 2.0000714765e-1f;
+        constexpr f32 Log7 = -2.4999993993e-1f;
+        constexpr f32 Log8 = 3.3333331174e-1f;
+        constexpr u32 F32ExponentMask = 0x7F80'0000u;
+        constexpr u32 F32MantissaMask = 0x007F'FFFFu;
+    } // namespace Detail
+
+    /**
+     * @brief Sine and cosine of angle with an absolute error below 2e-7 for |angle| <= 8192. Faster than calling
+     * FastSin and FastCos since the range reduction is shared
+     */
+    SSSENGINE_GLOBAL void FastSinCos(f32 angle, f32 &sine, f32 &cosine)
+    {
+        using namespace Detail;
+
+        const f32 quadrant = std::nearbyint(angle * TwoOverPi);
+        f32 r = angle - quadrant * PiOver2High;
+        r -= quadrant * PiOver2Middle;
+        r -= quadrant * PiOver2Low;
+
+        const f32 r2 = r * r;
+        const f32 s = ((Sin0 * r2 + Sin1) * r2 + Sin2) * r2 * r + r;
+        const f32 c = r2 * r2 * ((Cos0 * r2 + Cos1) * r2 + Cos2) - 0.5f * r2 + 1;
+
+        switch(static_cast<i32>(quadrant) & 3)
+        {
+            case 0:
+                sine = s;
+                cosine = c;
+                break;
+            case 1:
+                sine = c;
+                cosine = -s;
+                break;
+            case 2:
+                sine = -s;
+                cosine = -c;
+                break;
+            default:
+                sine = -c;
+                cosine = s;
+                break;
+        }
+    }
+
+    /**
+     * @brief Sine of angle with an absolute error below 2e-7 for |angle| <= 8192
+     */
+    SSSENGINE_GLOBAL f32 FastSin(f32 angle)
+    {
+        f32 sine, cosine;
+        FastSinCos(angle, sine, cosine);
+        return sine;
+    }
+
+    /**
+     * @brief Cosine of angle with an absolute error below 2e-7 for |angle| <= 8192
+     */
+    SSSENGINE_GLOBAL f32 FastCos(f32 angle)
+    {
+        f32 sine, cosine;
+        FastSinCos(angle, sine, cosine);
+        return cosine;
+    }
+
+    /**
+     * @brief Angle of (x, y) in [-pi, pi] with an absolute error below 5e-7. Both must be finite, atan2(0, 0) is 0 and
+     * x = -0 is treated as x = 0
+     */
+    SSSENGINE_GLOBAL f32 FastAtan2(f32 y, f32 x)
+    {
+        using namespace Detail;
+
+        const f32 absoluteY = std::abs(y);
+        const f32 absoluteX = std::abs(x);
+        const f32 minimum = std::fmin(absoluteX, absoluteY);
+        const f32 maximum = std::fmax(absoluteX, absoluteY);
+
+        // NOTE: atan(a) = pi / 4 + atan((a - 1) / (a + 1)) brings a in [tan(pi / 8), 1] into the polynomial range
+        const bool reduce = minimum > maximum * TanPiOver8;
+        const f32 numerator = reduce ? minimum - maximum : minimum;
+        const f32 denominator = reduce ? minimum + maximum : (maximum == 0 ? 1 : maximum);
+        const f32 t = numerator / denominator;
+        const f32 t2 = t * t;
+
+        f32 result = (((Atan0 * t2 + Atan1) * t2 + Atan2) * t2 + Atan3) * t2 * t + t;
+        result += reduce ? std::numbers::pi_v<f32> / 4 : 0;
+        result = absoluteY > absoluteX ? std::numbers::pi_v<f32> / 2 - result : result;
+        result = x < 0 ? std::numbers::pi_v<f32> - result : result;
+
+        return std::copysign(result, y);
+    }
+
+    /**
+     * @brief e^x with a relative error below 3e-7. x is clamped to [-87, 88], where the result is a normal float
+     */
+    SSSENGINE_GLOBAL f32 FastExp(f32 x)
+    {
+        using namespace Detail;
+
+        x = std::fmin(std::fmax(x, ExpMinimum), ExpMaximum);
+
+        const f32 n = std::nearbyint(x * Log2E);
+        f32 r = x - n * Ln2High;
+        r -= n * Ln2Low;
+
+        const f32 p = ((((Exp0 * r + Exp1) * r + Exp2) * r + Exp3) * r + Exp4) * r + Exp5;
+        return (p * r * r + r + 1) * std::ldexp(1.0f, static_cast<i32>(n));
+    }
+
+    /**
+     * @brief Natural logarithm of x with an absolute error below 2e-7. x must be a positive, finite and normal float
+     */
+    SSSENGINE_GLOBAL f32 FastLog(f32 x)
+    {
+        using namespace Detail;
+
+        // NOTE: x = m * 2^e with m in [sqrt(0.5), sqrt(2)) so log(x) = e * log(2) + log(m)
+        const u32 bits = std::bit_cast<u32>(x);
+        f32 e = static_cast<f32>(static_cast<i32>(bits >> 23)) - 126;
+        f32 m = std::bit_cast<f32>((bits & F32MantissaMask) | std::bit_cast<u32>(0.5f));
+        if(m < SqrtHalf)
+        {
+            e -= 1;
+            m += m;
+        }
+        m -= 1;
+
+        const f32 m2 = m * m;
+        f32 p = ((((Log0 * m + Log1) * m + Log2) * m + Log3) * m + Log4) * m + Log5;
+        p = ((p * m + Log6) * m + Log7) * m + Log8;
+        return (p * m * m2 + e * Ln2Low - 0.5f * m2 + m) + e * Ln2High;
+    }
+
+    /**
+     * @brief x^y with a relative error below 2e-6 while |y * log(x)| <= 16. x must be a positive, finite and normal
+     * float
+     */
+    SSSENGINE_GLOBAL f32 FastPow(f32 x, f32 y)
+    {
+        return FastExp(y * FastLog(x));
+    }
+
+    /**
+     * @brief 1 / sqrt(x) with a relative error below 5e-7. x must be positive and finite
+     */
+    SSSENGINE_GLOBAL f32 FastRSqrt(f32 x)
+    {
+        // NOTE: One Newton-Raphson step doubles the 12 bits of the hardware estimate
+        const f32 estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        return estimate * (1.5f - 0.5f * x * estimate * estimate);
+    }
+
+    namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+    {
+        /**
+         * @brief Lane wise FastSinCos
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE void FastSinCos(Register angle, Register &sine, Register &cosine)
+        {
+            using namespace Detail;
+
+            const Register quadrant = Round(Mul(angle, Set1<Register>(TwoOverPi)));
+            Register r = MulAdd(quadrant, Set1<Register>(-PiOver2High), angle);
+            r = MulAdd(quadrant, Set1<Register>(-PiOver2Middle), r);
+            r = MulAdd(quadrant, Set1<Register>(-PiOver2Low), r);
+
+            const Register r2 = Mul(r, r);
+            const Register s = MulAdd(
+                Mul(MulAdd(MulAdd(Set1<Register>(Sin0), r2, Set1<Register>(Sin1)), r2, Set1<Register>(Sin2)), r2),
+                r,
+                r);
+            const Register c =
+                MulAdd(Mul(r2, r2),
+                       MulAdd(MulAdd(Set1<Register>(Cos0), r2, Set1<Register>(Cos1)), r2, Set1<Register>(Cos2)),
+                       MulAdd(r2, Set1<Register>(-0.5f), Set1<Register>(1)));
+
+            // NOTE: The quadrant modulo 4 without integer instructions. The fraction of quadrant / 4 is one of 0, 0.25,
+            // 0.5 or 0.75 and the rounding can't tie after subtracting 0.375
+            const Register quarter = Mul(quadrant, Set1<Register>(0.25f));
+            const Register fraction = Sub(quarter, Round(Sub(quarter, Set1<Register>(0.375f))));
+            const Register upperHalf = CompareGreater(fraction, Set1<Register>(0.375f));
+            const Register odd = CompareGreater(Sub(fraction, And(upperHalf, Set1<Register>(0.5f))),
+                                                Set1<Register>(0.125f));
+            const Register cosineNegative = And(CompareGreater(fraction, Set1<Register>(0.125f)),
+                                                CompareLess(fraction, Set1<Register>(0.625f)));
+
+            const Register signBit = Set1<Register>(-0.0f);
+            sine = Xor(Select(odd, c, s), And(upperHalf, signBit));
+            cosine = Xor(Select(odd, s, c), And(cosineNegative, signBit));
+        }
+
+        /**
+         * @brief Lane wise FastSin
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastSin(Register angle)
+        {
+            Register sine, cosine;
+            FastSinCos(angle, sine, cosine);
+            return sine;
+        }
+
+        /**
+         * @brief Lane wise FastCos
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastCos(Register angle)
+        {
+            Register sine, cosine;
+            FastSinCos(angle, sine, cosine);
+            return cosine;
+        }
+
+        /**
+         * @brief Lane wise FastAtan2
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastAtan2(Register y, Register x)
+        {
+            using namespace Detail;
+
+            const Register signBit = Set1<Register>(-0.0f);
+            const Register zero = Set1<Register>(0);
+            const Register absoluteY = AndNot(signBit, y);
+            const Register absoluteX = AndNot(signBit, x);
+            const Register minimum = Min(absoluteX, absoluteY);
+            const Register maximum = Max(absoluteX, absoluteY);
+
+            const Register reduce = CompareGreater(minimum, Mul(maximum, Set1<Register>(TanPiOver8)));
+            const Register numerator = Select(reduce, Sub(minimum, maximum), minimum);
+            const Register denominator = Select(
+                reduce, Add(minimum, maximum), Select(CompareEqual(maximum, zero), Set1<Register>(1), maximum));
+            const Register t = Div(numerator, denominator);
+            const Register t2 = Mul(t, t);
+
+            const Register polynomial =
+                MulAdd(MulAdd(MulAdd(Set1<Register>(Atan0), t2, Set1<Register>(Atan1)), t2, Set1<Register>(Atan2)),
+                       t2,
+                       Set1<Register>(Atan3));
+            Register result = MulAdd(Mul(polynomial, t2), t, t);
+            result = Add(result, And(reduce, Set1<Register>(std::numbers::pi_v<f32> / 4)));
+            result = Select(CompareGreater(absoluteY, absoluteX),
+                            Sub(Set1<Register>(std::numbers::pi_v<f32> / 2), result),
+                            result);
+            result = Select(CompareLess(x, zero), Sub(Set1<Register>(std::numbers::pi_v<f32>), result), result);
+
+            // NOTE: The result is positive here so the sign of y can be copied with an or
+            return Or(result, And(y, signBit));
+        }
+
+        /**
+         * @brief Lane wise FastExp
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastExp(Register x)
+        {
+            using namespace Detail;
+
+            x = Min(Max(x, Set1<Register>(ExpMinimum)), Set1<Register>(ExpMaximum));
+
+            const Register n = Round(Mul(x, Set1<Register>(Log2E)));
+            Register r = MulAdd(n, Set1<Register>(-Ln2High), x);
+            r = MulAdd(n, Set1<Register>(-Ln2Low), r);
+
+            Register p = MulAdd(Set1<Register>(Exp0), r, Set1<Register>(Exp1));
+            p = MulAdd(p, r, Set1<Register>(Exp2));
+            p = MulAdd(p, r, Set1<Register>(Exp3));
+            p = MulAdd(p, r, Set1<Register>(Exp4));
+            p = MulAdd(p, r, Set1<Register>(Exp5));
+
+            const Register result = MulAdd(Mul(p, r), r, Add(r, Set1<Register>(1)));
+            return Mul(result, Exp2Integer(n));
+        }
+
+        /**
+         * @brief Lane wise FastLog
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastLog(Register x)
+        {
+            using namespace Detail;
+
+            // NOTE: The exponent field converted as an integer is (e + 127) * 2^23, exact in a float
+            const Register exponentBits = And(x, Set1<Register>(BitCast<f32>(F32ExponentMask)));
+            Register e = Sub(Mul(ConvertBitsToFloat(exponentBits), Set1<Register>(1.0f / (1 << 23))),
+                             Set1<Register>(126));
+            Register m = Or(And(x, Set1<Register>(BitCast<f32>(F32MantissaMask))), Set1<Register>(0.5f));
+
+            const Register small = CompareLess(m, Set1<Register>(SqrtHalf));
+            e = Sub(e, And(small, Set1<Register>(1)));
+            m = Sub(Add(m, And(small, m)), Set1<Register>(1));
+
+            const Register m2 = Mul(m, m);
+            Register p = MulAdd(Set1<Register>(Log0), m, Set1<Register>(Log1));
+            p = MulAdd(p, m, Set1<Register>(Log2));
+            p = MulAdd(p, m, Set1<Register>(Log3));
+            p = MulAdd(p, m, Set1<Register>(Log4));
+            p = MulAdd(p, m, Set1<Register>(Log5));
+            p = MulAdd(p, m, Set1<Register>(Log6));
+            p = MulAdd(p, m, Set1<Register>(Log7));
+            p = MulAdd(p, m, Set1<Register>(Log8));
+
+            Register result = MulAdd(Mul(p, m), m2, Mul(e, Set1<Register>(Ln2Low)));
+            result = MulAdd(m2, Set1<Register>(-0.5f), result);
+            result = Add(result, m);
+            return MulAdd(e, Set1<Register>(Ln2High), result);
+        }
+
+        /**
+         * @brief Lane wise FastPow
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastPow(Register x, Register y)
+        {
+            return FastExp(Mul(y, FastLog(x)));
+        }
+
+        /**
+         * @brief Lane wise FastRSqrt
+         */
+        template<typename Register>
+        SSSENGINE_FORCE_INLINE Register FastRSqrt(Register x)
+        {
+            const Register estimate = ReciprocalSqrtEstimate(x);
+            const Register halfX = Mul(x, Set1<Register>(0.5f));
+            return Mul(estimate, Sub(Set1<Register>(1.5f), Mul(halfX, Mul(estimate, estimate))));
+        }
+    } // namespace Simd::inline SSSENGINE_SIMD_NAMESPACE
+} // namespace SSSEngine::Math
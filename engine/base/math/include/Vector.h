@@ -24,12 +24,16 @@
 
 #pragma once
 
+#include <cmath>
+#include <concepts>
+#include "Attributes.h"
 #include "Concepts.h"
+#include "Debug.h"
 #include "HelperMacros.h"
+#include "Intrinsics.h"
 #include "Types.h"
+#include "VectorSimd.h"
 
-// INVESTIGATE: Are Intrinsics worth it here? Would need to make sure of alignment
-// TODO: Vector Math like cross product
 namespace SSSEngine::Math
 {
     template<SSSEngine::NumberConcept T>
@@ -176,6 +180,351 @@ namespace SSSEngine::Math
         }
     };
 
+    /**
+     * @class Vector4<f32>
+     * @brief Aligned to 16 bytes so every operation works on a single SSE register at runtime. Constant evaluation
+     * uses the scalar operations
+     *
+     */
+    template<>
+    struct alignas(16) Vector4<f32>
+    {
+        f32 X{0};
+        f32 Y{0};
+        f32 Z{0};
+        f32 W{0};
+
+        [[nodiscard]] SSSENGINE_FORCE_INLINE Vector128 ToRegister() const
+        {
+            return Simd::LoadAligned(&X);
+        }
+
+        [[nodiscard]] SSSENGINE_FORCE_INLINE static Vector4<f32> FromRegister(Vector128 value)
+        {
+            Vector4<f32> result;
+            Simd::StoreAligned(&result.X, value);
+
+            return result;
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator+(Vector4<f32> lhs, Vector4<f32> rhs)
+        {
+            if consteval
+            {
+                return {lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z, lhs.W + rhs.W};
+            }
+            else
+            {
+                return FromRegister(_mm_add_ps(lhs.ToRegister(), rhs.ToRegister()));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator-(Vector4<f32> lhs, Vector4<f32> rhs)
+        {
+            if consteval
+            {
+                return {lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z, lhs.W - rhs.W};
+            }
+            else
+            {
+                return FromRegister(_mm_sub_ps(lhs.ToRegister(), rhs.ToRegister()));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator*(Vector4<f32> lhs, Vector4<f32> rhs)
+        {
+            if consteval
+            {
+                return {lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z, lhs.W * rhs.W};
+            }
+            else
+            {
+                return FromRegister(_mm_mul_ps(lhs.ToRegister(), rhs.ToRegister()));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator/(Vector4<f32> lhs, Vector4<f32> rhs)
+        {
+            if consteval
+            {
+                return {lhs.X / rhs.X, lhs.Y / rhs.Y, lhs.Z / rhs.Z, lhs.W / rhs.W};
+            }
+            else
+            {
+                return FromRegister(_mm_div_ps(lhs.ToRegister(), rhs.ToRegister()));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator*(Vector4<f32> lhs, f32 scalar)
+        {
+            return lhs * Vector4<f32>{scalar, scalar, scalar, scalar};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator/(Vector4<f32> vector, f32 scalar)
+        {
+            return vector / Vector4<f32>{scalar, scalar, scalar, scalar};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Vector4<f32> operator*(f32 scalar, Vector4<f32> vector)
+        {
+            return vector * scalar;
+        }
+
+        friend SSSENGINE_GLOBAL constexpr bool operator==(Vector4<f32> lhs, Vector4<f32> rhs)
+        {
+            if consteval
+            {
+                return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z && lhs.W == rhs.W;
+            }
+            else
+            {
+                return Simd::EqualMask(lhs.ToRegister(), rhs.ToRegister()) == 0b1111;
+            }
+        }
+    };
+
+    /**
+     * @class Float3A
+     * @brief Float3 padded to 16 bytes to get the same SIMD operations as Float4. Opt in for dense data that is worth
+     * the extra 4 bytes, convert with ToFloat3A and ToFloat3
+     *
+     */
+    struct alignas(16) Float3A
+    {
+        f32 X{0};
+        f32 Y{0};
+        f32 Z{0};
+        // NOTE: Only there for the alignment. The operations keep it at 0 and ignore it
+        f32 Padding{0};
+
+        [[nodiscard]] SSSENGINE_FORCE_INLINE Vector128 ToRegister() const
+        {
+            return Simd::LoadAligned(&X);
+        }
+
+        [[nodiscard]] SSSENGINE_FORCE_INLINE static Float3A FromRegister(Vector128 value)
+        {
+            Float3A result;
+            Simd::StoreAligned(&result.X, value);
+
+            return result;
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator+(Float3A lhs, Float3A rhs)
+        {
+            if consteval
+            {
+                return {lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z};
+            }
+            else
+            {
+                return FromRegister(Simd::ClearW(_mm_add_ps(lhs.ToRegister(), rhs.ToRegister())));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator-(Float3A lhs, Float3A rhs)
+        {
+            if consteval
+            {
+                return {lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z};
+            }
+            else
+            {
+                return FromRegister(Simd::ClearW(_mm_sub_ps(lhs.ToRegister(), rhs.ToRegister())));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator*(Float3A lhs, Float3A rhs)
+        {
+            if consteval
+            {
+                return {lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z};
+            }
+            else
+            {
+                return FromRegister(Simd::ClearW(_mm_mul_ps(lhs.ToRegister(), rhs.ToRegister())));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator/(Float3A lhs, Float3A rhs)
+        {
+            if consteval
+            {
+                return {lhs.X / rhs.X, lhs.Y / rhs.Y, lhs.Z / rhs.Z};
+            }
+            else
+            {
+                // NOTE: 0 / 0 in the padding is NaN, cleared like the other operations
+                return FromRegister(Simd::ClearW(_mm_div_ps(lhs.ToRegister(), rhs.ToRegister())));
+            }
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator*(Float3A lhs, f32 scalar)
+        {
+            return lhs * Float3A{scalar, scalar, scalar};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator/(Float3A vector, f32 scalar)
+        {
+            return vector / Float3A{scalar, scalar, scalar};
+        }
+
+        friend SSSENGINE_GLOBAL constexpr Float3A operator*(f32 scalar, Float3A vector)
+        {
+            return vector * scalar;
+        }
+
+        friend SSSENGINE_GLOBAL constexpr bool operator==(Float3A lhs, Float3A rhs)
+        {
+            if consteval
+            {
+                return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z;
+            }
+            else
+            {
+                return (Simd::EqualMask(lhs.ToRegister(), rhs.ToRegister()) & 0b0111) == 0b0111;
+            }
+        }
+    };
+
+    template<SSSEngine::NumberConcept T>
+    SSSENGINE_GLOBAL constexpr T Dot(Vector2<T> lhs, Vector2<T> rhs)
+    {
+        return lhs.X * rhs.X + lhs.Y * rhs.Y;
+    }
+
+    template<SSSEngine::NumberConcept T>
+    SSSENGINE_GLOBAL constexpr T Dot(Vector3<T> lhs, Vector3<T> rhs)
+    {
+        return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z;
+    }
+
+    template<SSSEngine::NumberConcept T>
+    SSSENGINE_GLOBAL constexpr T Dot(Vector4<T> lhs, Vector4<T> rhs)
+    {
+        if consteval
+        {
+            return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z + lhs.W * rhs.W;
+        }
+        else
+        {
+            if constexpr(std::same_as<T, f32>)
+            {
+                return _mm_cvtss_f32(Simd::Dot4(lhs.ToRegister(), rhs.ToRegister()));
+            }
+            else
+            {
+                return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z + lhs.W * rhs.W;
+            }
+        }
+    }
+
+    SSSENGINE_GLOBAL constexpr f32 Dot(Float3A lhs, Float3A rhs)
+    {
+        if consteval
+        {
+            return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z;
+        }
+        else
+        {
+            return _mm_cvtss_f32(Simd::Dot3(lhs.ToRegister(), rhs.ToRegister()));
+        }
+    }
+
+    template<SSSEngine::NumberConcept T>
+    SSSENGINE_GLOBAL constexpr Vector3<T> Cross(Vector3<T> lhs, Vector3<T> rhs)
+    {
+        return {lhs.Y * rhs.Z - lhs.Z * rhs.Y, lhs.Z * rhs.X - lhs.X * rhs.Z, lhs.X * rhs.Y - lhs.Y * rhs.X};
+    }
+
+    SSSENGINE_GLOBAL constexpr Float3A Cross(Float3A lhs, Float3A rhs)
+    {
+        if consteval
+        {
+            return {lhs.Y * rhs.Z - lhs.Z * rhs.Y, lhs.Z * rhs.X - lhs.X * rhs.Z, lhs.X * rhs.Y - lhs.Y * rhs.X};
+        }
+        else
+        {
+            return Float3A::FromRegister(Simd::ClearW(Simd::Cross(lhs.ToRegister(), rhs.ToRegister())));
+        }
+    }
+
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL T Length(Vector2<T> vector)
+    {
+        return std::sqrt(Dot(vector, vector));
+    }
+
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL T Length(Vector3<T> vector)
+    {
+        return std::sqrt(Dot(vector, vector));
+    }
+
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL T Length(Vector4<T> vector)
+    {
+        if constexpr(std::same_as<T, f32>)
+        {
+            const Vector128 value = vector.ToRegister();
+            return _mm_cvtss_f32(_mm_sqrt_ss(Simd::Dot4(value, value)));
+        }
+        else
+        {
+            return std::sqrt(Dot(vector, vector));
+        }
+    }
+
+    SSSENGINE_GLOBAL f32 Length(Float3A vector)
+    {
+        const Vector128 value = vector.ToRegister();
+        return _mm_cvtss_f32(_mm_sqrt_ss(Simd::Dot3(value, value)));
+    }
+
+    /**
+     * @brief The vector divided by its length. vector must not be 0
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Vector2<T> Normalize(Vector2<T> vector)
+    {
+        return vector / Length(vector);
+    }
+
+    /**
+     * @brief The vector divided by its length. vector must not be 0
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Vector3<T> Normalize(Vector3<T> vector)
+    {
+        return vector / Length(vector);
+    }
+
+    /**
+     * @brief The vector divided by its length. vector must not be 0
+     */
+    template<SSSEngine::RealConcept T>
+    SSSENGINE_GLOBAL Vector4<T> Normalize(Vector4<T> vector)
+    {
+        if constexpr(std::same_as<T, f32>)
+        {
+            const Vector128 value = vector.ToRegister();
+            return Vector4<f32>::FromRegister(_mm_div_ps(value, _mm_sqrt_ps(Simd::Dot4(value, value))));
+        }
+        else
+        {
+            return vector / Length(vector);
+        }
+    }
+
+    /**
+     * @brief The vector divided by its length. vector must not be 0
+     */
+    SSSENGINE_GLOBAL Float3A Normalize(Float3A vector)
+    {
+        const Vector128 value = vector.ToRegister();
+        return Float3A::FromRegister(_mm_div_ps(value, _mm_sqrt_ps(Simd::Dot3(value, value))));
+    }
+
     // INVESTIGATE: Should this be in a different file?
     using Int2 = Vector2<i32>;
     using Int3 = Vector3<i32>;
@@ -186,4 +535,17 @@ namespace SSSEngine::Math
     using Float2 = Vector2<f32>;
     using Float3 = Vector3<f32>;
     using Float4 = Vector4<f32>;
+
+    SSSENGINE_STATIC_ASSERT(sizeof(Float4) == 16 && alignof(Float4) == 16, "Float4 must fit an aligned SSE register")
+    SSSENGINE_STATIC_ASSERT(sizeof(Float3A) == 16 && alignof(Float3A) == 16, "Float3A must fit an aligned SSE register")
+
+    SSSENGINE_GLOBAL constexpr Float3A ToFloat3A(Float3 vector)
+    {
+        return {vector.X, vector.Y, vector.Z};
+    }
+
+    SSSENGINE_GLOBAL constexpr Float3 ToFloat3(Float3A vector)
+    {
+        return {vector.X, vector.Y, vector.Z};
+    }
 } // namespace SSSEngine::Math
@@ -0,0 +1,114 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief SIMD kernels used by the vector operations at runtime
+ * Float4 and Float3A are 16 byte aligned so they are loaded and stored with aligned instructions. Float3A keeps 0 in
+ * its padding element and the kernels that could put anything else there clear it.
+ */
+
+#pragma once
+
+#include "Attributes.h"
+#include "Intrinsics.h"
+#include "Types.h"
+
+namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
+{
+    /**
+     * @param address Must be aligned to 16 bytes
+     */
+    SSSENGINE_FORCE_INLINE Vector128 LoadAligned(const f32 *address)
+    {
+        return _mm_load_ps(address);
+    }
+
+    /**
+     * @param address Must be aligned to 16 bytes
+     */
+    SSSENGINE_FORCE_INLINE void StoreAligned(f32 *address, Vector128 value)
+    {
+        _mm_store_ps(address, value);
+    }
+
+    /**
+     * @brief Reorders the elements of a register
+     *
+     * @tparam X The index of the element to put in the first element. Same for the others
+     */
+    template<int X, int Y, int Z, int W>
+    SSSENGINE_FORCE_INLINE Vector128 Swizzle(Vector128 vector)
+    {
+        return _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    /**
+     * @brief Sets the last element to 0
+     */
+    SSSENGINE_FORCE_INLINE Vector128 ClearW(Vector128 vector)
+    {
+        return _mm_and_ps(vector, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+    }
+
+    /**
+     * @brief Dot product of the 4 elements broadcasted to every element
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Dot4(Vector128 lhs, Vector128 rhs)
+    {
+#ifdef SSSENGINE_SIMD_SSE41
+        return _mm_dp_ps(lhs, rhs, 0xFF);
+#else
+        Vector128 product = _mm_mul_ps(lhs, rhs);
+        product = _mm_add_ps(product, Swizzle<2, 3, 0, 1>(product));
+        return _mm_add_ps(product, Swizzle<1, 0, 3, 2>(product));
+#endif
+    }
+
+    /**
+     * @brief Dot product of the first 3 elements broadcasted to every element
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Dot3(Vector128 lhs, Vector128 rhs)
+    {
+#ifdef SSSENGINE_SIMD_SSE41
+        return _mm_dp_ps(lhs, rhs, 0x7F);
+#else
+        Vector128 product = ClearW(_mm_mul_ps(lhs, rhs));
+        product = _mm_add_ps(product, Swizzle<2, 3, 0, 1>(product));
+        return _mm_add_ps(product, Swizzle<1, 0, 3, 2>(product));
+#endif
+    }
+
+    /**
+     * @brief Cross product of the first 3 elements. The last element is lhs.w * rhs.w - lhs.w * rhs.w, 0 if finite
+     */
+    SSSENGINE_FORCE_INLINE Vector128 Cross(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_sub_ps(_mm_mul_ps(Swizzle<1, 2, 0, 3>(lhs), Swizzle<2, 0, 1, 3>(rhs)),
+                          _mm_mul_ps(Swizzle<2, 0, 1, 3>(lhs), Swizzle<1, 2, 0, 3>(rhs)));
+    }
+
+    /**
+     * @return A mask with the bit i set when the element i of lhs and rhs are equal
+     */
+    SSSENGINE_FORCE_INLINE i32 EqualMask(Vector128 lhs, Vector128 rhs)
+    {
+        return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs));
+    }
+} // namespace SSSEngine::Math::Simd::inline SSSENGINE_SIMD_NAMESPACE
@@ -0,0 +1,72 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief The 8 bit sRGB decoding table
+ */
+
+#include <array>
+#include <cmath>
+#include "ColorSpace.h"
+
+namespace SSSEngine::Math
+{
+    namespace
+    {
+        const std::array<f32, 256> &SrgbTable()
+        {
+            // NOTE: Built once with the exact curve in double precision, the fast curves are for the float inputs
+            static const std::array<f32, 256> table = []
+            {
+                std::array<f32, 256> values{};
+                for(size i = 0; i < values.size(); ++i)
+                {
+                    const f64 srgb = static_cast<f64>(i) / 255;
+                    const f64 linear = srgb <= Detail::SrgbEncodedThreshold ? srgb / Detail::SrgbSlope
+                                                                            : std::pow((srgb + 0.055) / 1.055, 2.4);
+                    values[i] = static_cast<f32>(linear);
+                }
+                return values;
+            }();
+
+            return table;
+        }
+    } // namespace
+
+    f32 Srgb8ToLinear(u8 srgb)
+    {
+        return SrgbTable()[srgb];
+    }
+
+    void ConvertSrgb8ToLinear(std::span<const u8> rgba, std::span<f32> result)
+    {
+        SSSENGINE_ASSERT(rgba.size() % 4 == 0);
+        SSSENGINE_ASSERT(result.size() >= rgba.size());
+
+        const std::array<f32, 256> &table = SrgbTable();
+        for(size i = 0; i < rgba.size(); i += 4)
+        {
+            result[i] = table[rgba[i]];
+            result[i + 1] = table[rgba[i + 1]];
+            result[i + 2] = table[rgba[i + 2]];
+            result[i + 3] = FromUnorm8(rgba[i + 3]);
+        }
+    }
+} // namespace SSSEngine::Math
@@ -0,0 +1,83 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Selection of the kernel tables
+ */
+
+#include "MathKernels.h"
+
+namespace SSSEngine::Math::Kernels
+{
+    SimdLevel LoadKernels(SimdLevel level)
+    {
+        // NOTE: There are no AVX-512 kernels yet, AVX2 is the best there is for those CPUs
+        if(level >= SimdLevel::Avx2)
+        {
+            TransformPacked = Avx2::TransformPacked;
+            TransformStream = Avx2::TransformStream;
+            NormalizeQuaternions = Avx2::NormalizeQuaternions;
+            Nlerp = Avx2::Nlerp;
+            Slerp = Avx2::Slerp;
+            ComposeTransforms = Avx2::ComposeTransforms;
+            CullBoundingBoxes = Avx2::CullBoundingBoxes;
+            CullBoundingSpheres = Avx2::CullBoundingSpheres;
+            ConvertToHalf = Avx2::ConvertToHalf;
+            ConvertFromHalf = Avx2::ConvertFromHalf;
+            ConvertToSnorm16 = Avx2::ConvertToSnorm16;
+            ConvertToUnorm8 = Avx2::ConvertToUnorm8;
+            EncodeOctahedral = Avx2::EncodeOctahedral;
+            ConvertFromUnorm8 = Avx2::ConvertFromUnorm8;
+            ConvertLinearToSrgb = Avx2::ConvertLinearToSrgb;
+            ConvertSrgbToLinear = Avx2::ConvertSrgbToLinear;
+            ConvertLinearToSrgb8 = Avx2::ConvertLinearToSrgb8;
+            ConvertToR11G11B10 = Avx2::ConvertToR11G11B10;
+            ConvertFromR11G11B10 = Avx2::ConvertFromR11G11B10;
+            ConvertToRgb9E5 = Avx2::ConvertToRgb9E5;
+            ConvertFromRgb9E5 = Avx2::ConvertFromRgb9E5;
+
+            return SimdLevel::Avx2;
+        }
+
+        TransformPacked = Sse::TransformPacked;
+        TransformStream = Sse::TransformStream;
+        NormalizeQuaternions = Sse::NormalizeQuaternions;
+        Nlerp = Sse::Nlerp;
+        Slerp = Sse::Slerp;
+        ComposeTransforms = Sse::ComposeTransforms;
+        CullBoundingBoxes = Sse::CullBoundingBoxes;
+        CullBoundingSpheres = Sse::CullBoundingSpheres;
+        ConvertToHalf = Sse::ConvertToHalf;
+        ConvertFromHalf = Sse::ConvertFromHalf;
+        ConvertToSnorm16 = Sse::ConvertToSnorm16;
+        ConvertToUnorm8 = Sse::ConvertToUnorm8;
+        EncodeOctahedral = Sse::EncodeOctahedral;
+        ConvertFromUnorm8 = Sse::ConvertFromUnorm8;
+        ConvertLinearToSrgb = Sse::ConvertLinearToSrgb;
+        ConvertSrgbToLinear = Sse::ConvertSrgbToLinear;
+        ConvertLinearToSrgb8 = Sse::ConvertLinearToSrgb8;
+        ConvertToR11G11B10 = Sse::ConvertToR11G11B10;
+        ConvertFromR11G11B10 = Sse::ConvertFromR11G11B10;
+        ConvertToRgb9E5 = Sse::ConvertToRgb9E5;
+        ConvertFromRgb9E5 = Sse::ConvertFromRgb9E5;
+
+        return SimdLevel::Sse2;
+    }
+} // namespace SSSEngine::Math::Kernels
@@ -0,0 +1,150 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief The definitions of the kernels of MathKernels.h, included once per instruction set
+ * The including file defines SSSENGINE_KERNELS_NAMESPACE with the name of the table being defined and is compiled with
+ * the matching instruction set. Only code inside the Simd namespace can be called here, see SSSENGINE_SIMD_NAMESPACE
+ */
+
+#include "BatchTransform.h"
+#include "ColorSpace.h"
+#include "Frustum.h"
+#include "MathKernels.h"
+#include "Packed.h"
+#include "Quaternion.h"
+
+#ifndef SSSENGINE_KERNELS_NAMESPACE
+    #error SSSENGINE_KERNELS_NAMESPACE must be defined before including Kernels.inl
+#endif
+
+namespace SSSEngine::Math::Kernels::SSSENGINE_KERNELS_NAMESPACE
+{
+    void TransformPacked(const Mat4x4f &matrix, const Float3 *input, Float3 *output, size count, f32 w)
+    {
+        Simd::TransformBatch(matrix, input, output, count, w);
+    }
+
+    void TransformStream(const Mat4x4f &matrix, const f32 *inX, const f32 *inY, const f32 *inZ, f32 *outX,
+                         f32 *outY, f32 *outZ, size count, f32 w)
+    {
+        Simd::TransformBatch(matrix, inX, inY, inZ, outX, outY, outZ, count, w);
+    }
+
+    void NormalizeQuaternions(const Quaternionf *quaternions, Quaternionf *result, size count)
+    {
+        Simd::NormalizeBatch(quaternions, result, count);
+    }
+
+    void Nlerp(const Quaternionf *from, const Quaternionf *to, const f32 *t, Quaternionf *result, size count)
+    {
+        Simd::InterpolateBatch<false>(from, to, t, result, count);
+    }
+
+    void Slerp(const Quaternionf *from, const Quaternionf *to, const f32 *t, Quaternionf *result, size count)
+    {
+        Simd::InterpolateBatch<true>(from, to, t, result, count);
+    }
+
+    void ComposeTransforms(const Float3 *positions, const Quaternionf *rotations, const Float3 *scales,
+                           Mat4x4f *result, size count)
+    {
+        Simd::ComposeTransformsBatch(positions, rotations, scales, result, count);
+    }
+
+    size CullBoundingBoxes(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                           const f32 *extentX, const f32 *extentY, const f32 *extentZ, size count, u32 firstIndex,
+                           u32 *visible)
+    {
+        return Simd::CullBoxesBatch(
+            frustum, centerX, centerY, centerZ, extentX, extentY, extentZ, count, firstIndex, visible);
+    }
+
+    size CullBoundingSpheres(const Frustum &frustum, const f32 *centerX, const f32 *centerY, const f32 *centerZ,
+                             const f32 *radii, size count, u32 firstIndex, u32 *visible)
+    {
+        return Simd::CullSpheresBatch(frustum, centerX, centerY, centerZ, radii, count, firstIndex, visible);
+    }
+
+    void ConvertToHalf(const f32 *values, Half *result, size count)
+    {
+        Simd::ConvertToHalfBatch(values, result, count);
+    }
+
+    void ConvertFromHalf(const Half *halves, f32 *result, size count)
+    {
+        Simd::ConvertFromHalfBatch(halves, result, count);
+    }
+
+    void ConvertToSnorm16(const f32 *values, Snorm16 *result, size count)
+    {
+        Simd::ConvertToSnorm16Batch(values, result, count);
+    }
+
+    void ConvertToUnorm8(const f32 *values, u8 *result, size count)
+    {
+        Simd::ConvertToUnorm8Batch(values, result, count);
+    }
+
+    void EncodeOctahedral(const Float3 *normals, OctahedralNormal *result, size count)
+    {
+        Simd::EncodeOctahedralBatch(normals, result, count);
+    }
+
+    void ConvertFromUnorm8(const u8 *values, f32 *result, size count)
+    {
+        Simd::ConvertFromUnorm8Batch(values, result, count);
+    }
+
+    void ConvertLinearToSrgb(const f32 *values, f32 *result, size count)
+    {
+        Simd::ConvertSrgbBatch<false>(values, result, count);
+    }
+
+    void ConvertSrgbToLinear(const f32 *values, f32 *result, size count)
+    {
+        Simd::ConvertSrgbBatch<true>(values, result, count);
+    }
+
+    void ConvertLinearToSrgb8(const f32 *rgba, u8 *result, size count)
+    {
+        Simd::ConvertLinearToSrgb8Batch(rgba, result, count);
+    }
+
+    void ConvertToR11G11B10(const f32 *rgb, R11G11B10 *result, size count)
+    {
+        Simd::PackRgbBatch(rgb, result, count, Simd::ToR11G11B10x4);
+    }
+
+    void ConvertFromR11G11B10(const R11G11B10 *colors, f32 *rgb, size count)
+    {
+        Simd::UnpackRgbBatch(colors, rgb, count, Simd::FromR11G11B10x4);
+    }
+
+    void ConvertToRgb9E5(const f32 *rgb, Rgb9E5 *result, size count)
+    {
+        Simd::PackRgbBatch(rgb, result, count, Simd::ToRgb9E5x4);
+    }
+
+    void ConvertFromRgb9E5(const Rgb9E5 *colors, f32 *rgb, size count)
+    {
+        Simd::UnpackRgbBatch(colors, rgb, count, Simd::FromRgb9E5x4);
+    }
+} // namespace SSSEngine::Math::Kernels::SSSENGINE_KERNELS_NAMESPACE
@@ -0,0 +1,473 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Growable contiguous arrays that take their memory from any engine allocator
+ * Trivially relocatable elements are moved with one memcpy when the array grows, and the bounds checks only exist
+ * while SSSENGINE_ASSERTIONS is defined.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Attributes.h"
+#include "Concepts.h"
+#include "ContainerAllocator.h"
+#include "Debug.h"
+#include "Types.h"
+
+namespace SSSEngine
+{
+    namespace Detail
+    {
+        template<typename T, size Capacity>
+        struct InlineStorage
+        {
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *Get() noexcept
+            {
+                return reinterpret_cast<T *>(Bytes);
+            }
+
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T *Get() const noexcept
+            {
+                return reinterpret_cast<const T *>(Bytes);
+            }
+
+            alignas(T) byte Bytes[sizeof(T) * Capacity];
+        };
+
+        template<typename T>
+        struct InlineStorage<T, 0>
+        {
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *Get() const noexcept
+            {
+                return nullptr;
+            }
+        };
+    } // namespace Detail
+
+    /**
+     * @class BasicArray
+     * @brief Contiguous array that grows geometrically. The first InlineCapacity elements live inside the object and
+     * only spill to the allocator past that. Use the Array and SmallArray aliases
+     *
+     * Growing moves the elements, so pointers and references to them are invalidated.
+     */
+    template<typename T, size InlineCapacity, ContainerAllocatorConcept A>
+    class BasicArray
+    {
+        public:
+        using ValueType = T;
+        using Iterator = T *;
+        using ConstIterator = const T *;
+
+        BasicArray() noexcept(std::is_nothrow_default_constructible_v<A>) = default;
+
+        explicit BasicArray(const A &allocator) noexcept : m_allocator{allocator}
+        {
+        }
+
+        /**
+         * @brief Creates count value initialized elements
+         */
+        explicit BasicArray(size count, const A &allocator = A{}) : m_allocator{allocator}
+        {
+            Resize(count);
+        }
+
+        BasicArray(std::initializer_list<T> values, const A &allocator = A{}) : m_allocator{allocator}
+        {
+            Reserve(values.size());
+            std::uninitialized_copy(values.begin(), values.end(), m_data);
+            m_size = values.size();
+        }
+
+        BasicArray(const BasicArray &other) : m_allocator{other.m_allocator}
+        {
+            Reserve(other.m_size);
+            std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+            m_size = other.m_size;
+        }
+
+        BasicArray(BasicArray &&other) noexcept : m_allocator{other.m_allocator}
+        {
+            Take(other);
+        }
+
+        BasicArray &operator=(const BasicArray &other)
+        {
+            if(this != &other)
+            {
+                Clear();
+                Reserve(other.m_size);
+                std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+                m_size = other.m_size;
+            }
+            return *this;
+        }
+
+        BasicArray &operator=(BasicArray &&other) noexcept
+        {
+            if(this != &other)
+            {
+                Clear();
+                Release();
+                m_data = m_inline.Get();
+                m_capacity = InlineCapacity;
+                m_allocator = other.m_allocator;
+                Take(other);
+            }
+            return *this;
+        }
+
+        ~BasicArray()
+        {
+            Clear();
+            Release();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T &operator[](size index) noexcept
+        {
+            SSSENGINE_ASSERT(index < m_size && "Array index out of bounds");
+            return m_data[index];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T &operator[](size index) const noexcept
+        {
+            SSSENGINE_ASSERT(index < m_size && "Array index out of bounds");
+            return m_data[index];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T &Front() noexcept
+        {
+            return (*this)[0];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T &Front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T &Back() noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T &Back() const noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        /**
+         * @brief Constructs an element at the end
+         *
+         * @return The new element
+         * @throws std::bad_alloc if growing failed
+         */
+        template<typename... Args>
+        SSSENGINE_FORCE_INLINE T &EmplaceBack(Args &&...args)
+        {
+            if(m_size == m_capacity) [[unlikely]]
+            {
+                return GrowAndEmplaceBack(std::forward<Args>(args)...);
+            }
+
+            T *element = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+
+        SSSENGINE_FORCE_INLINE T &PushBack(const T &value)
+        {
+            return EmplaceBack(value);
+        }
+
+        SSSENGINE_FORCE_INLINE T &PushBack(T &&value)
+        {
+            return EmplaceBack(std::move(value));
+        }
+
+        SSSENGINE_FORCE_INLINE void PopBack() noexcept
+        {
+            SSSENGINE_ASSERT(m_size > 0 && "PopBack on an empty array");
+            --m_size;
+            std::destroy_at(m_data + m_size);
+        }
+
+        /**
+         * @brief Removes the element at index by moving the last one into its place. Doesn't keep the order
+         */
+        void RemoveSwap(size index) noexcept
+        {
+            SSSENGINE_ASSERT(index < m_size && "Array index out of bounds");
+            if(index != m_size - 1)
+            {
+                m_data[index] = std::move(m_data[m_size - 1]);
+            }
+            PopBack();
+        }
+
+        /**
+         * @brief Removes the element at index and shifts the ones after it. Keeps the order
+         */
+        void Remove(size index) noexcept
+        {
+            SSSENGINE_ASSERT(index < m_size && "Array index out of bounds");
+            std::move(m_data + index + 1, m_data + m_size, m_data + index);
+            PopBack();
+        }
+
+        /**
+         * @brief Makes room for capacity elements without changing the size
+         */
+        void Reserve(size capacity)
+        {
+            if(capacity > m_capacity)
+            {
+                Reallocate(capacity);
+            }
+        }
+
+        /**
+         * @brief Changes the size. New elements are value initialized
+         */
+        void Resize(size count)
+        {
+            Reserve(count);
+            if(count > m_size)
+            {
+                std::uninitialized_value_construct(m_data + m_size, m_data + count);
+            }
+            else
+            {
+                std::destroy(m_data + count, m_data + m_size);
+            }
+            m_size = count;
+        }
+
+        /**
+         * @brief Changes the size leaving the new elements uninitialized. Only for types that need no construction,
+         * meant for buffers that are about to be overwritten
+         */
+        void ResizeUninitialized(size count)
+            requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+        {
+            Reserve(count);
+            m_size = count;
+        }
+
+        /**
+         * @brief Destroys every element. The capacity is kept
+         */
+        void Clear() noexcept
+        {
+            std::destroy_n(m_data, m_size);
+            m_size = 0;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *GetData() noexcept
+        {
+            return m_data;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T *GetData() const noexcept
+        {
+            return m_data;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetSize() const noexcept
+        {
+            return m_size;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool IsEmpty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const A &GetAllocator() const noexcept
+        {
+            return m_allocator;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE Iterator begin() noexcept
+        {
+            return m_data;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE Iterator end() noexcept
+        {
+            return m_data + m_size;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ConstIterator begin() const noexcept
+        {
+            return m_data;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ConstIterator end() const noexcept
+        {
+            return m_data + m_size;
+        }
+
+        private:
+        /**
+         * @brief At least a cache line worth of elements on the first allocation
+         */
+        // NOTE: (std::max) so the max macro of windows.h is not expanded
+        static constexpr size MinCapacity = (std::max)(64 / sizeof(T), size{1});
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool IsInline() const noexcept
+        {
+            return m_data == m_inline.Get();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetGrownCapacity(size needed) const noexcept
+        {
+            return (std::max)({needed, m_capacity * 2, MinCapacity});
+        }
+
+        SSSENGINE_PURE T *Allocate(size capacity)
+        {
+            void *memory = m_allocator.Allocate(sizeof(T) * capacity, alignof(T));
+            if(memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T *>(memory);
+        }
+
+        void Release() noexcept
+        {
+            if(!IsInline())
+            {
+                m_allocator.Deallocate(m_data, sizeof(T) * m_capacity, alignof(T));
+            }
+        }
+
+        /**
+         * @brief Moves count elements to uninitialized memory, leaving nothing to destroy behind
+         */
+        static void Relocate(T *from, size count, T *to) noexcept
+        {
+            if constexpr(IsTriviallyRelocatableV<T>)
+            {
+                if(count > 0)
+                {
+                    std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), sizeof(T) * count);
+                }
+            }
+            else
+            {
+                static_assert(std::is_nothrow_move_constructible_v<T>, "Array elements must be nothrow movable");
+                std::uninitialized_move_n(from, count, to);
+                std::destroy_n(from, count);
+            }
+        }
+
+        SSSENGINE_NO_INLINE void Reallocate(size capacity)
+        {
+            T *data = Allocate(capacity);
+            Relocate(m_data, m_size, data);
+            Release();
+            m_data = data;
+            m_capacity = capacity;
+        }
+
+        template<typename... Args>
+        SSSENGINE_NO_INLINE T &GrowAndEmplaceBack(Args &&...args)
+        {
+            const size capacity = GetGrownCapacity(m_size + 1);
+            T *data = Allocate(capacity);
+
+            // NOTE: Constructed before the old elements are moved since args may reference them
+            T *element;
+            try
+            {
+                element = std::construct_at(data + m_size, std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                m_allocator.Deallocate(data, sizeof(T) * capacity, alignof(T));
+                throw;
+            }
+
+            Relocate(m_data, m_size, data);
+            Release();
+            m_data = data;
+            m_capacity = capacity;
+            ++m_size;
+            return *element;
+        }
+
+        /**
+         * @brief Takes the elements of other, which is left empty. This array must hold no memory
+         */
+        void Take(BasicArray &other) noexcept
+        {
+            if(other.IsInline())
+            {
+                Relocate(other.m_data, other.m_size, m_data);
+            }
+            else
+            {
+                m_data = other.m_data;
+                m_capacity = other.m_capacity;
+            }
+            m_size = other.m_size;
+
+            other.m_data = other.m_inline.Get();
+            other.m_size = 0;
+            other.m_capacity = InlineCapacity;
+        }
+
+        T *m_data{m_inline.Get()};
+        size m_size{0};
+        size m_capacity{InlineCapacity};
+        SSSENGINE_NO_UNIQUE_ADDRESS A m_allocator{};
+        SSSENGINE_NO_UNIQUE_ADDRESS Detail::InlineStorage<T, InlineCapacity> m_inline;
+    };
+
+    template<typename T, ContainerAllocatorConcept A = GlobalAllocator>
+    using Array = BasicArray<T, 0, A>;
+
+    /**
+     * @brief Array that holds up to InlineCapacity elements without allocating
+     */
+    template<typename T, size InlineCapacity, ContainerAllocatorConcept A = GlobalAllocator>
+    using SmallArray = BasicArray<T, InlineCapacity, A>;
+
+    /**
+     * @brief Arrays without inline elements only hold a pointer to their elements
+     */
+    template<typename T, ContainerAllocatorConcept A>
+    inline constexpr bool IsTriviallyRelocatableV<BasicArray<T, 0, A>> = IsTriviallyRelocatableV<A>;
+} // namespace SSSEngine
@@ -67,4 +67,35 @@ namespace SSSEngine
     {
         return first & ~Join(bits...);
     }
+
+    /**
+     * @brief Checks if value is a power of 2. 0 is not
+     */
+    SSSENGINE_FORCE_INLINE constexpr bool IsPowerOfTwo(IntegralConcept auto value)
+    {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+
+    /**
+     * @brief Rounds value up to the next multiple of alignment
+     *
+     * @param alignment Must be a power of 2
+     * @return The smallest multiple of alignment that is not less than value
+     */
+    template<IntegralConcept T>
+    SSSENGINE_FORCE_INLINE constexpr T AlignUp(T value, T alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    /**
+     * @brief Rounds value down to the previous multiple of alignment
+     *
+     * @param alignment Must be a power of 2
+     */
+    template<IntegralConcept T>
+    SSSENGINE_FORCE_INLINE constexpr T AlignDown(T value, T alignment)
+    {
+        return value & ~(alignment - 1);
+    }
 } // namespace SSSEngine
@@ -105,4 +105,12 @@ namespace SSSEngine
     template<template<typename...> typename T, typename... Ts, typename... Us>
         requires(sizeof...(Ts) == sizeof...(Us))
     inline constexpr bool IsLikeV<T<Ts...>, T<Us...>> = (IsLikeV<Ts, Us> && ...);
+
+    /**
+     * @brief Checks if a T can be moved to another address with a memcpy, leaving nothing to destroy at the old one.
+     * Specialize it for types that own their memory through pointers but aren't trivially copyable
+     *
+     */
+    template<typename T>
+    inline constexpr bool IsTriviallyRelocatableV = std::is_trivially_copyable_v<T>;
 } // namespace SSSEngine
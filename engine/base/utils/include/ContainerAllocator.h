@@ -0,0 +1,73 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief What the engine containers need from an allocator, and the default one
+ */
+
+#pragma once
+
+#include <concepts>
+#include <new>
+#include "Attributes.h"
+#include "Types.h"
+
+namespace SSSEngine
+{
+    /**
+     * @brief Concept of something a container can take memory from. Deallocate gets the same size and alignment that
+     * were given to Allocate
+     *
+     */
+    template<typename A>
+    concept ContainerAllocatorConcept = std::copyable<A> && requires(A allocator, void *memory, size bytes) {
+        { allocator.Allocate(bytes, bytes) } -> std::same_as<void *>;
+        allocator.Deallocate(memory, bytes, bytes);
+    };
+
+    /**
+     * @class GlobalAllocator
+     * @brief Takes memory from the global operator new
+     *
+     */
+    struct GlobalAllocator
+    {
+        SSSENGINE_PURE static void *Allocate(size bytes, size alignment) noexcept
+        {
+            if(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(bytes, std::nothrow);
+            }
+            return ::operator new(bytes, std::align_val_t{alignment}, std::nothrow);
+        }
+
+        static void Deallocate(void *memory, size bytes, size alignment) noexcept
+        {
+            if(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(memory, bytes);
+            }
+            else
+            {
+                ::operator delete(memory, bytes, std::align_val_t{alignment});
+            }
+        }
+    };
+} // namespace SSSEngine
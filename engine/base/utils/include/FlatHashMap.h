@@ -0,0 +1,565 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Open addressing hash map with the keys and values stored inline
+ * Every slot has a control byte holding 7 bits of the hash of its key. Lookups compare 16 control bytes at once with
+ * SSE2 and only touch the slots whose bits match, so a lookup usually reads one group of control bytes and one slot.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Attributes.h"
+#include "Concepts.h"
+#include "ContainerAllocator.h"
+#include "Debug.h"
+#include "Intrinsics.h"
+#include "Types.h"
+
+namespace SSSEngine
+{
+    namespace Detail
+    {
+        /**
+         * @brief Control byte of a slot. Full slots store the low 7 bits of the hash so they are never negative
+         */
+        enum class ControlByte : i8
+        {
+            Empty = -128,
+            Deleted = -2,
+        };
+
+        /**
+         * @brief The control bytes of 16 consecutive slots
+         */
+        class ControlGroup
+        {
+            public:
+            static constexpr size Width = 16;
+
+            SSSENGINE_FORCE_INLINE explicit ControlGroup(const i8 *control) noexcept :
+            m_control{_mm_load_si128(reinterpret_cast<const __m128i *>(control))}
+            {
+            }
+
+            /**
+             * @brief Bit i is set if slot i is full and its hash bits are h2
+             */
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE u32 Match(i8 h2) const noexcept
+            {
+                return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_control)));
+            }
+
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE u32 MatchEmpty() const noexcept
+            {
+                return Match(static_cast<i8>(ControlByte::Empty));
+            }
+
+            /**
+             * @brief Empty and deleted are the only negative control bytes, so their sign bits are enough
+             */
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE u32 MatchFree() const noexcept
+            {
+                return static_cast<u32>(_mm_movemask_epi8(m_control));
+            }
+
+            private:
+            __m128i m_control;
+        };
+
+        /**
+         * @brief Spreads the entropy of a hash over every bit. Hashes of integers are often the integer itself, which
+         * would leave the 7 bits of the control bytes always the same
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u64 MixHash(u64 hash) noexcept
+        {
+            hash *= 0x9E3779B97F4A7C15ull;
+            return hash ^ (hash >> 32);
+        }
+    } // namespace Detail
+
+    /**
+     * @class FlatHashMap
+     * @brief Hash map that stores its entries in one array split in groups of 16 slots
+     *
+     * A key is looked up in the groups of its probe sequence until a group with an empty slot is found. Removing
+     * leaves a tombstone only when the group of the slot is full, since no probe stops at a group with an empty slot.
+     * Inserting or removing can move the entries, so pointers to them are only valid until the next change.
+     */
+    template<typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>,
+             ContainerAllocatorConcept A = GlobalAllocator>
+    class FlatHashMap
+    {
+        public:
+        struct Entry
+        {
+            K Key;
+            V Value;
+        };
+
+        template<bool IsConst>
+        class BasicIterator
+        {
+            public:
+            using EntryType = std::conditional_t<IsConst, const Entry, Entry>;
+            using ControlType = std::conditional_t<IsConst, const i8, i8>;
+
+            BasicIterator(ControlType *control, EntryType *entry, ControlType *end) noexcept :
+            m_control{control}, m_entry{entry}, m_end{end}
+            {
+                SkipFree();
+            }
+
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE EntryType &operator*() const noexcept
+            {
+                return *m_entry;
+            }
+
+            SSSENGINE_PURE SSSENGINE_FORCE_INLINE EntryType *operator->() const noexcept
+            {
+                return m_entry;
+            }
+
+            BasicIterator &operator++() noexcept
+            {
+                ++m_control;
+                ++m_entry;
+                SkipFree();
+                return *this;
+            }
+
+            SSSENGINE_PURE bool operator==(const BasicIterator &other) const noexcept
+            {
+                return m_control == other.m_control;
+            }
+
+            private:
+            void SkipFree() noexcept
+            {
+                while(m_control != m_end && *m_control < 0)
+                {
+                    ++m_control;
+                    ++m_entry;
+                }
+            }
+
+            ControlType *m_control;
+            EntryType *m_entry;
+            ControlType *m_end;
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        FlatHashMap() noexcept(std::is_nothrow_default_constructible_v<A>) = default;
+
+        explicit FlatHashMap(const A &allocator) noexcept : m_allocator{allocator}
+        {
+        }
+
+        FlatHashMap(const FlatHashMap &other) : m_allocator{other.m_allocator}
+        {
+            Reserve(other.m_size);
+            for(const Entry &entry: other)
+            {
+                Emplace(entry.Key, entry.Value);
+            }
+        }
+
+        FlatHashMap(FlatHashMap &&other) noexcept :
+        m_control{std::exchange(other.m_control, nullptr)}, m_entries{std::exchange(other.m_entries, nullptr)},
+        m_capacity{std::exchange(other.m_capacity, 0)}, m_size{std::exchange(other.m_size, 0)},
+        m_growthLeft{std::exchange(other.m_growthLeft, 0)}, m_allocator{other.m_allocator}
+        {
+        }
+
+        FlatHashMap &operator=(const FlatHashMap &other)
+        {
+            if(this != &other)
+            {
+                Clear();
+                Reserve(other.m_size);
+                for(const Entry &entry: other)
+                {
+                    Emplace(entry.Key, entry.Value);
+                }
+            }
+            return *this;
+        }
+
+        FlatHashMap &operator=(FlatHashMap &&other) noexcept
+        {
+            if(this != &other)
+            {
+                Release();
+                m_control = std::exchange(other.m_control, nullptr);
+                m_entries = std::exchange(other.m_entries, nullptr);
+                m_capacity = std::exchange(other.m_capacity, 0);
+                m_size = std::exchange(other.m_size, 0);
+                m_growthLeft = std::exchange(other.m_growthLeft, 0);
+                m_allocator = other.m_allocator;
+            }
+            return *this;
+        }
+
+        ~FlatHashMap()
+        {
+            Release();
+        }
+
+        /**
+         * @return The value of key. nullptr if the map doesn't have it
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE V *Find(const K &key) noexcept
+        {
+            const size index = FindIndex(key);
+            return index != NotFound ? &m_entries[index].Value : nullptr;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const V *Find(const K &key) const noexcept
+        {
+            const size index = FindIndex(key);
+            return index != NotFound ? &m_entries[index].Value : nullptr;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool Contains(const K &key) const noexcept
+        {
+            return FindIndex(key) != NotFound;
+        }
+
+        /**
+         * @brief Constructs the value of key from args unless the map already has key
+         *
+         * @return The value of key and whether it was inserted
+         * @throws std::bad_alloc if growing failed
+         */
+        template<typename... Args>
+        std::pair<V *, bool> Emplace(const K &key, Args &&...args)
+        {
+            const u64 hash = HashKey(key);
+            if(const size index = FindIndex(key, hash); index != NotFound)
+            {
+                return {&m_entries[index].Value, false};
+            }
+
+            const size index = FindInsertSlot(hash);
+            Entry *entry = ::new(static_cast<void *>(m_entries + index)) Entry{key, V(std::forward<Args>(args)...)};
+
+            // NOTE: Only marked full once constructed so a throwing constructor leaves the map as it was
+            m_growthLeft -= m_control[index] == static_cast<i8>(Detail::ControlByte::Empty);
+            m_control[index] = static_cast<i8>(hash & 0x7F);
+            ++m_size;
+            return {&entry->Value, true};
+        }
+
+        /**
+         * @return The value of key, inserting a value initialized one if the map doesn't have it
+         */
+        SSSENGINE_FORCE_INLINE V &operator[](const K &key)
+        {
+            return *Emplace(key).first;
+        }
+
+        /**
+         * @return If key was in the map
+         */
+        bool Remove(const K &key) noexcept
+        {
+            const size index = FindIndex(key);
+            if(index == NotFound)
+            {
+                return false;
+            }
+
+            std::destroy_at(m_entries + index);
+            --m_size;
+
+            const size groupStart = index & ~(Detail::ControlGroup::Width - 1);
+            if(Detail::ControlGroup{m_control + groupStart}.MatchEmpty() != 0)
+            {
+                m_control[index] = static_cast<i8>(Detail::ControlByte::Empty);
+                ++m_growthLeft;
+            }
+            else
+            {
+                m_control[index] = static_cast<i8>(Detail::ControlByte::Deleted);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Removes every entry. The capacity is kept
+         */
+        void Clear() noexcept
+        {
+            if(m_capacity == 0)
+            {
+                return;
+            }
+
+            DestroyEntries();
+            std::memset(m_control, static_cast<i8>(Detail::ControlByte::Empty), m_capacity);
+            m_size = 0;
+            m_growthLeft = GetMaxLoad(m_capacity);
+        }
+
+        /**
+         * @brief Makes room for count entries without growing
+         */
+        void Reserve(size count)
+        {
+            if(count > m_size + m_growthLeft)
+            {
+                Rehash(GetCapacityFor(count));
+            }
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetSize() const noexcept
+        {
+            return m_size;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool IsEmpty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        SSSENGINE_PURE Iterator begin() noexcept
+        {
+            return {m_control, m_entries, m_control + m_capacity};
+        }
+
+        SSSENGINE_PURE Iterator end() noexcept
+        {
+            return {m_control + m_capacity, m_entries + m_capacity, m_control + m_capacity};
+        }
+
+        SSSENGINE_PURE ConstIterator begin() const noexcept
+        {
+            return {m_control, m_entries, m_control + m_capacity};
+        }
+
+        SSSENGINE_PURE ConstIterator end() const noexcept
+        {
+            return {m_control + m_capacity, m_entries + m_capacity, m_control + m_capacity};
+        }
+
+        private:
+        static constexpr size NotFound = static_cast<size>(-1);
+        static constexpr size GroupWidth = Detail::ControlGroup::Width;
+        static constexpr size Alignment = (std::max)(alignof(Entry), GroupWidth);
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE static u64 HashKey(const K &key) noexcept
+        {
+            return Detail::MixHash(static_cast<u64>(Hash{}(key)));
+        }
+
+        /**
+         * @brief 7/8 of the slots can be full before growing
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE static size GetMaxLoad(size capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        SSSENGINE_PURE static size GetCapacityFor(size count) noexcept
+        {
+            return (std::max)(std::bit_ceil(count + count / 7 + 1), GroupWidth);
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE static size GetEntriesOffset(size capacity) noexcept
+        {
+            return (capacity + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE static size GetAllocationSize(size capacity) noexcept
+        {
+            return GetEntriesOffset(capacity) + sizeof(Entry) * capacity;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size FindIndex(const K &key) const noexcept
+        {
+            return FindIndex(key, HashKey(key));
+        }
+
+        /**
+         * @brief Walks the groups with triangular steps, which visits every group once when their count is a power
+         * of 2
+         */
+        SSSENGINE_PURE size FindIndex(const K &key, u64 hash) const noexcept
+        {
+            if(m_capacity == 0)
+            {
+                return NotFound;
+            }
+
+            const i8 h2 = static_cast<i8>(hash & 0x7F);
+            const size groupMask = m_capacity / GroupWidth - 1;
+            size group = static_cast<size>(hash >> 7) & groupMask;
+            for(size step = 1;; ++step)
+            {
+                const size groupStart = group * GroupWidth;
+                const Detail::ControlGroup control{m_control + groupStart};
+                for(u32 matches = control.Match(h2); matches != 0; matches &= matches - 1)
+                {
+                    const size index = groupStart + static_cast<size>(std::countr_zero(matches));
+                    if(Equal{}(m_entries[index].Key, key)) [[likely]]
+                    {
+                        return index;
+                    }
+                }
+
+                if(control.MatchEmpty() != 0 || step > groupMask) [[likely]]
+                {
+                    return NotFound;
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        /**
+         * @brief Finds the slot a new entry with hash goes in, growing first if the map is at its maximum load
+         */
+        size FindInsertSlot(u64 hash)
+        {
+            if(m_growthLeft == 0) [[unlikely]]
+            {
+                // NOTE: Rehashing at the same capacity is enough to clear the tombstones when less than half the
+                // slots are in use
+                const bool mostlyTombstones = m_capacity != 0 && m_size < GetMaxLoad(m_capacity) / 2;
+                Rehash(mostlyTombstones ? m_capacity : GetCapacityFor(m_size + 1));
+            }
+
+            return FindFreeSlot(hash);
+        }
+
+        SSSENGINE_PURE size FindFreeSlot(u64 hash) const noexcept
+        {
+            const size groupMask = m_capacity / GroupWidth - 1;
+            size group = static_cast<size>(hash >> 7) & groupMask;
+            for(size step = 1;; ++step)
+            {
+                const size groupStart = group * GroupWidth;
+                if(const u32 free = Detail::ControlGroup{m_control + groupStart}.MatchFree(); free != 0)
+                {
+                    return groupStart + static_cast<size>(std::countr_zero(free));
+                }
+
+                SSSENGINE_ASSERT(step <= groupMask && "No free slot in the map");
+                group = (group + step) & groupMask;
+            }
+        }
+
+        SSSENGINE_NO_INLINE void Rehash(size capacity)
+        {
+            SSSENGINE_ASSERT(std::has_single_bit(capacity) && capacity >= GroupWidth);
+
+            void *memory = m_allocator.Allocate(GetAllocationSize(capacity), Alignment);
+            if(memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            i8 *const oldControl = m_control;
+            Entry *const oldEntries = m_entries;
+            const size oldCapacity = m_capacity;
+
+            m_control = static_cast<i8 *>(memory);
+            m_entries = reinterpret_cast<Entry *>(static_cast<byte *>(memory) + GetEntriesOffset(capacity));
+            m_capacity = capacity;
+            m_growthLeft = GetMaxLoad(capacity) - m_size;
+            std::memset(m_control, static_cast<i8>(Detail::ControlByte::Empty), capacity);
+
+            for(size i = 0; i < oldCapacity; ++i)
+            {
+                if(oldControl[i] < 0)
+                {
+                    continue;
+                }
+
+                const u64 hash = HashKey(oldEntries[i].Key);
+                const size index = FindFreeSlot(hash);
+                m_control[index] = static_cast<i8>(hash & 0x7F);
+                if constexpr(IsTriviallyRelocatableV<Entry>)
+                {
+                    std::memcpy(static_cast<void *>(m_entries + index), &oldEntries[i], sizeof(Entry));
+                }
+                else
+                {
+                    std::construct_at(m_entries + index, std::move(oldEntries[i]));
+                    std::destroy_at(oldEntries + i);
+                }
+            }
+
+            if(oldCapacity != 0)
+            {
+                m_allocator.Deallocate(oldControl, GetAllocationSize(oldCapacity), Alignment);
+            }
+        }
+
+        void DestroyEntries() noexcept
+        {
+            if constexpr(!std::is_trivially_destructible_v<Entry>)
+            {
+                for(size i = 0; i < m_capacity; ++i)
+                {
+                    if(m_control[i] >= 0)
+                    {
+                        std::destroy_at(m_entries + i);
+                    }
+                }
+            }
+        }
+
+        void Release() noexcept
+        {
+            if(m_capacity != 0)
+            {
+                DestroyEntries();
+                m_allocator.Deallocate(m_control, GetAllocationSize(m_capacity), Alignment);
+            }
+            m_control = nullptr;
+            m_entries = nullptr;
+            m_capacity = 0;
+            m_size = 0;
+            m_growthLeft = 0;
+        }
+
+        i8 *m_control{nullptr};
+        Entry *m_entries{nullptr};
+        size m_capacity{0};
+        size m_size{0};
+        size m_growthLeft{0};
+        SSSENGINE_NO_UNIQUE_ADDRESS A m_allocator{};
+    };
+} // namespace SSSEngine
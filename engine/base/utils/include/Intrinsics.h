@@ -24,16 +24,76 @@
 
 #pragma once
 
-#include <intrin.h>
-#include <immintrin.h>
-#include <ammintrin.h>
+#include "Types.h"
 
-// LOW_PRIORITY: Compiler specific intrinsics. Create as needed
 #ifdef SSSENGINE_MSVC
+    #include <intrin.h>
 #elif SSSENGINE_MINGW
+    #include <x86intrin.h>
 #endif
+#include <immintrin.h>
 
 // LOW_PRIORITY: Other intrinsics. Create as needed
 // INVESTIGATE: Naming convention
 using Vector128 = __m128;
 using Vector256 = __m256;
+
+#pragma region Instruction sets
+
+// NOTE: The instruction sets the current translation unit is compiled for. MSVC only defines __AVX__ and __AVX2__ so
+// the instruction sets implied by /arch:AVX and /arch:AVX2 are deduced from them
+#if defined(__SSE4_1__) || defined(__AVX__)
+    #define SSSENGINE_SIMD_SSE41
+#endif
+#ifdef __AVX__
+    #define SSSENGINE_SIMD_AVX
+#endif
+#if defined(__AVX2__)
+    #define SSSENGINE_SIMD_AVX2
+#endif
+#if defined(__FMA__) || (defined(SSSENGINE_MSVC) && defined(__AVX2__))
+    #define SSSENGINE_SIMD_FMA
+#endif
+#if defined(__F16C__) || (defined(SSSENGINE_MSVC) && defined(__AVX2__))
+    #define SSSENGINE_SIMD_F16C
+#endif
+
+// NOTE: Code that depends on the instruction set goes inside this namespace (as an inline namespace). Translation
+// units compiled for different instruction sets then never share a symbol, so the linker can't pick the AVX2 version
+// of a function for code that must run on any CPU
+#if defined(SSSENGINE_SIMD_AVX2)
+    #define SSSENGINE_SIMD_NAMESPACE Avx2
+#elif defined(SSSENGINE_SIMD_AVX)
+    #define SSSENGINE_SIMD_NAMESPACE Avx
+#else
+    #define SSSENGINE_SIMD_NAMESPACE Sse
+#endif
+
+#pragma endregion
+
+namespace SSSEngine
+{
+    /**
+     * @brief Instruction set levels, each one includes every level before it
+     */
+    enum class SimdLevel : u8
+    {
+        Sse2,
+        Sse42,
+        Avx,
+        // NOTE: Includes FMA and F16C
+        Avx2,
+        Avx512,
+    };
+
+    /**
+     * @brief The level the current translation unit is compiled for. The CPU must support at least this level
+     */
+#if defined(SSSENGINE_SIMD_AVX2)
+    inline constexpr SimdLevel CompiledSimdLevel = SimdLevel::Avx2;
+#elif defined(SSSENGINE_SIMD_AVX)
+    inline constexpr SimdLevel CompiledSimdLevel = SimdLevel::Avx;
+#else
+    inline constexpr SimdLevel CompiledSimdLevel = SimdLevel::Sse2;
+#endif
+} // namespace SSSEngine
@@ -0,0 +1,294 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Densely packed values addressed through generation checked keys
+ * The values live contiguously so iterating them is a linear walk. Keys go through a slot array that tracks where each
+ * value is, so values can be moved to keep them packed without invalidating the keys.
+ */
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include "Array.h"
+#include "Attributes.h"
+#include "ContainerAllocator.h"
+#include "Debug.h"
+#include "Types.h"
+
+namespace SSSEngine
+{
+    /**
+     * @class SlotMapKey
+     * @brief Index of a slot plus the generation of the slot when the value was inserted. Once the value is removed the
+     * generation of the slot changes and the key is stale, even if the slot holds a new value
+     *
+     */
+    template<typename T>
+    struct SlotMapKey
+    {
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+        u32 Index{InvalidIndex};
+        /**
+         * @brief Odd while the value is alive. 0 is never alive so default keys never match a slot
+         */
+        u32 Generation{0};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE constexpr bool IsValid() const noexcept
+        {
+            return Index != InvalidIndex;
+        }
+
+        constexpr bool operator==(const SlotMapKey &other) const noexcept = default;
+    };
+
+    /**
+     * @class SlotMap
+     * @brief Values packed in one array with O(1) insert, remove and lookup through keys
+     *
+     * Removing moves the last value into the hole, so the order of the values changes and pointers to them are only
+     * valid until the next insert or remove. Keys stay valid until their own value is removed.
+     */
+    template<typename T, ContainerAllocatorConcept A = GlobalAllocator>
+    class SlotMap
+    {
+        public:
+        using Key = SlotMapKey<T>;
+        using Iterator = T *;
+        using ConstIterator = const T *;
+
+        SlotMap() = default;
+
+        explicit SlotMap(const A &allocator) : m_values{allocator}, m_valueSlots{allocator}, m_slots{allocator}
+        {
+        }
+
+        /**
+         * @brief Constructs a value from args
+         *
+         * @return The key of the new value
+         */
+        template<typename... Args>
+        Key Emplace(Args &&...args)
+        {
+            const bool reuseSlot = m_freeHead != NoSlot;
+            const u32 slotIndex = reuseSlot ? m_freeHead : static_cast<u32>(m_slots.GetSize());
+
+            if(!reuseSlot)
+            {
+                m_slots.PushBack({});
+            }
+            m_valueSlots.PushBack(slotIndex);
+            try
+            {
+                m_values.EmplaceBack(std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                m_valueSlots.PopBack();
+                if(!reuseSlot)
+                {
+                    m_slots.PopBack();
+                }
+                throw;
+            }
+
+            if(reuseSlot)
+            {
+                m_freeHead = m_slots[slotIndex].ValueIndex;
+            }
+
+            Slot &slot = m_slots[slotIndex];
+            ++slot.Generation;
+            slot.ValueIndex = static_cast<u32>(m_values.GetSize() - 1);
+            return {slotIndex, slot.Generation};
+        }
+
+        SSSENGINE_FORCE_INLINE Key Insert(const T &value)
+        {
+            return Emplace(value);
+        }
+
+        SSSENGINE_FORCE_INLINE Key Insert(T &&value)
+        {
+            return Emplace(std::move(value));
+        }
+
+        /**
+         * @return If key was alive
+         */
+        bool Remove(Key key) noexcept
+        {
+            if(!Contains(key))
+            {
+                return false;
+            }
+
+            Slot &slot = m_slots[key.Index];
+            const u32 valueIndex = slot.ValueIndex;
+            const u32 lastIndex = static_cast<u32>(m_values.GetSize() - 1);
+            if(valueIndex != lastIndex)
+            {
+                // NOTE: Reconstructed instead of assigned so values only need to be move constructible
+                T *values = m_values.GetData();
+                std::destroy_at(values + valueIndex);
+                std::construct_at(values + valueIndex, std::move(values[lastIndex]));
+                m_valueSlots[valueIndex] = m_valueSlots[lastIndex];
+                m_slots[m_valueSlots[valueIndex]].ValueIndex = valueIndex;
+            }
+            m_values.PopBack();
+            m_valueSlots.PopBack();
+
+            ++slot.Generation;
+            slot.ValueIndex = m_freeHead;
+            m_freeHead = key.Index;
+            return true;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool Contains(Key key) const noexcept
+        {
+            return key.Index < m_slots.GetSize() && m_slots[key.Index].Generation == key.Generation &&
+                   (key.Generation & 1) == 1;
+        }
+
+        /**
+         * @return The value of key. nullptr if it was removed
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *Find(Key key) noexcept
+        {
+            return Contains(key) ? &m_values[m_slots[key.Index].ValueIndex] : nullptr;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T *Find(Key key) const noexcept
+        {
+            return Contains(key) ? &m_values[m_slots[key.Index].ValueIndex] : nullptr;
+        }
+
+        /**
+         * @brief The value of key, which must be alive
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T &operator[](Key key) noexcept
+        {
+            SSSENGINE_ASSERT(Contains(key) && "Stale slot map key");
+            return m_values[m_slots[key.Index].ValueIndex];
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T &operator[](Key key) const noexcept
+        {
+            SSSENGINE_ASSERT(Contains(key) && "Stale slot map key");
+            return m_values[m_slots[key.Index].ValueIndex];
+        }
+
+        /**
+         * @brief The key of the value at valueIndex in the packed values
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE Key GetKey(size valueIndex) const noexcept
+        {
+            const u32 slotIndex = m_valueSlots[valueIndex];
+            return {slotIndex, m_slots[slotIndex].Generation};
+        }
+
+        /**
+         * @brief Removes every value. Keys handed out before are stale afterwards
+         */
+        void Clear() noexcept
+        {
+            for(size i = 0; i < m_valueSlots.GetSize(); ++i)
+            {
+                Slot &slot = m_slots[m_valueSlots[i]];
+                ++slot.Generation;
+                slot.ValueIndex = m_freeHead;
+                m_freeHead = m_valueSlots[i];
+            }
+            m_values.Clear();
+            m_valueSlots.Clear();
+        }
+
+        void Reserve(size count)
+        {
+            m_values.Reserve(count);
+            m_valueSlots.Reserve(count);
+            m_slots.Reserve(count);
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *GetValues() noexcept
+        {
+            return m_values.GetData();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const T *GetValues() const noexcept
+        {
+            return m_values.GetData();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetSize() const noexcept
+        {
+            return m_values.GetSize();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool IsEmpty() const noexcept
+        {
+            return m_values.IsEmpty();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE Iterator begin() noexcept
+        {
+            return m_values.begin();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE Iterator end() noexcept
+        {
+            return m_values.end();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ConstIterator begin() const noexcept
+        {
+            return m_values.begin();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ConstIterator end() const noexcept
+        {
+            return m_values.end();
+        }
+
+        private:
+        static constexpr u32 NoSlot = std::numeric_limits<u32>::max();
+
+        struct Slot
+        {
+            /**
+             * @brief Where the value is while the slot is alive, the next free slot while it isn't
+             */
+            u32 ValueIndex{NoSlot};
+            u32 Generation{0};
+        };
+
+        Array<T, A> m_values;
+        /**
+         * @brief The slot of every value, to fix the slot of the value moved by Remove
+         */
+        Array<u32, A> m_valueSlots;
+        Array<Slot, A> m_slots;
+        u32 m_freeHead{NoSlot};
+    };
+} // namespace SSSEngine
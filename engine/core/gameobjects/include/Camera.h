@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "Quaternion.h"
 #include "Vector.h"
 
 namespace SSSEngine::Core::Gameobjects
@@ -35,9 +36,7 @@ namespace SSSEngine::Core::Gameobjects
      */
     struct Camera
     {
-        // TODO: This will need Quaternion instead of rotation. Maybe have transform as well but camera probably wont
-        // need a scale
         Math::Float3 position{};
-        Math::Float3 rotation{};
+        Math::Quaternionf rotation{};
     };
 } // namespace SSSEngine::Core::Gameobjects
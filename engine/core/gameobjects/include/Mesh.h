@@ -24,6 +24,11 @@
 
 #pragma once
 
+#include "Array.h"
+#include "Bounds.h"
+#include "BufferHandle.h"
+#include "HelperMacros.h"
+#include "SlotMap.h"
 #include "Types.h"
 
 namespace SSSEngine::Core::Gameobjects
@@ -34,21 +39,32 @@ namespace SSSEngine::Core::Gameobjects
         u32 startIndex{0};
         u32 baseVertexLocation{0};
 
-        // TODO: Bounding box
+        /**
+         * @brief In the space of the mesh. Use Math::TransformBoundingBox to cull it in world space
+         */
+        Math::BoundingBox bounds{};
     };
 
     struct MeshGeometry
     {
-        // TODO: This should not be void pointers but we need memory management before changing this
-        void *vertexBufferCpu = nullptr;
-        void *indexBufferCpu = nullptr;
-        void *vertexBufferGpu = nullptr;
-        void *indexBufferGpu = nullptr;
-        void *vertexBufferUploader = nullptr;
-        void *indexBufferUploader = nullptr;
+        Array<byte> vertexBufferCpu;
+        Array<byte> indexBufferCpu;
+        // NOTE: The upload buffers belong to the renderer, they only live until the copy to these finishes
+        Renderer::BufferHandle vertexBufferGpu{};
+        Renderer::BufferHandle indexBufferGpu{};
+
+        SlotMap<SubmeshData> submeshes;
 
         u32 vertexByteStride{0}, vertexBufferByteSize{0};
         // TODO: Index format / size (16, 32)
         u32 indexBufferByteSize{0};
     };
+
+    using MeshKey = SlotMapKey<MeshGeometry>;
+    using SubmeshKey = SlotMapKey<SubmeshData>;
+
+    /**
+     * @brief Every loaded mesh, packed so walking them each frame is linear in memory
+     */
+    SSSENGINE_GLOBAL SlotMap<MeshGeometry> Meshes;
 } // namespace SSSEngine::Core::Gameobjects
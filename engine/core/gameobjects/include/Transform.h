@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "Quaternion.h"
 #include "Vector.h"
 
 namespace SSSEngine::Core::Gameobjects
@@ -36,7 +37,7 @@ namespace SSSEngine::Core::Gameobjects
     struct Transform
     {
         Math::Float3 position;
-        Math::Float3 rotation; // TODO: Use quaternion
+        Math::Quaternionf rotation;
         Math::Float3 scale;
     };
 } // namespace SSSEngine::Core::Gameobjects
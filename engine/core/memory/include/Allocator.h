@@ -0,0 +1,113 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Interface for the engine allocators and an adapter to use them with standard containers
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include "Attributes.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class Allocator
+     * @brief Something engine containers can take memory from
+     *
+     */
+    class Allocator
+    {
+        public:
+        static constexpr size DefaultAlignment = alignof(std::max_align_t);
+
+        virtual ~Allocator() = default;
+
+        /**
+         * @brief Allocates uninitialized memory
+         *
+         * @param alignment Must be a power of 2
+         * @return The allocation. nullptr if it failed
+         */
+        SSSENGINE_PURE virtual void *Allocate(size bytes, size alignment = DefaultAlignment) = 0;
+
+        /**
+         * @brief Frees memory returned by Allocate
+         *
+         * @param memory Can be null
+         * @param bytes The size given to Allocate
+         */
+        virtual void Deallocate(void *memory, size bytes) = 0;
+    };
+
+    /**
+     * @class StdAllocator
+     * @brief Lets standard containers allocate from an Allocator
+     *
+     */
+    template<typename T>
+    class StdAllocator
+    {
+        public:
+        using value_type = T;
+
+        explicit StdAllocator(Allocator &allocator) noexcept : m_allocator{&allocator}
+        {
+        }
+
+        template<typename U>
+        StdAllocator(const StdAllocator<U> &other) noexcept : m_allocator{other.GetAllocator()}
+        {
+        }
+
+        SSSENGINE_PURE T *allocate(size count)
+        {
+            void *memory = m_allocator->Allocate(sizeof(T) * count, alignof(T));
+            if(memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            return static_cast<T *>(memory);
+        }
+
+        void deallocate(T *memory, size count) noexcept
+        {
+            m_allocator->Deallocate(memory, sizeof(T) * count);
+        }
+
+        SSSENGINE_PURE Allocator *GetAllocator() const noexcept
+        {
+            return m_allocator;
+        }
+
+        template<typename U>
+        bool operator==(const StdAllocator<U> &other) const noexcept
+        {
+            return m_allocator == other.GetAllocator();
+        }
+
+        private:
+        Allocator *m_allocator;
+    };
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,94 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Small copyable references that let engine containers, like Array and FlatHashMap, take memory from the
+ * engine allocators
+ */
+
+#pragma once
+
+#include "Allocator.h"
+#include "Arena.h"
+#include "Attributes.h"
+#include "FrameAllocator.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class ArenaRef
+     * @brief Allocates from an Arena. Nothing is given back until the arena is rolled back, so a growing container
+     * leaves its old buffers behind
+     *
+     */
+    struct ArenaRef
+    {
+        Arena *Source{nullptr};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Allocate(size bytes, size alignment) const
+        {
+            return Source->Push(bytes, alignment);
+        }
+
+        SSSENGINE_FORCE_INLINE void Deallocate(void *, size, size) const noexcept
+        {
+        }
+    };
+
+    /**
+     * @class FrameAllocatorRef
+     * @brief Allocates from a FrameAllocator. The container must not outlive the frame
+     *
+     */
+    struct FrameAllocatorRef
+    {
+        FrameAllocator *Source{nullptr};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Allocate(size bytes, size alignment) const
+        {
+            return Source->Allocate(bytes, alignment);
+        }
+
+        SSSENGINE_FORCE_INLINE void Deallocate(void *, size, size) const noexcept
+        {
+        }
+    };
+
+    /**
+     * @class AllocatorRef
+     * @brief Allocates from any Allocator, like a Heap
+     *
+     */
+    struct AllocatorRef
+    {
+        Allocator *Source{nullptr};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Allocate(size bytes, size alignment) const
+        {
+            return Source->Allocate(bytes, alignment);
+        }
+
+        SSSENGINE_FORCE_INLINE void Deallocate(void *memory, size bytes, size) const
+        {
+            Source->Deallocate(memory, bytes);
+        }
+    };
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,210 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Linear allocator over a reserved virtual range
+ * The whole range is reserved once and committed as it is used, so allocations never move and growing never copies.
+ * Memory is freed by rolling back to a marker or resetting, never one allocation at a time.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include "Attributes.h"
+#include "Bits.h"
+#include "Debug.h"
+#include "Memory.h"
+#include "MemoryTags.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class ArenaMarker
+     * @brief A position in an Arena to roll back to. Everything allocated after it is freed by Arena::PopTo
+     *
+     */
+    struct ArenaMarker
+    {
+        size Offset{0};
+    };
+
+    /**
+     * @class Arena
+     * @brief Bump allocator over a virtual range that commits pages on demand
+     *
+     * Destructors of the objects in the arena are never called, only trivially destructible types or types whose
+     * owner destroys them should live in it.
+     */
+    class Arena final
+    {
+        public:
+        /**
+         * @brief The default amount committed at once. Bigger steps mean fewer syscalls while growing
+         */
+        static constexpr size DefaultCommitStep = 64_KiB;
+
+        /**
+         * @brief Reserves the range. Nothing is committed until the first allocation
+         *
+         * @param reserveBytes The maximum size of the arena. Only address space, it can be much bigger than the memory
+         * that will be used
+         * @param tag The tag the committed memory is reported to
+         * @param commitStep The minimum amount to commit when growing. Rounded up to a power of 2 of at least a page
+         * @param kind The pages backing the arena. Huge commits the whole range right away
+         * @throws std::bad_alloc if the range couldn't be reserved
+         */
+        explicit Arena(size reserveBytes, MemoryTag tag = MemoryTag::General, size commitStep = DefaultCommitStep,
+                       Platform::PageKind kind = Platform::PageKind::Normal);
+        ~Arena();
+        Arena(const Arena &other) = delete;
+        Arena(Arena &&other) noexcept;
+        Arena &operator=(const Arena &other) = delete;
+        Arena &operator=(Arena &&other) noexcept;
+
+        /**
+         * @brief Allocates uninitialized memory
+         *
+         * @param bytes The size of the allocation
+         * @param alignment Must be a power of 2
+         * @return The allocation. nullptr if the reserved range is exhausted or committing failed
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Push(size bytes, size alignment = alignof(std::max_align_t))
+        {
+            SSSENGINE_ASSERT(IsPowerOfTwo(alignment));
+
+            const size offset = AlignUp(m_used, alignment);
+            // NOTE: Compared against the room left so that a huge request can't wrap the end around
+            if(offset > m_reserved || bytes > m_reserved - offset) [[unlikely]]
+            {
+                return nullptr;
+            }
+
+            const size end = offset + bytes;
+            if(end > m_committed) [[unlikely]]
+            {
+                if(!Grow(end))
+                {
+                    return nullptr;
+                }
+            }
+
+            m_used = end;
+            return m_base + offset;
+        }
+
+        /**
+         * @brief Allocates zeroed memory
+         */
+        SSSENGINE_PURE void *PushZeroed(size bytes, size alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Allocates an uninitialized array of count T
+         */
+        template<typename T>
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *PushArray(size count)
+        {
+            return static_cast<T *>(Push(sizeof(T) * count, alignof(T)));
+        }
+
+        /**
+         * @brief Constructs a T in the arena
+         *
+         * @return The object. nullptr if the allocation failed
+         */
+        template<typename T, typename... Args>
+        SSSENGINE_PURE T *New(Args &&...args)
+        {
+            void *memory = Push(sizeof(T), alignof(T));
+            return memory ? std::construct_at(static_cast<T *>(memory), std::forward<Args>(args)...) : nullptr;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ArenaMarker GetMarker() const noexcept
+        {
+            return {m_used};
+        }
+
+        /**
+         * @brief Frees everything allocated after the marker. The memory stays committed for the next allocations
+         */
+        SSSENGINE_FORCE_INLINE void PopTo(ArenaMarker marker) noexcept
+        {
+            SSSENGINE_ASSERT(marker.Offset <= m_used && "Marker is newer than the arena top");
+            m_used = marker.Offset;
+        }
+
+        /**
+         * @brief Frees everything. The memory stays committed for the next allocations
+         */
+        SSSENGINE_FORCE_INLINE void Reset() noexcept
+        {
+            m_used = 0;
+        }
+
+        /**
+         * @brief Gives the committed memory above the current top back to the OS, keeping at least keepBytes
+         * committed. Meant for after a big spike, e.g. when a level is unloaded
+         */
+        void Trim(size keepBytes = 0);
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetUsed() const noexcept
+        {
+            return m_used;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetCommitted() const noexcept
+        {
+            return m_committed;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetReserved() const noexcept
+        {
+            return m_reserved;
+        }
+
+        /**
+         * @brief Checks if address was allocated from this arena, freed or not
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool Owns(const void *address) const noexcept
+        {
+            const auto *pointer = static_cast<const byte *>(address);
+            return pointer >= m_base && pointer < m_base + m_reserved;
+        }
+
+        private:
+        /**
+         * @brief Commits enough memory for the top to reach end
+         */
+        SSSENGINE_NO_INLINE bool Grow(size end);
+
+        void Release() noexcept;
+
+        byte *m_base{nullptr};
+        size m_used{0};
+        size m_committed{0};
+        size m_reserved{0};
+        size m_commitStep{0};
+        Platform::PageKind m_kind{Platform::PageKind::Normal};
+        MemoryTag m_tag{MemoryTag::General};
+    };
+} // namespace SSSEngine::Core::Memory
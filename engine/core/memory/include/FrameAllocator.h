@@ -0,0 +1,181 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Transient allocator for data that lives until the frame that made it is retired
+ * There is one linear region per frame in flight. Threads take chunks of the current region and bump inside them
+ * without atomics, and a region is reused once the GPU is done with the frame that filled it.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include "Attributes.h"
+#include "Bits.h"
+#include "Constants.h"
+#include "Debug.h"
+#include "Memory.h"
+#include "MemoryTags.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class FrameAllocator
+     * @brief Ring of per frame linear regions, one per back buffer
+     *
+     * Allocate can be called from any thread. BeginFrame and Retire must be called from one thread while no other
+     * thread allocates. Destructors of the objects in it are never called.
+     */
+    class FrameAllocator final
+    {
+        public:
+        static constexpr size FrameCount = Renderer::BackBuffersAmount;
+
+        /**
+         * @brief The size threads take from the current region at once
+         */
+        static constexpr size DefaultChunkSize = 64_KiB;
+
+        /**
+         * @brief Reserves and commits every region up front, they are touched every frame anyway
+         *
+         * @param bytesPerFrame The budget of a single frame. Rounded up to the chunk size
+         * @param tag The tag the committed regions are reported to
+         * @param chunkSize Must be a power of 2. Bigger chunks mean less contention but more waste per thread
+         * @throws std::bad_alloc if the memory couldn't be committed
+         */
+        explicit FrameAllocator(size bytesPerFrame, MemoryTag tag = MemoryTag::Transient,
+                                size chunkSize = DefaultChunkSize);
+        ~FrameAllocator();
+        FrameAllocator(const FrameAllocator &other) = delete;
+        FrameAllocator(FrameAllocator &&other) = delete;
+        FrameAllocator &operator=(const FrameAllocator &other) = delete;
+        FrameAllocator &operator=(FrameAllocator &&other) = delete;
+
+        /**
+         * @brief Starts filling the region of frameIndex. The frame that used it before must be retired
+         */
+        void BeginFrame(u64 frameIndex);
+
+        /**
+         * @brief Marks the memory of frameIndex as no longer used, by the CPU or the GPU, so its region can be reused
+         */
+        void Retire(u64 frameIndex);
+
+        /**
+         * @brief Allocates uninitialized memory valid until the current frame is retired
+         *
+         * @param alignment Must be a power of 2
+         * @return The allocation. nullptr if the frame budget is exhausted or the current frame was already retired
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Allocate(size bytes, size alignment = alignof(std::max_align_t))
+        {
+            SSSENGINE_ASSERT(IsPowerOfTwo(alignment));
+
+            ThreadCursor &cursor = Cursors[m_cursorSlot];
+            if(cursor.Generation == m_generation) [[likely]]
+            {
+                const uintptr start = AlignUp(cursor.Current, static_cast<uintptr>(alignment));
+                if(start + bytes <= cursor.End)
+                {
+                    cursor.Current = start + bytes;
+                    return reinterpret_cast<void *>(start);
+                }
+            }
+
+            return AllocateSlow(bytes, alignment);
+        }
+
+        template<typename T>
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *AllocateArray(size count)
+        {
+            return static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        template<typename T, typename... Args>
+        SSSENGINE_PURE T *New(Args &&...args)
+        {
+            void *memory = Allocate(sizeof(T), alignof(T));
+            return memory ? std::construct_at(static_cast<T *>(memory), std::forward<Args>(args)...) : nullptr;
+        }
+
+        /**
+         * @brief The bytes taken from the region of the current frame, including the unused tails of thread chunks
+         */
+        SSSENGINE_PURE size GetUsed() const noexcept
+        {
+            return std::min(m_regions[m_current].Offset.load(std::memory_order_relaxed), m_bytesPerFrame);
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetBytesPerFrame() const noexcept
+        {
+            return m_bytesPerFrame;
+        }
+
+        private:
+        static constexpr u64 RetiredFrame = std::numeric_limits<u64>::max();
+
+        /**
+         * @brief The cursors each thread keeps. Allocators take turns picking one, so up to this many allocators can be
+         * used from a thread in turn without taking a new chunk on every switch
+         */
+        static constexpr u32 CursorSlots = 4;
+
+        /**
+         * @brief The chunk a thread bumps in. Only valid while Generation matches the one of the allocator
+         */
+        struct ThreadCursor
+        {
+            u64 Generation{0};
+            uintptr Current{0};
+            uintptr End{0};
+        };
+
+        struct alignas(Platform::CacheLineDestructive) Region
+        {
+            std::atomic<size> Offset{0};
+            u64 Frame{RetiredFrame};
+        };
+
+        /**
+         * @brief Takes a new chunk for the thread or, for big allocations, takes the memory straight from the region
+         */
+        SSSENGINE_NO_INLINE void *AllocateSlow(size bytes, size alignment);
+
+        // NOTE: Each allocator uses one slot of the thread. Generations are unique across allocators so a slot left by
+        // another allocator or frame is never used, only replaced
+        static thread_local ThreadCursor Cursors[CursorSlots];
+
+        byte *m_base{nullptr};
+        size m_bytesPerFrame{0};
+        size m_chunkSize{0};
+        u64 m_generation{0};
+        size m_current{0};
+        u32 m_cursorSlot{0};
+        MemoryTag m_tag{MemoryTag::Transient};
+        Region m_regions[FrameCount];
+    };
+} // namespace SSSEngine::Core::Memory
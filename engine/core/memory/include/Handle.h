@@ -0,0 +1,57 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Generational handles to objects owned by a Pool
+ */
+
+#pragma once
+
+#include <limits>
+#include "Attributes.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class Handle
+     * @brief Index of a pool slot plus the generation of the slot when the object was created. Once the object is
+     * destroyed the slot generation changes and the handle is stale, even if the slot holds a new object
+     *
+     */
+    template<typename T>
+    struct Handle
+    {
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+        u32 Index{InvalidIndex};
+        /**
+         * @brief Odd while the object is alive. 0 is never alive so default handles never match a slot
+         */
+        u32 Generation{0};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE constexpr bool IsValid() const noexcept
+        {
+            return Index != InvalidIndex;
+        }
+
+        constexpr bool operator==(const Handle &other) const noexcept = default;
+    };
+} // namespace SSSEngine::Core::Memory
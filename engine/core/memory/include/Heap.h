@@ -0,0 +1,156 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief General purpose engine heap with bounded latency
+ * A two level segregated fit (TLSF) allocator. Free blocks are bucketed by a power of 2 and 32 linear steps inside it,
+ * two bitmaps find the first non empty bucket that fits with a couple of bit scans, so allocating and freeing are O(1)
+ * whatever the state of the heap. Neighbouring free blocks are merged right away which keeps fragmentation low.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include "Allocator.h"
+#include "Attributes.h"
+#include "MemoryTags.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class Heap
+     * @brief Thread safe TLSF heap that grows in pools taken from Platform::AllocateMemory
+     *
+     * With the thread cache enabled, each thread keeps a few freed small blocks to reuse them without locking. A thread
+     * caches for a single heap, the first one with a cache it used, and the heap must outlive the threads using it.
+     */
+    class Heap final : public Allocator
+    {
+        public:
+        /**
+         * @brief Every allocation is aligned at least to this
+         */
+        static constexpr size MinimumAlignment = 16;
+        static constexpr size DefaultPoolSize = 64_MiB;
+
+        /**
+         * @param poolSize The size of the pools added when the heap runs out of memory. The first one is added on the
+         * first allocation
+         * @param tag The tag the allocations are reported to
+         * @param threadCache If the threads should keep freed small blocks to reuse them without locking
+         */
+        explicit Heap(size poolSize = DefaultPoolSize, MemoryTag tag = MemoryTag::General, bool threadCache = false);
+        ~Heap() override;
+        Heap(const Heap &other) = delete;
+        Heap(Heap &&other) = delete;
+        Heap &operator=(const Heap &other) = delete;
+        Heap &operator=(Heap &&other) = delete;
+
+        SSSENGINE_PURE void *Allocate(size bytes, size alignment = DefaultAlignment) override;
+        void Deallocate(void *memory, size bytes) override;
+
+        /**
+         * @brief Frees memory returned by Allocate, the heap knows the size of its blocks
+         */
+        void Free(void *memory);
+
+        /**
+         * @brief The usable size of an allocation, at least the size given to Allocate
+         */
+        SSSENGINE_PURE static size GetUsableSize(const void *memory) noexcept;
+
+        /**
+         * @brief The usable bytes of every allocated block, including the ones in thread caches
+         */
+        SSSENGINE_PURE size GetAllocatedBytes() const noexcept;
+
+        /**
+         * @brief The bytes taken from the OS
+         */
+        SSSENGINE_PURE size GetPoolBytes() const noexcept;
+
+        /**
+         * @brief Walks every block checking the links, the flags and the free lists. For tests and debugging
+         */
+        SSSENGINE_PURE bool CheckIntegrity() const;
+
+        private:
+        static constexpr u32 AlignmentLog2 = 4;
+        static constexpr u32 SecondLevelLog2 = 5;
+        static constexpr u32 SecondLevelCount = 1u << SecondLevelLog2;
+        static constexpr u32 FirstLevelShift = SecondLevelLog2 + AlignmentLog2;
+        static constexpr u32 FirstLevelMax = 38;
+        static constexpr u32 FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+
+        struct Block;
+        struct Pool;
+        struct ThreadCache;
+        struct ThreadCacheHolder;
+
+        /**
+         * @brief The lists a free block of bytes belongs to
+         */
+        static void MapInsert(size bytes, u32 &firstLevel, u32 &secondLevel) noexcept;
+
+        /**
+         * @brief The first lists whose blocks all fit bytes
+         */
+        static void MapSearch(size bytes, u32 &firstLevel, u32 &secondLevel) noexcept;
+
+        void *AllocateLocked(size bytes, size alignment);
+        void FreeLocked(Block *block);
+        /**
+         * @brief Takes a new region from the OS and lists its only block as free
+         *
+         * @return The free block, which holds at least minimumBytes. nullptr if the OS is out of memory
+         */
+        Block *AddPool(size minimumBytes);
+
+        void InsertFree(Block *block);
+        void RemoveFree(Block *block);
+        Block *FindFree(size bytes);
+
+        ThreadCache *GetThreadCache();
+        void ReleaseThreadCache(ThreadCache *cache);
+
+        static thread_local ThreadCacheHolder CurrentThreadCache;
+
+        mutable std::mutex m_mutex;
+        u32 m_firstLevelMap{0};
+        u32 m_secondLevelMaps[FirstLevelCount]{};
+        Block *m_freeLists[FirstLevelCount][SecondLevelCount]{};
+
+        Pool *m_pools{nullptr};
+        ThreadCache *m_threadCaches{nullptr};
+        size m_poolSize{0};
+        size m_poolBytes{0};
+        std::atomic<size> m_allocatedBytes{0};
+        MemoryTag m_tag{MemoryTag::General};
+        bool m_threadCache{false};
+    };
+
+    /**
+     * @brief The heap engine subsystems allocate from, with the thread cache enabled. The parallel algorithms take
+     * their temporary buffers from it
+     */
+    SSSENGINE_PURE Heap &GetEngineHeap();
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,153 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Live and peak memory per engine subsystem
+ * Every engine allocator carries a tag and reports what it takes to the tag counters. They are plain relaxed atomics
+ * so tracking never locks. Only compiled in when SSSENGINE_MEMORY_TRACKING is defined, otherwise tracking is a no-op.
+ */
+
+#pragma once
+
+#include <atomic>
+#include "Attributes.h"
+#include "Memory.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class MemoryTag
+     * @brief The subsystem an allocation belongs to
+     *
+     */
+    enum class MemoryTag : u8
+    {
+        General,
+        Renderer,
+        Audio,
+        Input,
+        Assets,
+        Gameplay,
+        Editor,
+        /**
+         * @brief Per frame scratch memory
+         */
+        Transient,
+        Count,
+    };
+
+    SSSENGINE_GLOBAL constexpr size MemoryTagCount = static_cast<size>(MemoryTag::Count);
+
+    /**
+     * @class MemoryTagStats
+     * @brief A snapshot of the counters of a tag
+     *
+     */
+    struct MemoryTagStats
+    {
+        /**
+         * @brief Bytes currently allocated
+         */
+        size LiveBytes{0};
+        /**
+         * @brief The most LiveBytes ever reached
+         */
+        size PeakBytes{0};
+        /**
+         * @brief Allocations made since startup
+         */
+        u64 AllocationCount{0};
+        /**
+         * @brief Allocations made during the last frame, see UpdateMemoryTags
+         */
+        u64 FrameAllocationCount{0};
+        /**
+         * @brief 0 when the tag has no budget
+         */
+        size Budget{0};
+    };
+
+    namespace Detail
+    {
+        struct alignas(Platform::CacheLineDestructive) MemoryTagCounters
+        {
+            std::atomic<size> LiveBytes{0};
+            std::atomic<size> PeakBytes{0};
+            std::atomic<u64> AllocationCount{0};
+            std::atomic<u64> FrameAllocationCount{0};
+            u64 LastFrameAllocationCount{0};
+            size Budget{0};
+            bool OverBudget{false};
+        };
+
+        SSSENGINE_GLOBAL MemoryTagCounters TagCounters[MemoryTagCount];
+    } // namespace Detail
+
+    /**
+     * @brief Reports bytes allocated for tag
+     */
+    SSSENGINE_FORCE_INLINE void TrackAllocation([[maybe_unused]] MemoryTag tag, [[maybe_unused]] size bytes) noexcept
+    {
+#ifdef SSSENGINE_MEMORY_TRACKING
+        auto &counters = Detail::TagCounters[static_cast<size>(tag)];
+        const size live = counters.LiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.FrameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        size peak = counters.PeakBytes.load(std::memory_order_relaxed);
+        while(live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+#endif
+    }
+
+    /**
+     * @brief Reports bytes of tag given back
+     */
+    SSSENGINE_FORCE_INLINE void TrackFree([[maybe_unused]] MemoryTag tag, [[maybe_unused]] size bytes) noexcept
+    {
+#ifdef SSSENGINE_MEMORY_TRACKING
+        Detail::TagCounters[static_cast<size>(tag)].LiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+#endif
+    }
+
+    SSSENGINE_PURE const wchar_t *GetMemoryTagName(MemoryTag tag);
+
+    SSSENGINE_PURE MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+
+    /**
+     * @brief Sets the bytes tag should stay under. UpdateMemoryTags warns when it goes over. 0 removes the budget
+     */
+    void SetMemoryBudget(MemoryTag tag, size bytes);
+
+    /**
+     * @brief Closes the frame for the counters. Call once per frame from one thread. Warns about the tags that went
+     * over their budget since the last call
+     *
+     * @return True if any tag is over its budget
+     */
+    bool UpdateMemoryTags();
+
+    /**
+     * @brief Logs the counters of every tag
+     */
+    void DumpMemoryTags();
+} // namespace SSSEngine::Core::Memory
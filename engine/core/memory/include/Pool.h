@@ -0,0 +1,302 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Fixed capacity object pool handing out generational handles
+ * Objects live in a reserved range committed a slab at a time, so they never move. The generations and the free list
+ * links live in a separate dense array, checking a handle touches 8 bytes instead of the object's cache lines. Free
+ * slots form a lock-free stack so creating and destroying from many threads is O(1), only committing a new slab locks.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Attributes.h"
+#include "Bits.h"
+#include "Debug.h"
+#include "Handle.h"
+#include "Memory.h"
+#include "MemoryTags.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @class Pool
+     * @brief Thread safe pool of T with a fixed maximum capacity
+     *
+     * Accessing an object while another thread destroys it is a race, the pool only keeps its own bookkeeping safe.
+     */
+    template<typename T>
+    class Pool final
+    {
+        public:
+        /**
+         * @brief The amount of objects committed at once when the pool grows, in bytes
+         */
+        static constexpr size SlabSize = 64_KiB;
+
+        /**
+         * @brief Reserves the slots. Nothing is committed until the first object is created
+         *
+         * @param tag The tag the live objects are reported to
+         * @throws std::bad_alloc if the range couldn't be reserved
+         */
+        explicit Pool(u32 capacity, MemoryTag tag = MemoryTag::General) :
+        m_capacity{capacity}, m_tag{tag}, m_objectBytes{AlignUp(static_cast<size>(capacity) * sizeof(T), SlabSize)},
+        m_reservedBytes{m_objectBytes + AlignUp(static_cast<size>(capacity) * sizeof(SlotState), SlabSize)}
+        {
+            SSSENGINE_ASSERT(capacity < Handle<T>::InvalidIndex);
+            SSSENGINE_STATIC_ASSERT(alignof(T) <= SlabSize, "Pool objects can't be aligned beyond a slab")
+
+            auto *const base = static_cast<byte *>(Platform::ReserveAddressSpace(m_reservedBytes));
+            if(base == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            m_objects = reinterpret_cast<T *>(base);
+            m_states = reinterpret_cast<SlotState *>(base + m_objectBytes);
+        }
+
+        ~Pool()
+        {
+            const u32 committed = m_committed.load(std::memory_order_acquire);
+            for(u32 i = 0; i < committed; ++i)
+            {
+                if(IsAliveGeneration(m_states[i].Generation.load(std::memory_order_relaxed)))
+                {
+                    std::destroy_at(GetObject(i));
+                    TrackFree(m_tag, sizeof(T));
+                }
+            }
+
+            Platform::ReleaseAddressSpace(m_objects, m_reservedBytes);
+        }
+
+        Pool(const Pool &other) = delete;
+        Pool(Pool &&other) = delete;
+        Pool &operator=(const Pool &other) = delete;
+        Pool &operator=(Pool &&other) = delete;
+
+        /**
+         * @brief Constructs a T in a free slot
+         *
+         * @return The handle of the object. An invalid handle if the pool is full
+         * @throws Whatever the constructor of T throws, the slot stays free
+         */
+        template<typename... Args>
+        SSSENGINE_PURE Handle<T> Create(Args &&...args)
+        {
+            u32 index = PopFree();
+            if(index == Handle<T>::InvalidIndex)
+            {
+                // NOTE: The slot is committed before it is claimed, so a full pool or a failed commit never moves the
+                // counter past the slots that can be handed out
+                index = m_used.load(std::memory_order_relaxed);
+                do
+                {
+                    if(index >= m_capacity || !EnsureCommitted(index))
+                    {
+                        return {};
+                    }
+                } while(!m_used.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+            }
+
+            try
+            {
+                std::construct_at(GetObject(index), std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                // NOTE: The generation didn't change, so the slot goes back as the free slot it was
+                PushFree(index);
+                throw;
+            }
+
+            SlotState &state = m_states[index];
+            const u32 generation = state.Generation.load(std::memory_order_relaxed) + 1;
+            state.Generation.store(generation, std::memory_order_release);
+            TrackAllocation(m_tag, sizeof(T));
+            return {.Index = index, .Generation = generation};
+        }
+
+        /**
+         * @brief Destroys the object and frees its slot. Every handle to it becomes stale
+         */
+        void Destroy(Handle<T> handle)
+        {
+            SSSENGINE_ASSERT(IsAlive(handle) && "Destroying a stale handle");
+
+            std::destroy_at(GetObject(handle.Index));
+            m_states[handle.Index].Generation.store(handle.Generation + 1, std::memory_order_release);
+            PushFree(handle.Index);
+            TrackFree(m_tag, sizeof(T));
+        }
+
+        /**
+         * @brief Checks if the object of the handle was not destroyed
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE bool IsAlive(Handle<T> handle) const noexcept
+        {
+            return handle.Index < m_committed.load(std::memory_order_acquire) &&
+                   m_states[handle.Index].Generation.load(std::memory_order_acquire) == handle.Generation &&
+                   IsAliveGeneration(handle.Generation);
+        }
+
+        /**
+         * @brief The object of a handle that must be alive. Stale handles are only caught in assertion builds
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *Get(Handle<T> handle) const noexcept
+        {
+            SSSENGINE_ASSERT(IsAlive(handle) && "Accessing a stale handle");
+            return GetObject(handle.Index);
+        }
+
+        /**
+         * @brief The object of the handle or nullptr if it was destroyed
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *TryGet(Handle<T> handle) const noexcept
+        {
+            return IsAlive(handle) ? GetObject(handle.Index) : nullptr;
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u32 GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        private:
+        static constexpr size CacheLine = Platform::CacheLineDestructive;
+        static constexpr u32 SlabSlots = static_cast<u32>(std::max<size>(SlabSize / sizeof(T), 1));
+
+        /**
+         * @brief The bookkeeping of a slot. Generations are odd while the object is alive
+         */
+        struct SlotState
+        {
+            std::atomic<u32> Generation{0};
+            std::atomic<u32> NextFree{Handle<T>::InvalidIndex};
+        };
+
+        /**
+         * @brief Packs the free list top with a counter that changes on every update, so a top that was popped and
+         * pushed back in between is not mistaken for an unchanged one (ABA)
+         */
+        static constexpr u64 PackHead(u32 index, u64 previous) noexcept
+        {
+            return ((previous >> 32) + 1) << 32 | index;
+        }
+
+        static constexpr bool IsAliveGeneration(u32 generation) noexcept
+        {
+            return (generation & 1) != 0;
+        }
+
+        SSSENGINE_FORCE_INLINE T *GetObject(u32 index) const noexcept
+        {
+            return std::launder(m_objects + index);
+        }
+
+        u32 PopFree() noexcept
+        {
+            u64 head = m_freeHead.load(std::memory_order_acquire);
+            while(static_cast<u32>(head) != Handle<T>::InvalidIndex)
+            {
+                // NOTE: The slot may be popped by another thread meanwhile, then the exchange fails. Slots are never
+                // decommitted so reading it is always safe
+                const u32 index = static_cast<u32>(head);
+                const u32 next = m_states[index].NextFree.load(std::memory_order_relaxed);
+                if(m_freeHead.compare_exchange_weak(
+                       head, PackHead(next, head), std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    return index;
+                }
+            }
+
+            return Handle<T>::InvalidIndex;
+        }
+
+        void PushFree(u32 index) noexcept
+        {
+            u64 head = m_freeHead.load(std::memory_order_relaxed);
+            do
+            {
+                m_states[index].NextFree.store(static_cast<u32>(head), std::memory_order_relaxed);
+            } while(!m_freeHead.compare_exchange_weak(
+                head, PackHead(index, head), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        SSSENGINE_FORCE_INLINE bool EnsureCommitted(u32 index)
+        {
+            return index < m_committed.load(std::memory_order_acquire) || Grow(index);
+        }
+
+        /**
+         * @brief Commits the next slab of objects and their states. Committing is idempotent so the pages shared with
+         * the previous slab are just committed again. The states are constructed before the slab is published, so
+         * every slot below the committed count has a readable state
+         */
+        SSSENGINE_NO_INLINE bool Grow(u32 index)
+        {
+            std::scoped_lock lock{m_growMutex};
+
+            const u32 committed = m_committed.load(std::memory_order_relaxed);
+            if(index < committed)
+            {
+                return true;
+            }
+
+            const u32 target = std::min((index / SlabSlots + 1) * SlabSlots, m_capacity);
+            const auto commit = [](void *base, size from, size to)
+            {
+                const size start = AlignDown(from, Platform::GetPageSize());
+                return Platform::Commit(static_cast<byte *>(base) + start, to - start);
+            };
+            if(!commit(m_objects, committed * sizeof(T), target * sizeof(T)) ||
+               !commit(m_states, committed * sizeof(SlotState), target * sizeof(SlotState)))
+            {
+                return false;
+            }
+
+            std::uninitialized_default_construct(m_states + committed, m_states + target);
+            m_committed.store(target, std::memory_order_release);
+            return true;
+        }
+
+        T *m_objects{nullptr};
+        SlotState *m_states{nullptr};
+        u32 m_capacity{0};
+        MemoryTag m_tag{MemoryTag::General};
+        size m_objectBytes{0};
+        size m_reservedBytes{0};
+
+        alignas(CacheLine) std::atomic<u64> m_freeHead{Handle<T>::InvalidIndex};
+        alignas(CacheLine) std::atomic<u32> m_used{0};
+        std::atomic<u32> m_committed{0};
+        std::mutex m_growMutex;
+    };
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,127 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Per thread scratch memory for temporaries that don't outlive a function
+ * Every thread has its own Arena over a reserved range, created on first use. A ScratchScope remembers the top of the
+ * arena and rolls back to it when it goes out of scope, so nothing has to be freed by hand and no locks are taken.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include "Arena.h"
+#include "Attributes.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Memory
+{
+    /**
+     * @brief The address space reserved for the scratch arena of each thread. Only the used part is committed
+     */
+    constexpr size ThreadScratchSize = 256_MiB;
+
+    /**
+     * @brief The scratch arena of the calling thread. Created on the first call and released when the thread exits
+     */
+    SSSENGINE_PURE Arena &GetThreadScratch();
+
+    /**
+     * @brief Gives the committed scratch memory of the calling thread back to the OS, keeping at least keepBytes.
+     * Meant for after a spike, must not be called while a ScratchScope is alive in this thread
+     */
+    void TrimThreadScratch(size keepBytes = 0);
+
+    /**
+     * @class ScratchScope
+     * @brief Allocates from the scratch arena of the thread and frees everything allocated through it when destroyed
+     *
+     * Scopes nest like the stack, an inner scope must be destroyed before the outer one allocates again. Memory from a
+     * scope must not be returned from the function that created it or handed to another thread. Destructors of the
+     * objects are never called.
+     *
+     * @code
+     * ScratchScope scratch;
+     * auto *values = scratch.Alloc<f32>(count);
+     * @endcode
+     */
+    class ScratchScope final
+    {
+        public:
+        SSSENGINE_FORCE_INLINE ScratchScope() : m_arena{GetThreadScratch()}, m_marker{m_arena.GetMarker()}
+        {
+        }
+
+        SSSENGINE_FORCE_INLINE ~ScratchScope()
+        {
+            m_arena.PopTo(m_marker);
+        }
+
+        ScratchScope(const ScratchScope &other) = delete;
+        ScratchScope(ScratchScope &&other) = delete;
+        ScratchScope &operator=(const ScratchScope &other) = delete;
+        ScratchScope &operator=(ScratchScope &&other) = delete;
+
+        /**
+         * @brief Allocates uninitialized memory
+         *
+         * @param bytes The size of the allocation
+         * @param alignment Must be a power of 2
+         * @return The allocation. nullptr if the scratch range is exhausted
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE void *Push(size bytes, size alignment = alignof(std::max_align_t))
+        {
+            return m_arena.Push(bytes, alignment);
+        }
+
+        /**
+         * @brief Allocates an uninitialized array of count T
+         */
+        template<typename T>
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE T *Alloc(size count = 1)
+        {
+            return m_arena.PushArray<T>(count);
+        }
+
+        /**
+         * @brief Constructs a T in the scratch memory
+         *
+         * @return The object. nullptr if the allocation failed
+         */
+        template<typename T, typename... Args>
+        SSSENGINE_PURE T *New(Args &&...args)
+        {
+            return m_arena.New<T>(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief The bytes allocated through this scope and the scopes nested in it
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetUsed() const noexcept
+        {
+            return m_arena.GetUsed() - m_marker.Offset;
+        }
+
+        private:
+        Arena &m_arena;
+        ArenaMarker m_marker;
+    };
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,137 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Reserving, growing and releasing the address range of an Arena. Pushing stays inline in the header
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include "Arena.h"
+
+namespace SSSEngine::Core::Memory
+{
+    Arena::Arena(size reserveBytes, MemoryTag tag, size commitStep, Platform::PageKind kind) :
+    m_commitStep{std::bit_ceil(std::max(commitStep, Platform::GetPageSize()))}, m_kind{kind}, m_tag{tag}
+    {
+        const size pageSize = kind == Platform::PageKind::Normal ? Platform::GetPageSize() : Platform::HugePageSize;
+        m_reserved = AlignUp(reserveBytes, pageSize);
+        m_base = static_cast<byte *>(Platform::ReserveAddressSpace(m_reserved, kind));
+        if(m_base == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        if(kind == Platform::PageKind::Huge)
+        {
+            m_committed = m_reserved;
+            TrackAllocation(m_tag, m_committed);
+        }
+    }
+
+    Arena::~Arena()
+    {
+        Release();
+    }
+
+    Arena::Arena(Arena &&other) noexcept :
+    m_base{std::exchange(other.m_base, nullptr)}, m_used{std::exchange(other.m_used, 0)},
+    m_committed{std::exchange(other.m_committed, 0)}, m_reserved{std::exchange(other.m_reserved, 0)},
+    m_commitStep{other.m_commitStep}, m_kind{other.m_kind}, m_tag{other.m_tag}
+    {
+    }
+
+    Arena &Arena::operator=(Arena &&other) noexcept
+    {
+        if(this != &other)
+        {
+            Release();
+            m_base = std::exchange(other.m_base, nullptr);
+            m_used = std::exchange(other.m_used, 0);
+            m_committed = std::exchange(other.m_committed, 0);
+            m_reserved = std::exchange(other.m_reserved, 0);
+            m_commitStep = other.m_commitStep;
+            m_kind = other.m_kind;
+            m_tag = other.m_tag;
+        }
+
+        return *this;
+    }
+
+    void *Arena::PushZeroed(size bytes, size alignment)
+    {
+        // NOTE: Pages are zeroed when committed but memory reused after PopTo or Reset is not
+        void *memory = Push(bytes, alignment);
+        if(memory != nullptr)
+        {
+            std::memset(memory, 0, bytes);
+        }
+
+        return memory;
+    }
+
+    void Arena::Trim(size keepBytes)
+    {
+        if(m_kind == Platform::PageKind::Huge)
+        {
+            return;
+        }
+
+        const size keep = AlignUp(std::max(m_used, keepBytes), Platform::GetPageSize());
+        if(keep >= m_committed)
+        {
+            return;
+        }
+
+        Platform::Decommit(m_base + keep, m_committed - keep);
+        TrackFree(m_tag, m_committed - keep);
+        m_committed = keep;
+    }
+
+    bool Arena::Grow(size end)
+    {
+        if(end > m_reserved)
+        {
+            return false;
+        }
+
+        // NOTE: Commit in steps so that a run of small allocations doesn't make a syscall per page
+        const size target = std::min(AlignUp(end, m_commitStep), m_reserved);
+        if(!Platform::Commit(m_base + m_committed, target - m_committed))
+        {
+            return false;
+        }
+
+        TrackAllocation(m_tag, target - m_committed);
+        m_committed = target;
+        return true;
+    }
+
+    void Arena::Release() noexcept
+    {
+        if(m_base != nullptr)
+        {
+            Platform::ReleaseAddressSpace(m_base, m_reserved, m_kind);
+            TrackFree(m_tag, m_committed);
+            m_base = nullptr;
+        }
+    }
+} // namespace SSSEngine::Core::Memory
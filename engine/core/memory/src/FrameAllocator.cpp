@@ -0,0 +1,125 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <new>
+#include "FrameAllocator.h"
+
+namespace SSSEngine::Core::Memory
+{
+    namespace
+    {
+        // NOTE: 0 is never handed out so that a new thread cursor is always stale
+        std::atomic<u64> NextGeneration{1};
+        std::atomic<u32> NextCursorSlot{0};
+    } // namespace
+
+    thread_local FrameAllocator::ThreadCursor FrameAllocator::Cursors[CursorSlots];
+
+    FrameAllocator::FrameAllocator(size bytesPerFrame, MemoryTag tag, size chunkSize) :
+    m_bytesPerFrame{AlignUp(bytesPerFrame, AlignUp(chunkSize, Platform::GetPageSize()))}, m_chunkSize{chunkSize},
+    m_cursorSlot{NextCursorSlot.fetch_add(1, std::memory_order_relaxed) % CursorSlots}, m_tag{tag}
+    {
+        SSSENGINE_ASSERT(IsPowerOfTwo(chunkSize));
+
+        const size totalBytes = m_bytesPerFrame * FrameCount;
+        m_base = static_cast<byte *>(Platform::ReserveAddressSpace(totalBytes));
+        if(m_base == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        if(!Platform::Commit(m_base, totalBytes))
+        {
+            Platform::ReleaseAddressSpace(m_base, totalBytes);
+            throw std::bad_alloc();
+        }
+        TrackAllocation(m_tag, totalBytes);
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        Platform::ReleaseAddressSpace(m_base, m_bytesPerFrame * FrameCount);
+        TrackFree(m_tag, m_bytesPerFrame * FrameCount);
+    }
+
+    void FrameAllocator::BeginFrame(u64 frameIndex)
+    {
+        Region &region = m_regions[frameIndex % FrameCount];
+        SSSENGINE_ASSERT(region.Frame == RetiredFrame && "The frame that used this region was not retired");
+
+        region.Frame = frameIndex;
+        region.Offset.store(0, std::memory_order_relaxed);
+        m_current = frameIndex % FrameCount;
+        m_generation = NextGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void FrameAllocator::Retire(u64 frameIndex)
+    {
+        Region &region = m_regions[frameIndex % FrameCount];
+        SSSENGINE_ASSERT(region.Frame == frameIndex && "Retiring a frame that is not in flight");
+
+        region.Frame = RetiredFrame;
+        if(frameIndex % FrameCount == m_current)
+        {
+            // NOTE: The cursors of the threads still point into the region, a new generation makes them all stale
+            m_generation = NextGeneration.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void *FrameAllocator::AllocateSlow(size bytes, size alignment)
+    {
+        Region &region = m_regions[m_current];
+        if(region.Frame == RetiredFrame)
+        {
+            return nullptr;
+        }
+
+        byte *const regionBase = m_base + m_current * m_bytesPerFrame;
+
+        // NOTE: Anything bigger than a quarter chunk would waste too much of a fresh chunk, so it gets its own range
+        if(bytes + alignment > m_chunkSize / 4)
+        {
+            const size padded = bytes + alignment - 1;
+            const size offset = region.Offset.fetch_add(padded, std::memory_order_relaxed);
+            if(offset + padded > m_bytesPerFrame)
+            {
+                return nullptr;
+            }
+
+            const auto start = reinterpret_cast<uintptr>(regionBase + offset);
+            return reinterpret_cast<void *>(AlignUp(start, static_cast<uintptr>(alignment)));
+        }
+
+        const size offset = region.Offset.fetch_add(m_chunkSize, std::memory_order_relaxed);
+        if(offset + m_chunkSize > m_bytesPerFrame)
+        {
+            return nullptr;
+        }
+
+        const auto start = reinterpret_cast<uintptr>(regionBase + offset);
+        const uintptr aligned = AlignUp(start, static_cast<uintptr>(alignment));
+        Cursors[m_cursorSlot] = {.Generation = m_generation, .Current = aligned + bytes, .End = start + m_chunkSize};
+        return reinterpret_cast<void *>(aligned);
+    }
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,675 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <algorithm>
+#include <bit>
+#include "Heap.h"
+#include "Bits.h"
+#include "Debug.h"
+#include "Memory.h"
+
+namespace SSSEngine::Core::Memory
+{
+    namespace
+    {
+        constexpr size HeaderSize = 16;
+
+        /**
+         * @brief The smallest block that can hold the free list links
+         */
+        constexpr size MinimumBlockSize = 2 * sizeof(void *);
+
+        SSSENGINE_FORCE_INLINE size AdjustRequest(size bytes)
+        {
+            return std::max(AlignUp(bytes, Heap::MinimumAlignment), MinimumBlockSize);
+        }
+    } // namespace
+
+    /**
+     * @brief Physical block header. The free list links overlap the first user bytes, so they only exist while the
+     * block is free. The size is a multiple of 16, which leaves its low bits for the flags
+     */
+    struct Heap::Block
+    {
+        static constexpr size FreeFlag = 1;
+        static constexpr size PreviousFreeFlag = 2;
+        static constexpr size FlagMask = FreeFlag | PreviousFreeFlag;
+
+        /**
+         * @brief Only valid while the previous block is free
+         */
+        Block *PreviousPhysical;
+        /**
+         * @brief Atomic because the owner of a used block reads it without the lock while freeing a neighbour changes
+         * its flags under the lock. Every write holds the lock
+         */
+        std::atomic<size> SizeAndFlags;
+        Block *NextFree;
+        Block *PreviousFree;
+
+        SSSENGINE_FORCE_INLINE size GetSize() const noexcept
+        {
+            return SizeAndFlags.load(std::memory_order_relaxed) & ~FlagMask;
+        }
+
+        SSSENGINE_FORCE_INLINE void SetSizeAndFlags(size bytes, size flags) noexcept
+        {
+            SizeAndFlags.store(bytes | flags, std::memory_order_relaxed);
+        }
+
+        SSSENGINE_FORCE_INLINE void SetSize(size bytes) noexcept
+        {
+            SetSizeAndFlags(bytes, SizeAndFlags.load(std::memory_order_relaxed) & FlagMask);
+        }
+
+        SSSENGINE_FORCE_INLINE bool IsFree() const noexcept
+        {
+            return (SizeAndFlags.load(std::memory_order_relaxed) & FreeFlag) != 0;
+        }
+
+        SSSENGINE_FORCE_INLINE bool IsPreviousFree() const noexcept
+        {
+            return (SizeAndFlags.load(std::memory_order_relaxed) & PreviousFreeFlag) != 0;
+        }
+
+        SSSENGINE_FORCE_INLINE void SetFlag(size flag, bool value) noexcept
+        {
+            const size current = SizeAndFlags.load(std::memory_order_relaxed);
+            SizeAndFlags.store(value ? current | flag : current & ~flag, std::memory_order_relaxed);
+        }
+
+        SSSENGINE_FORCE_INLINE void SetFree(bool free) noexcept
+        {
+            SetFlag(FreeFlag, free);
+        }
+
+        SSSENGINE_FORCE_INLINE void SetPreviousFree(bool free) noexcept
+        {
+            SetFlag(PreviousFreeFlag, free);
+        }
+
+        SSSENGINE_FORCE_INLINE byte *GetMemory() noexcept
+        {
+            return reinterpret_cast<byte *>(this) + HeaderSize;
+        }
+
+        SSSENGINE_FORCE_INLINE Block *GetNextPhysical() noexcept
+        {
+            return reinterpret_cast<Block *>(GetMemory() + GetSize());
+        }
+
+        SSSENGINE_FORCE_INLINE static Block *FromMemory(const void *memory) noexcept
+        {
+            return reinterpret_cast<Block *>(static_cast<byte *>(const_cast<void *>(memory)) - HeaderSize);
+        }
+    };
+
+    /**
+     * @brief Start of every region taken from the OS. The blocks follow it and a zero sized used block ends it, so
+     * walking the blocks and merging never leaves the pool
+     */
+    struct alignas(16) Heap::Pool
+    {
+        Pool *Next;
+        size Bytes;
+    };
+
+    /**
+     * @brief Freed small blocks of a thread, one singly linked list per size. The links are in the user bytes
+     */
+    struct Heap::ThreadCache
+    {
+        static constexpr size MaximumSize = 256;
+        static constexpr size BinCount = MaximumSize / MinimumAlignment;
+        static constexpr u32 BinCapacity = 64;
+        static constexpr u32 RefillCount = 8;
+
+        static constexpr size GetBin(size bytes) noexcept
+        {
+            return bytes / MinimumAlignment - 1;
+        }
+
+        Block *Bins[BinCount]{};
+        u32 Counts[BinCount]{};
+        std::atomic<Heap *> Owner{nullptr};
+        ThreadCache *Next{nullptr};
+    };
+
+    /**
+     * @brief Gives the blocks of the thread back to the heap when the thread exits
+     */
+    struct Heap::ThreadCacheHolder
+    {
+        ThreadCache *Cache{nullptr};
+
+        ~ThreadCacheHolder()
+        {
+            if(Cache == nullptr)
+            {
+                return;
+            }
+
+            if(Heap *owner = Cache->Owner.load(std::memory_order_acquire))
+            {
+                owner->ReleaseThreadCache(Cache);
+            }
+            delete Cache;
+        }
+    };
+
+    thread_local Heap::ThreadCacheHolder Heap::CurrentThreadCache;
+
+    void Heap::MapInsert(size bytes, u32 &firstLevel, u32 &secondLevel) noexcept
+    {
+        constexpr size SmallBlockSize = size{1} << FirstLevelShift;
+        if(bytes < SmallBlockSize)
+        {
+            firstLevel = 0;
+            secondLevel = static_cast<u32>(bytes / (SmallBlockSize / SecondLevelCount));
+            return;
+        }
+
+        const auto log2 = static_cast<u32>(std::bit_width(bytes) - 1);
+        secondLevel = static_cast<u32>(bytes >> (log2 - SecondLevelLog2)) ^ SecondLevelCount;
+        firstLevel = log2 - (FirstLevelShift - 1);
+    }
+
+    void Heap::MapSearch(size bytes, u32 &firstLevel, u32 &secondLevel) noexcept
+    {
+        if(bytes >= (size{1} << FirstLevelShift))
+        {
+            bytes += (size{1} << (std::bit_width(bytes) - 1 - SecondLevelLog2)) - 1;
+        }
+        MapInsert(bytes, firstLevel, secondLevel);
+    }
+
+    Heap::Heap(size poolSize, MemoryTag tag, bool threadCache) :
+    m_poolSize{AlignUp(std::max(poolSize, 64_KiB), Platform::GetPageSize())}, m_tag{tag}, m_threadCache{threadCache}
+    {
+        SSSENGINE_STATIC_ASSERT(sizeof(Block) == HeaderSize + MinimumBlockSize, "Unexpected block header layout")
+        SSSENGINE_STATIC_ASSERT(sizeof(Pool) == 16, "The first block must stay 16 byte aligned")
+    }
+
+    Heap::~Heap()
+    {
+        // NOTE: The caches of the threads still alive are deleted by them, only detach them. Their blocks are in the
+        // pools being freed
+        for(ThreadCache *cache = m_threadCaches; cache != nullptr; cache = cache->Next)
+        {
+            cache->Owner.store(nullptr, std::memory_order_release);
+        }
+
+        for(Pool *pool = m_pools; pool != nullptr;)
+        {
+            Pool *next = pool->Next;
+            Platform::FreeMemory(pool, pool->Bytes);
+            pool = next;
+        }
+    }
+
+    void *Heap::Allocate(size bytes, size alignment)
+    {
+        SSSENGINE_ASSERT(IsPowerOfTwo(alignment));
+
+        if(m_threadCache && bytes <= ThreadCache::MaximumSize && alignment <= MinimumAlignment)
+        {
+            if(ThreadCache *cache = GetThreadCache())
+            {
+                const size adjusted = AdjustRequest(bytes);
+                const size bin = ThreadCache::GetBin(adjusted);
+                if(cache->Bins[bin] == nullptr)
+                {
+                    // NOTE: Refill a few at once so the lock is taken once per batch
+                    std::scoped_lock lock{m_mutex};
+                    for(u32 i = 0; i < ThreadCache::RefillCount; ++i)
+                    {
+                        void *memory = AllocateLocked(adjusted, MinimumAlignment);
+                        if(memory == nullptr)
+                        {
+                            break;
+                        }
+
+                        Block *block = Block::FromMemory(memory);
+                        block->NextFree = cache->Bins[bin];
+                        cache->Bins[bin] = block;
+                        ++cache->Counts[bin];
+                    }
+                }
+
+                Block *block = cache->Bins[bin];
+                if(block == nullptr)
+                {
+                    return nullptr;
+                }
+
+                cache->Bins[bin] = block->NextFree;
+                --cache->Counts[bin];
+                TrackAllocation(m_tag, block->GetSize());
+                return block->GetMemory();
+            }
+        }
+
+        void *memory = nullptr;
+        {
+            std::scoped_lock lock{m_mutex};
+            memory = AllocateLocked(bytes, alignment);
+        }
+
+        if(memory != nullptr)
+        {
+            TrackAllocation(m_tag, GetUsableSize(memory));
+        }
+        return memory;
+    }
+
+    void Heap::Deallocate(void *memory, [[maybe_unused]] size bytes)
+    {
+        Free(memory);
+    }
+
+    void Heap::Free(void *memory)
+    {
+        if(memory == nullptr)
+        {
+            return;
+        }
+
+        Block *block = Block::FromMemory(memory);
+        SSSENGINE_ASSERT(!block->IsFree() && "Double free");
+        TrackFree(m_tag, block->GetSize());
+
+        if(m_threadCache && block->GetSize() <= ThreadCache::MaximumSize)
+        {
+            if(ThreadCache *cache = GetThreadCache())
+            {
+                const size bin = ThreadCache::GetBin(block->GetSize());
+                if(cache->Counts[bin] == ThreadCache::BinCapacity)
+                {
+                    // NOTE: Give half back at once so the lock is taken once per batch
+                    std::scoped_lock lock{m_mutex};
+                    for(u32 i = 0; i < ThreadCache::BinCapacity / 2; ++i)
+                    {
+                        Block *cached = cache->Bins[bin];
+                        cache->Bins[bin] = cached->NextFree;
+                        FreeLocked(cached);
+                    }
+                    cache->Counts[bin] -= ThreadCache::BinCapacity / 2;
+                }
+
+                block->NextFree = cache->Bins[bin];
+                cache->Bins[bin] = block;
+                ++cache->Counts[bin];
+                return;
+            }
+        }
+
+        std::scoped_lock lock{m_mutex};
+        FreeLocked(block);
+    }
+
+    size Heap::GetUsableSize(const void *memory) noexcept
+    {
+        return Block::FromMemory(memory)->GetSize();
+    }
+
+    size Heap::GetAllocatedBytes() const noexcept
+    {
+        return m_allocatedBytes.load(std::memory_order_relaxed);
+    }
+
+    size Heap::GetPoolBytes() const noexcept
+    {
+        std::scoped_lock lock{m_mutex};
+        return m_poolBytes;
+    }
+
+    bool Heap::CheckIntegrity() const
+    {
+        std::scoped_lock lock{m_mutex};
+
+        size freeBlocks = 0;
+        for(const Pool *pool = m_pools; pool != nullptr; pool = pool->Next)
+        {
+            auto *block = reinterpret_cast<Block *>(const_cast<Pool *>(pool) + 1);
+            bool previousFree = false;
+            while(block->GetSize() != 0)
+            {
+                Block *next = block->GetNextPhysical();
+                // NOTE: Free neighbours are always merged
+                if(block->IsPreviousFree() != previousFree || (previousFree && block->IsFree()))
+                {
+                    return false;
+                }
+                if(block->IsFree() && next->PreviousPhysical != block)
+                {
+                    return false;
+                }
+
+                freeBlocks += block->IsFree() ? 1 : 0;
+                previousFree = block->IsFree();
+                block = next;
+            }
+
+            if(block->IsPreviousFree() != previousFree || block->IsFree())
+            {
+                return false;
+            }
+        }
+
+        size listedBlocks = 0;
+        for(u32 firstLevel = 0; firstLevel < FirstLevelCount; ++firstLevel)
+        {
+            if(((m_firstLevelMap >> firstLevel) & 1) != (m_secondLevelMaps[firstLevel] != 0))
+            {
+                return false;
+            }
+
+            for(u32 secondLevel = 0; secondLevel < SecondLevelCount; ++secondLevel)
+            {
+                const Block *head = m_freeLists[firstLevel][secondLevel];
+                if(((m_secondLevelMaps[firstLevel] >> secondLevel) & 1) != (head != nullptr))
+                {
+                    return false;
+                }
+
+                for(const Block *block = head; block != nullptr; block = block->NextFree)
+                {
+                    u32 blockFirstLevel = 0;
+                    u32 blockSecondLevel = 0;
+                    MapInsert(block->GetSize(), blockFirstLevel, blockSecondLevel);
+                    if(!block->IsFree() || blockFirstLevel != firstLevel || blockSecondLevel != secondLevel)
+                    {
+                        return false;
+                    }
+                    ++listedBlocks;
+                }
+            }
+        }
+
+        return listedBlocks == freeBlocks;
+    }
+
+    void *Heap::AllocateLocked(size bytes, size alignment)
+    {
+        constexpr size MaximumAllocation = size{1} << (FirstLevelMax - 1);
+        if(bytes > MaximumAllocation)
+        {
+            return nullptr;
+        }
+
+        const size adjusted = AdjustRequest(bytes);
+
+        // NOTE: Over aligned requests look for enough room to put a free block in front of the aligned address
+        constexpr size GapMinimum = HeaderSize + MinimumBlockSize;
+        const bool overAligned = alignment > MinimumAlignment;
+        const size searched = overAligned ? adjusted + alignment + GapMinimum : adjusted;
+
+        // NOTE: The new pool's block is taken directly. Searching would round the request up to the next list, which
+        // a pool sized for the request may not reach
+        Block *block = FindFree(searched);
+        if(block == nullptr)
+        {
+            block = AddPool(searched);
+            if(block == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        SSSENGINE_ASSERT(block != nullptr && block->GetSize() >= searched);
+        RemoveFree(block);
+
+        if(overAligned)
+        {
+            byte *const memory = block->GetMemory();
+            auto aligned = AlignUp(reinterpret_cast<uintptr>(memory), static_cast<uintptr>(alignment));
+            size gap = aligned - reinterpret_cast<uintptr>(memory);
+            if(gap != 0 && gap < GapMinimum)
+            {
+                aligned = AlignUp(reinterpret_cast<uintptr>(memory) + GapMinimum, static_cast<uintptr>(alignment));
+                gap = aligned - reinterpret_cast<uintptr>(memory);
+            }
+
+            if(gap != 0)
+            {
+                // NOTE: The gap becomes a free block of its own in front of the aligned one
+                auto *const alignedBlock = Block::FromMemory(reinterpret_cast<void *>(aligned));
+                alignedBlock->SetSizeAndFlags(block->GetSize() - gap, Block::FreeFlag | Block::PreviousFreeFlag);
+                alignedBlock->PreviousPhysical = block;
+                alignedBlock->GetNextPhysical()->PreviousPhysical = alignedBlock;
+
+                block->SetSize(gap - HeaderSize);
+                InsertFree(block);
+                block = alignedBlock;
+            }
+        }
+
+        // NOTE: Split the tail off if it can hold a block of its own
+        if(block->GetSize() >= adjusted + HeaderSize + MinimumBlockSize)
+        {
+            auto *const remainder = reinterpret_cast<Block *>(block->GetMemory() + adjusted);
+            remainder->SetSizeAndFlags(block->GetSize() - adjusted - HeaderSize, Block::FreeFlag);
+            remainder->PreviousPhysical = block;
+            remainder->GetNextPhysical()->PreviousPhysical = remainder;
+            remainder->GetNextPhysical()->SetPreviousFree(true);
+
+            block->SetSize(adjusted);
+            InsertFree(remainder);
+        }
+
+        block->SetFree(false);
+        block->GetNextPhysical()->SetPreviousFree(false);
+
+        m_allocatedBytes.fetch_add(block->GetSize(), std::memory_order_relaxed);
+        return block->GetMemory();
+    }
+
+    void Heap::FreeLocked(Block *block)
+    {
+        m_allocatedBytes.fetch_sub(block->GetSize(), std::memory_order_relaxed);
+        block->SetFree(true);
+
+        if(block->IsPreviousFree())
+        {
+            Block *const previous = block->PreviousPhysical;
+            RemoveFree(previous);
+            previous->SetSize(previous->GetSize() + HeaderSize + block->GetSize());
+            block = previous;
+        }
+
+        Block *next = block->GetNextPhysical();
+        if(next->IsFree())
+        {
+            RemoveFree(next);
+            block->SetSize(block->GetSize() + HeaderSize + next->GetSize());
+            next = block->GetNextPhysical();
+        }
+
+        next->PreviousPhysical = block;
+        next->SetPreviousFree(true);
+        InsertFree(block);
+    }
+
+    Heap::Block *Heap::AddPool(size minimumBytes)
+    {
+        const size overhead = sizeof(Pool) + 2 * HeaderSize;
+        const size bytes = std::max(m_poolSize, AlignUp(minimumBytes + overhead, Platform::GetPageSize()));
+        void *const memory = Platform::AllocateMemory(bytes);
+        if(memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto *const pool = static_cast<Pool *>(memory);
+        pool->Next = m_pools;
+        pool->Bytes = bytes;
+        m_pools = pool;
+        m_poolBytes += bytes;
+
+        auto *const block = reinterpret_cast<Block *>(pool + 1);
+        block->SetSizeAndFlags(bytes - sizeof(Pool) - 2 * HeaderSize, Block::FreeFlag);
+
+        Block *const sentinel = block->GetNextPhysical();
+        sentinel->SetSizeAndFlags(0, Block::PreviousFreeFlag);
+        sentinel->PreviousPhysical = block;
+
+        InsertFree(block);
+        return block;
+    }
+
+    void Heap::InsertFree(Block *block)
+    {
+        u32 firstLevel = 0;
+        u32 secondLevel = 0;
+        MapInsert(block->GetSize(), firstLevel, secondLevel);
+
+        Block *&head = m_freeLists[firstLevel][secondLevel];
+        block->NextFree = head;
+        block->PreviousFree = nullptr;
+        if(head != nullptr)
+        {
+            head->PreviousFree = block;
+        }
+        head = block;
+
+        m_firstLevelMap |= 1u << firstLevel;
+        m_secondLevelMaps[firstLevel] |= 1u << secondLevel;
+    }
+
+    void Heap::RemoveFree(Block *block)
+    {
+        u32 firstLevel = 0;
+        u32 secondLevel = 0;
+        MapInsert(block->GetSize(), firstLevel, secondLevel);
+
+        if(block->NextFree != nullptr)
+        {
+            block->NextFree->PreviousFree = block->PreviousFree;
+        }
+
+        if(block->PreviousFree != nullptr)
+        {
+            block->PreviousFree->NextFree = block->NextFree;
+            return;
+        }
+
+        Block *&head = m_freeLists[firstLevel][secondLevel];
+        SSSENGINE_ASSERT(head == block);
+        head = block->NextFree;
+        if(head == nullptr)
+        {
+            m_secondLevelMaps[firstLevel] &= ~(1u << secondLevel);
+            if(m_secondLevelMaps[firstLevel] == 0)
+            {
+                m_firstLevelMap &= ~(1u << firstLevel);
+            }
+        }
+    }
+
+    Heap::Block *Heap::FindFree(size bytes)
+    {
+        u32 firstLevel = 0;
+        u32 secondLevel = 0;
+        MapSearch(bytes, firstLevel, secondLevel);
+        if(firstLevel >= FirstLevelCount)
+        {
+            return nullptr;
+        }
+
+        u32 secondLevelMap = m_secondLevelMaps[firstLevel] & (~0u << secondLevel);
+        if(secondLevelMap == 0)
+        {
+            // NOTE: firstLevel + 1 can be 32 only past FirstLevelCount, which was already rejected
+            const u32 firstLevelMap = m_firstLevelMap & (~0u << (firstLevel + 1));
+            if(firstLevelMap == 0)
+            {
+                return nullptr;
+            }
+
+            firstLevel = static_cast<u32>(std::countr_zero(firstLevelMap));
+            secondLevelMap = m_secondLevelMaps[firstLevel];
+        }
+
+        return m_freeLists[firstLevel][std::countr_zero(secondLevelMap)];
+    }
+
+    Heap::ThreadCache *Heap::GetThreadCache()
+    {
+        ThreadCache *&cache = CurrentThreadCache.Cache;
+        if(cache != nullptr)
+        {
+            const Heap *owner = cache->Owner.load(std::memory_order_relaxed);
+            if(owner == this)
+            {
+                return cache;
+            }
+            if(owner != nullptr)
+            {
+                return nullptr;
+            }
+
+            // NOTE: Its heap was destroyed, this thread can cache for another one
+            delete cache;
+            cache = nullptr;
+        }
+
+        cache = new ThreadCache{};
+        cache->Owner.store(this, std::memory_order_relaxed);
+
+        std::scoped_lock lock{m_mutex};
+        cache->Next = m_threadCaches;
+        m_threadCaches = cache;
+        return cache;
+    }
+
+    void Heap::ReleaseThreadCache(ThreadCache *cache)
+    {
+        std::scoped_lock lock{m_mutex};
+
+        for(size bin = 0; bin < ThreadCache::BinCount; ++bin)
+        {
+            for(Block *block = cache->Bins[bin]; block != nullptr;)
+            {
+                Block *next = block->NextFree;
+                FreeLocked(block);
+                block = next;
+            }
+        }
+
+        for(ThreadCache **link = &m_threadCaches; *link != nullptr; link = &(*link)->Next)
+        {
+            if(*link == cache)
+            {
+                *link = cache->Next;
+                break;
+            }
+        }
+        cache->Owner.store(nullptr, std::memory_order_relaxed);
+    }
+
+    Heap &GetEngineHeap()
+    {
+        SSSENGINE_FUNCTION_LOCAL Heap EngineHeap{Heap::DefaultPoolSize, MemoryTag::General, true};
+        return EngineHeap;
+    }
+} // namespace SSSEngine::Core::Memory
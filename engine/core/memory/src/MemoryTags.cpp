@@ -0,0 +1,105 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <iterator>
+#include "MemoryTags.h"
+#include "Debug.h"
+#include "Logger.h"
+
+namespace SSSEngine::Core::Memory
+{
+    namespace
+    {
+        constexpr const wchar_t *TagNames[]{
+            L"General", L"Renderer", L"Audio", L"Input", L"Assets", L"Gameplay", L"Editor", L"Transient"};
+        SSSENGINE_STATIC_ASSERT(std::size(TagNames) == MemoryTagCount, "Every memory tag needs a name")
+
+        Detail::MemoryTagCounters &GetCounters(MemoryTag tag)
+        {
+            SSSENGINE_ASSERT(tag < MemoryTag::Count);
+            return Detail::TagCounters[static_cast<size>(tag)];
+        }
+    } // namespace
+
+    const wchar_t *GetMemoryTagName(MemoryTag tag)
+    {
+        SSSENGINE_ASSERT(tag < MemoryTag::Count);
+        return TagNames[static_cast<size>(tag)];
+    }
+
+    MemoryTagStats GetMemoryTagStats(MemoryTag tag)
+    {
+        const auto &counters = GetCounters(tag);
+        return {.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed),
+                .PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed),
+                .AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed),
+                .FrameAllocationCount = counters.LastFrameAllocationCount,
+                .Budget = counters.Budget};
+    }
+
+    void SetMemoryBudget(MemoryTag tag, size bytes)
+    {
+        auto &counters = GetCounters(tag);
+        counters.Budget = bytes;
+        counters.OverBudget = false;
+    }
+
+    bool UpdateMemoryTags()
+    {
+        bool overBudget = false;
+        for(size i = 0; i < MemoryTagCount; ++i)
+        {
+            auto &counters = Detail::TagCounters[i];
+            counters.LastFrameAllocationCount = counters.FrameAllocationCount.exchange(0, std::memory_order_relaxed);
+
+            const size live = counters.LiveBytes.load(std::memory_order_relaxed);
+            const bool over = counters.Budget != 0 && live > counters.Budget;
+            // NOTE: Only warn when crossing the budget, not every frame it stays over
+            if(over && !counters.OverBudget)
+            {
+                SSSENGINE_LOG_WARNING(
+                    "Memory tag {} is over budget: {} of {} bytes", TagNames[i], live, counters.Budget);
+            }
+            counters.OverBudget = over;
+            overBudget = overBudget || over;
+        }
+
+        return overBudget;
+    }
+
+    void DumpMemoryTags()
+    {
+        for(size i = 0; i < MemoryTagCount; ++i)
+        {
+            [[maybe_unused]] const MemoryTagStats stats = GetMemoryTagStats(static_cast<MemoryTag>(i));
+            SSSENGINE_LOG_INFO("{:<10} live {:>12} peak {:>12} allocations {:>10} last frame {:>6} budget {:>12}",
+                               TagNames[i],
+                               stats.LiveBytes,
+                               stats.PeakBytes,
+                               stats.AllocationCount,
+                               stats.FrameAllocationCount,
+                               stats.Budget);
+        }
+    }
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,43 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief The thread local scratch arenas. Scopes work on the arena inline, only creating and trimming it lives here
+ */
+
+#include "ScratchScope.h"
+#include "Debug.h"
+
+namespace SSSEngine::Core::Memory
+{
+    Arena &GetThreadScratch()
+    {
+        // NOTE: Function local so threads that never use scratch memory don't reserve any address space
+        thread_local Arena scratch{ThreadScratchSize, MemoryTag::Transient};
+        return scratch;
+    }
+
+    void TrimThreadScratch(size keepBytes)
+    {
+        Arena &scratch = GetThreadScratch();
+        SSSENGINE_ASSERT(scratch.GetUsed() == 0 && "A ScratchScope is still alive in this thread");
+        scratch.Trim(keepBytes);
+    }
+} // namespace SSSEngine::Core::Memory
@@ -0,0 +1,298 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Blocking push and pop on top of the lock-free queues
+ * A thread that finds the queue full or empty spins for a moment and then sleeps in the OS on an epoch counter that the
+ * other side bumps after every push or pop. The other side only makes the wake up system call when a thread is
+ * registered as sleeping, so while nobody waits the queue costs the same as the one it wraps.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <span>
+#include <utility>
+#include "Attributes.h"
+#include "Memory.h"
+#include "Threading.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @brief The non blocking interface shared by SpscQueue and MpmcQueue
+     */
+    template<typename Q>
+    concept BoundedQueueConcept =
+        requires(Q queue, typename Q::ValueType value, std::span<typename Q::ValueType> values) {
+            { queue.TryPush(std::move(value)) } -> std::same_as<bool>;
+            { queue.TryPop(value) } -> std::same_as<bool>;
+            { queue.TryPushBatch(values) } -> std::same_as<size>;
+            { queue.TryPopBatch(values) } -> std::same_as<size>;
+        };
+
+    /**
+     * @class BlockingQueue
+     * @brief Wraps a queue so pushing to a full queue and popping from an empty one wait instead of failing
+     *
+     * The threading rules of the wrapped queue still apply, a BlockingQueue over an SpscQueue has one producer and one
+     * consumer. Closing the queue wakes every waiting thread. After that pushes fail and pops drain what is left.
+     *
+     * @tparam Q The wrapped queue
+     */
+    template<BoundedQueueConcept Q>
+    class BlockingQueue
+    {
+        public:
+        using ValueType = typename Q::ValueType;
+
+        /**
+         * @brief The times a thread retries before going to sleep
+         */
+        static constexpr u32 SpinCount = 64;
+
+        /**
+         * @param args Forwarded to the constructor of the wrapped queue
+         */
+        template<typename... Args>
+        explicit BlockingQueue(Args &&...args) : m_queue(std::forward<Args>(args)...)
+        {
+        }
+
+        BlockingQueue(const BlockingQueue &) = delete;
+        BlockingQueue(BlockingQueue &&) = delete;
+        BlockingQueue &operator=(const BlockingQueue &) = delete;
+        BlockingQueue &operator=(BlockingQueue &&) = delete;
+
+        ~BlockingQueue() = default;
+
+        /**
+         * @brief Pushes value, waiting for room if the queue is full
+         *
+         * @return False if the queue is closed, value is dropped then
+         */
+        bool Push(ValueType value)
+        {
+            const bool pushed = Wait(m_popped, true, [&]() { return m_queue.TryPush(std::move(value)); });
+            if(pushed)
+            {
+                Notify(m_pushed, false);
+            }
+            return pushed;
+        }
+
+        /**
+         * @brief Pushes all of values in order, waiting for room as needed. Batches from different producers may
+         * interleave when the queue fills up in the middle of one
+         *
+         * @return The number of values pushed, less than values.size() only if the queue was closed
+         */
+        size PushBatch(std::span<ValueType> values)
+        {
+            size pushed = 0;
+            while(pushed < values.size())
+            {
+                size count = 0;
+                const bool waited = Wait(m_popped, true,
+                                         [&]()
+                                         {
+                                             count = m_queue.TryPushBatch(values.subspan(pushed));
+                                             return count > 0;
+                                         });
+                if(!waited)
+                {
+                    break;
+                }
+
+                pushed += count;
+                Notify(m_pushed, count > 1);
+            }
+
+            return pushed;
+        }
+
+        /**
+         * @brief Pops the value at the front into out, waiting for one if the queue is empty
+         *
+         * @return False if the queue is closed and empty, out is untouched then
+         */
+        bool Pop(ValueType &out)
+        {
+            const bool popped = Wait(m_pushed, false, [&]() { return m_queue.TryPop(out); });
+            if(popped)
+            {
+                Notify(m_popped, false);
+            }
+            return popped;
+        }
+
+        /**
+         * @brief Pops up to out.size() values into out, waiting until there is at least one
+         *
+         * @return The number of values popped, 0 only if the queue is closed and empty
+         */
+        size PopBatch(std::span<ValueType> out)
+        {
+            size count = 0;
+            const bool popped = Wait(m_pushed, false,
+                                     [&]()
+                                     {
+                                         count = m_queue.TryPopBatch(out);
+                                         return count > 0;
+                                     });
+            if(popped)
+            {
+                Notify(m_popped, count > 1);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Pushes value if there is room, never waits
+         */
+        bool TryPush(ValueType value)
+        {
+            if(IsClosed() || !m_queue.TryPush(std::move(value)))
+            {
+                return false;
+            }
+            Notify(m_pushed, false);
+            return true;
+        }
+
+        /**
+         * @brief Pops a value if there is one, never waits
+         */
+        bool TryPop(ValueType &out)
+        {
+            if(!m_queue.TryPop(out))
+            {
+                return false;
+            }
+            Notify(m_popped, false);
+            return true;
+        }
+
+        /**
+         * @brief Makes pushes fail from now on and wakes every waiting thread. Values already in the queue can still
+         * be popped
+         */
+        void Close()
+        {
+            m_closed.store(true, std::memory_order_seq_cst);
+            Notify(m_pushed, true);
+            Notify(m_popped, true);
+        }
+
+        SSSENGINE_PURE bool IsClosed() const noexcept
+        {
+            return m_closed.load(std::memory_order_acquire);
+        }
+
+        SSSENGINE_PURE Q &GetQueue() noexcept
+        {
+            return m_queue;
+        }
+
+        private:
+        /**
+         * @brief Sleeping threads wait on Epoch, Waiters is how many might be
+         */
+        struct alignas(Platform::CacheLineDestructive) Signal
+        {
+            std::atomic<u32> Epoch{0};
+            std::atomic<u32> Waiters{0};
+        };
+
+        /**
+         * @brief Calls attempt until it succeeds, sleeping on signal between tries once spinning didn't help
+         *
+         * @param pushing Pushes give up as soon as the queue is closed, pops only once it is also empty
+         * @return False if the queue was closed before attempt succeeded
+         */
+        template<typename F>
+        bool Wait(Signal &signal, bool pushing, F attempt)
+        {
+            for(u32 spin = 0; spin < SpinCount; ++spin)
+            {
+                if(pushing && IsClosed())
+                {
+                    return false;
+                }
+                if(attempt())
+                {
+                    return true;
+                }
+                Platform::CpuRelax();
+            }
+
+            while(true)
+            {
+                // NOTE: The sequentially consistent order of registering, reading the epoch and trying again pairs
+                // with bumping the epoch and reading Waiters in Notify. Either the other thread sees us registered and
+                // wakes us, or we see its new epoch and WaitOnAddress returns right away
+                signal.Waiters.fetch_add(1, std::memory_order_seq_cst);
+                const u32 epoch = signal.Epoch.load(std::memory_order_seq_cst);
+                const bool closed = m_closed.load(std::memory_order_seq_cst);
+
+                const bool succeeded = !(pushing && closed) && attempt();
+                if(!succeeded && !closed)
+                {
+                    Platform::WaitOnAddress(signal.Epoch, epoch);
+                }
+                signal.Waiters.fetch_sub(1, std::memory_order_relaxed);
+
+                if(succeeded)
+                {
+                    return true;
+                }
+                if(closed)
+                {
+                    return false;
+                }
+            }
+        }
+
+        static void Notify(Signal &signal, bool all)
+        {
+            signal.Epoch.fetch_add(1, std::memory_order_seq_cst);
+            if(signal.Waiters.load(std::memory_order_seq_cst) == 0)
+            {
+                return;
+            }
+
+            if(all)
+            {
+                Platform::WakeAllOnAddress(signal.Epoch);
+            }
+            else
+            {
+                Platform::WakeOneOnAddress(signal.Epoch);
+            }
+        }
+
+        Q m_queue;
+        Signal m_pushed;
+        Signal m_popped;
+        std::atomic<bool> m_closed{false};
+    };
+} // namespace SSSEngine::Core::Threading
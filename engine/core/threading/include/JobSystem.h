@@ -0,0 +1,211 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Work stealing job system
+ * Every thread of the system owns a deque of jobs. It pushes and pops its own jobs at the bottom, the most recent first
+ * since their data is still in the cache, and steals the oldest jobs of other threads when it runs out. Threads that
+ * are not part of the system hand their jobs over through a shared queue. Waiting on a counter runs jobs until the
+ * counter drops to zero, so the thread that waits keeps doing useful work instead of blocking.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <thread>
+#include "Attributes.h"
+#include "Handle.h"
+#include "Memory.h"
+#include "MpmcQueue.h"
+#include "Pool.h"
+#include "Types.h"
+#include "WorkStealingDeque.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @brief The function of a job. Must not throw
+     */
+    using JobFunction = void (*)(void *data);
+
+    /**
+     * @class JobCounter
+     * @brief Number of jobs that still have to finish. Jobs with the counter add to it when they are run and subtract
+     * from it when they finish, so one counter can track any number of jobs
+     *
+     * Must outlive the jobs that use it.
+     */
+    class JobCounter final
+    {
+        public:
+        JobCounter() = default;
+        JobCounter(const JobCounter &other) = delete;
+        JobCounter(JobCounter &&other) = delete;
+        JobCounter &operator=(const JobCounter &other) = delete;
+        JobCounter &operator=(JobCounter &&other) = delete;
+        ~JobCounter() = default;
+
+        /**
+         * @brief True once every job run with the counter finished. Everything those jobs wrote is visible then
+         */
+        SSSENGINE_PURE bool IsDone() const noexcept
+        {
+            return m_pending.load(std::memory_order_acquire) == 0;
+        }
+
+        SSSENGINE_PURE u32 GetPending() const noexcept
+        {
+            return m_pending.load(std::memory_order_relaxed);
+        }
+
+        private:
+        friend class JobSystem;
+
+        std::atomic<u32> m_pending{0};
+    };
+
+    /**
+     * @class Job
+     * @brief A function and its data. The data is not copied, it must stay alive until the job finishes
+     *
+     */
+    struct Job
+    {
+        JobFunction Function{nullptr};
+        void *Data{nullptr};
+        /**
+         * @brief The counter the job adds to until it finishes. Can be null
+         */
+        JobCounter *Counter{nullptr};
+    };
+
+    /**
+     * @class JobSystem
+     * @brief Runs jobs on a worker thread per physical core
+     *
+     * The thread that creates the system is part of it. It runs jobs while it waits on counters, so the system starts
+     * one worker less than its thread count. Any thread can run jobs and wait on counters.
+     *
+     * @code
+     * JobCounter counter;
+     * jobSystem.Run({.Function = &CullChunk, .Data = &chunks[0], .Counter = &counter});
+     * jobSystem.Run({.Function = &CullChunk, .Data = &chunks[1], .Counter = &counter});
+     * jobSystem.Wait(counter);
+     * @endcode
+     */
+    class JobSystem final
+    {
+        public:
+        /**
+         * @brief The number of jobs that can be waiting or running at once. Jobs past it run right away in the thread
+         * that runs them
+         */
+        static constexpr u32 MaxJobs = 64 * 1024;
+        /**
+         * @brief The jobs each thread can have waiting in its deque. Past it they go to the shared queue
+         */
+        static constexpr size DequeCapacity = 4096;
+        static constexpr size SharedQueueCapacity = 4096;
+        /**
+         * @brief The times an idle worker looks for jobs before going to sleep
+         */
+        static constexpr u32 SpinCount = 256;
+        static constexpr u32 InvalidThread = ~0u;
+
+        /**
+         * @param threadCount The threads that run jobs, the calling thread included. 0 for one per physical core
+         */
+        explicit JobSystem(u32 threadCount = 0);
+
+        JobSystem(const JobSystem &other) = delete;
+        JobSystem(JobSystem &&other) = delete;
+        JobSystem &operator=(const JobSystem &other) = delete;
+        JobSystem &operator=(JobSystem &&other) = delete;
+
+        /**
+         * @brief Stops and joins the workers. Every job must be waited on before
+         */
+        ~JobSystem();
+
+        /**
+         * @brief Queues a job. It may start before this returns
+         */
+        void Run(const Job &job);
+
+        /**
+         * @brief Queues jobs, waking as many sleeping workers as needed at once
+         */
+        void Run(std::span<const Job> jobs);
+
+        /**
+         * @brief Runs jobs until every job of counter finished
+         */
+        void Wait(const JobCounter &counter);
+
+        SSSENGINE_PURE u32 GetThreadCount() const noexcept
+        {
+            return m_threadCount;
+        }
+
+        /**
+         * @brief The index of the calling thread in the system. 0 for the thread that created it, InvalidThread for
+         * threads that are not part of it
+         */
+        SSSENGINE_PURE u32 GetCurrentThreadIndex() const noexcept;
+
+        private:
+        struct ThreadState
+        {
+            WorkStealingDeque<Memory::Handle<Job>> Deque{DequeCapacity};
+            std::thread Thread;
+        };
+
+        /**
+         * @brief Stores the job and hands it to a queue, without waking anyone
+         *
+         * @return False if the job had to be run right away
+         */
+        bool Submit(const Job &job, u32 threadIndex);
+
+        /**
+         * @brief Takes a job from the deque of the thread, then the shared queue, then the deques of the others
+         */
+        bool TryTake(u32 threadIndex, Memory::Handle<Job> &handle);
+
+        void Execute(Memory::Handle<Job> handle);
+        static void Finish(const Job &job);
+
+        void Wake(u32 count);
+        void WorkerMain(u32 threadIndex);
+
+        u32 m_threadCount{1};
+        std::unique_ptr<ThreadState[]> m_threads;
+        Memory::Pool<Job> m_jobs{MaxJobs};
+        MpmcQueue<Memory::Handle<Job>> m_shared{SharedQueueCapacity};
+
+        // NOTE: Sleeping workers wait on the epoch, which is bumped after jobs are queued. Submitters only make the
+        // wake up system call when a worker is registered as sleeping
+        alignas(Platform::CacheLineDestructive) std::atomic<u32> m_wakeEpoch{0};
+        std::atomic<u32> m_sleepers{0};
+        std::atomic<bool> m_running{true};
+    };
+} // namespace SSSEngine::Core::Threading
@@ -0,0 +1,294 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Bounded lock-free queue for any number of producer and consumer threads
+ * Dmitry Vyukov's array queue. Every cell has a sequence number that says whose turn it is: a producer may fill the
+ * cell at position p when the sequence is p and a consumer may empty it when the sequence is p + 1. Threads claim
+ * positions with a compare exchange on the enqueue or dequeue index and then publish the cell through its sequence, so
+ * producers and consumers only contend among themselves.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "Attributes.h"
+#include "ContainerAllocator.h"
+#include "Memory.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @class MpmcQueue
+     * @brief Fixed capacity FIFO queue that any thread can push to and pop from
+     *
+     * @tparam T The type of the values. Must be nothrow movable
+     * @tparam A The allocator of the cells, only used when the queue is created and destroyed
+     */
+    template<typename T, ContainerAllocatorConcept A = GlobalAllocator>
+    class MpmcQueue
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                      "MpmcQueue values must be nothrow movable");
+
+        public:
+        using ValueType = T;
+
+        /**
+         * @param capacity The number of values the queue can hold. Rounded up to a power of two
+         * @throws std::bad_alloc if the cells could not be allocated
+         */
+        explicit MpmcQueue(size capacity, const A &allocator = A{}) :
+        m_capacity{std::bit_ceil((std::max)(capacity, size{2}))}, m_allocator{allocator}
+        {
+            m_cells = static_cast<Cell *>(m_allocator.Allocate(sizeof(Cell) * m_capacity, alignof(Cell)));
+            if(m_cells == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            for(size i = 0; i < m_capacity; ++i)
+            {
+                std::construct_at(&m_cells[i].Sequence, i);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue &) = delete;
+        MpmcQueue(MpmcQueue &&) = delete;
+        MpmcQueue &operator=(const MpmcQueue &) = delete;
+        MpmcQueue &operator=(MpmcQueue &&) = delete;
+
+        /**
+         * @brief Destroys the values still in the queue. No thread may be using it
+         */
+        ~MpmcQueue()
+        {
+            const size tail = m_enqueuePosition.load(std::memory_order_relaxed);
+            for(size head = m_dequeuePosition.load(std::memory_order_relaxed); head != tail; ++head)
+            {
+                std::destroy_at(GetCell(head).Value());
+            }
+            for(size i = 0; i < m_capacity; ++i)
+            {
+                std::destroy_at(&m_cells[i].Sequence);
+            }
+            m_allocator.Deallocate(m_cells, sizeof(Cell) * m_capacity, alignof(Cell));
+        }
+
+        /**
+         * @brief Constructs a value at the back of the queue
+         *
+         * @return False if the queue was full, nothing is constructed then
+         */
+        template<typename... Args>
+        bool TryEmplace(Args &&...args)
+        {
+            if constexpr(std::is_nothrow_constructible_v<T, Args...>)
+            {
+                return TryEmplaceNoThrow(std::forward<Args>(args)...);
+            }
+            else
+            {
+                // NOTE: A claimed cell must be published, so a constructor that can throw runs before claiming it
+                T value(std::forward<Args>(args)...);
+                return TryEmplaceNoThrow(std::move(value));
+            }
+        }
+
+        bool TryPush(const T &value)
+        {
+            return TryEmplace(value);
+        }
+
+        bool TryPush(T &&value)
+        {
+            return TryEmplace(std::move(value));
+        }
+
+        /**
+         * @brief Moves as many of values as there are consecutive free cells into the queue, claiming them all with one
+         * compare exchange. Values from other producers never interleave with the batch
+         *
+         * @param values The values to push. The first returned count are moved from
+         * @return The number of values pushed
+         */
+        size TryPushBatch(std::span<T> values) noexcept
+        {
+            if(values.empty())
+            {
+                return 0;
+            }
+
+            size position = 0;
+            const size count = Claim(m_enqueuePosition, values.size(), 0, position);
+            for(size i = 0; i < count; ++i)
+            {
+                Cell &cell = GetCell(position + i);
+                std::construct_at(cell.Value(), std::move(values[i]));
+                cell.Sequence.store(position + i + 1, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Moves the value at the front of the queue into out
+         *
+         * @return False if the queue was empty, out is untouched then
+         */
+        bool TryPop(T &out) noexcept
+        {
+            return TryPopBatch(std::span<T>{&out, 1}) == 1;
+        }
+
+        /**
+         * @brief Moves as many values as are ready at the front of the queue, up to out.size(), into out in order. They
+         * are claimed with one compare exchange
+         *
+         * @return The number of values popped
+         */
+        size TryPopBatch(std::span<T> out) noexcept
+        {
+            if(out.empty())
+            {
+                return 0;
+            }
+
+            size position = 0;
+            const size count = Claim(m_dequeuePosition, out.size(), 1, position);
+            for(size i = 0; i < count; ++i)
+            {
+                Cell &cell = GetCell(position + i);
+                T *value = cell.Value();
+                out[i] = std::move(*value);
+                std::destroy_at(value);
+                cell.Sequence.store(position + i + m_capacity, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        SSSENGINE_PURE size GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief The number of values in the queue. Only a hint while other threads push or pop
+         */
+        SSSENGINE_PURE size GetSizeApprox() const noexcept
+        {
+            const size head = m_dequeuePosition.load(std::memory_order_acquire);
+            const size tail = m_enqueuePosition.load(std::memory_order_acquire);
+            // NOTE: The positions are read one after the other, the head may already be past the tail that was read
+            return tail > head ? tail - head : 0;
+        }
+
+        private:
+        // NOTE: Cells are not padded to a cache line. Neighbouring cells are usually touched by the same thread in a
+        // row and padding would multiply the memory of small values
+        struct Cell
+        {
+            std::atomic<size> Sequence;
+            alignas(T) byte Storage[sizeof(T)];
+
+            SSSENGINE_PURE T *Value() noexcept
+            {
+                return std::launder(reinterpret_cast<T *>(Storage));
+            }
+        };
+
+        SSSENGINE_PURE Cell &GetCell(size position) const noexcept
+        {
+            return m_cells[position & (m_capacity - 1)];
+        }
+
+        template<typename... Args>
+        bool TryEmplaceNoThrow(Args &&...args) noexcept
+        {
+            size position = 0;
+            if(Claim(m_enqueuePosition, 1, 0, position) == 0)
+            {
+                return false;
+            }
+
+            Cell &cell = GetCell(position);
+            std::construct_at(cell.Value(), std::forward<Args>(args)...);
+            cell.Sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Claims up to count consecutive cells starting at the current value of index. A cell at position p is
+         * ready when its sequence is p + offset, 0 for producers and 1 for consumers
+         *
+         * @param position Receives the position of the first claimed cell
+         * @return The number of cells claimed, 0 if the first one was not ready (the queue was full or empty)
+         */
+        size Claim(std::atomic<size> &index, size count, size offset, size &position) noexcept
+        {
+            position = index.load(std::memory_order_relaxed);
+            while(true)
+            {
+                const size sequence = GetCell(position).Sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<i64>(sequence - (position + offset));
+                if(difference < 0)
+                {
+                    return 0;
+                }
+                if(difference > 0)
+                {
+                    // NOTE: Another thread claimed the cell since index was read
+                    position = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                // NOTE: The cells after the first can only stop being ready by someone claiming them, which moves index
+                // and fails the compare exchange below
+                size ready = 1;
+                while(ready < count &&
+                      GetCell(position + ready).Sequence.load(std::memory_order_acquire) == position + ready + offset)
+                {
+                    ++ready;
+                }
+
+                if(index.compare_exchange_weak(position, position + ready, std::memory_order_relaxed))
+                {
+                    return ready;
+                }
+            }
+        }
+
+        // NOTE: Producers and consumers each hammer one of the positions, they get a cache line each
+        alignas(Platform::CacheLineDestructive) std::atomic<size> m_enqueuePosition{0};
+        alignas(Platform::CacheLineDestructive) std::atomic<size> m_dequeuePosition{0};
+
+        alignas(Platform::CacheLineDestructive) Cell *m_cells{nullptr};
+        size m_capacity{0};
+        SSSENGINE_NO_UNIQUE_ADDRESS A m_allocator;
+    };
+} // namespace SSSEngine::Core::Threading
@@ -0,0 +1,553 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Parallel algorithms on top of the job system
+ * A range is split in chunks of a grain size. The calling thread and up to one job per other thread of the system take
+ * the next chunk from a shared counter until none are left, so fast threads take more chunks and no thread waits on a
+ * slow one while there is work left. The grain can be fixed, or an AdaptiveGrain that times the chunks and sizes them
+ * so each takes about TargetChunkNanoseconds, large enough to hide the cost of a job and small enough to balance.
+ *
+ * The functions must not throw, they run inside jobs.
+ *
+ * @code
+ * ParallelFor(jobSystem, std::span{vertices}, m_transformGrain,
+ *             [&](std::span<Vertex> chunk) { TransformVertices(chunk, matrix); });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "AllocatorRefs.h"
+#include "Array.h"
+#include "Attributes.h"
+#include "Debug.h"
+#include "Heap.h"
+#include "JobSystem.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @class AdaptiveGrain
+     * @brief Learns the cost of an item of a loop and picks grain sizes from it
+     *
+     * Meant to be kept with the code that runs the loop, a member or a static, so every run starts from what the
+     * previous ones measured. Concurrent updates may overwrite each other, which only loses a sample.
+     */
+    class AdaptiveGrain final
+    {
+        public:
+        /**
+         * @brief The time a chunk should take. Running a job costs around a hundred nanoseconds
+         */
+        static constexpr u64 TargetChunkNanoseconds = 50'000;
+        /**
+         * @brief Chunks per thread used while the cost is not known yet
+         */
+        static constexpr size InitialChunksPerThread = 8;
+
+        /**
+         * @param minGrain The smallest grain it can pick, for loops that need a minimum batch (like SIMD widths)
+         */
+        explicit AdaptiveGrain(size minGrain = 1) noexcept : m_minGrain{(std::max)(minGrain, size{1})}
+        {
+        }
+
+        /**
+         * @brief The grain size for a loop of count items on threadCount threads
+         */
+        SSSENGINE_PURE size GetGrainSize(size count, u32 threadCount) const noexcept;
+
+        /**
+         * @brief Adds a measurement. Recent ones weigh more so the grain follows the cost when it changes
+         */
+        void Record(size items, u64 nanoseconds) noexcept;
+
+        /**
+         * @brief The measured cost of an item in 1/1024 nanoseconds, 0 before the first measurement
+         */
+        SSSENGINE_PURE u64 GetCostPerItem() const noexcept
+        {
+            return m_costPerItem.load(std::memory_order_relaxed);
+        }
+
+        private:
+        static constexpr u64 CostScale = 1024;
+
+        size m_minGrain{1};
+        std::atomic<u64> m_costPerItem{0};
+    };
+
+    /**
+     * @class GrainSize
+     * @brief The grain parameter of the parallel algorithms. Either a fixed number of items or an AdaptiveGrain
+     *
+     */
+    class GrainSize final
+    {
+        public:
+        // NOTE: Implicit so the algorithms can be called with a number or an AdaptiveGrain
+        GrainSize(size fixed) noexcept : m_fixed{(std::max)(fixed, size{1})} // NOLINT(google-explicit-constructor)
+        {
+        }
+
+        GrainSize(AdaptiveGrain &adaptive) noexcept : m_adaptive{&adaptive} // NOLINT(google-explicit-constructor)
+        {
+        }
+
+        SSSENGINE_PURE size Get(size count, u32 threadCount) const noexcept
+        {
+            return m_adaptive != nullptr ? m_adaptive->GetGrainSize(count, threadCount) : m_fixed;
+        }
+
+        SSSENGINE_PURE AdaptiveGrain *GetAdaptive() const noexcept
+        {
+            return m_adaptive;
+        }
+
+        private:
+        size m_fixed{1};
+        AdaptiveGrain *m_adaptive{nullptr};
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief A timestamp in nanoseconds for timing chunks
+         */
+        u64 GetChunkTime() noexcept;
+
+        /**
+         * @brief Buffers that only live for one call. They come from the engine heap, whose thread cache makes the
+         * small ones of every frame cheap
+         */
+        template<typename T>
+        using TemporaryArray = Array<T, Memory::AllocatorRef>;
+
+        SSSENGINE_FORCE_INLINE Memory::AllocatorRef GetTemporaryAllocator()
+        {
+            return {&Memory::GetEngineHeap()};
+        }
+
+        template<typename F>
+        struct ChunkLoop
+        {
+            F *Function;
+            size Count;
+            size Grain;
+            size ChunkCount;
+            AdaptiveGrain *Adaptive;
+            std::atomic<size> NextChunk{0};
+
+            static void Run(void *data)
+            {
+                auto &loop = *static_cast<ChunkLoop *>(data);
+                const u64 start = loop.Adaptive != nullptr ? GetChunkTime() : 0;
+
+                size items = 0;
+                for(size chunk = loop.NextChunk.fetch_add(1, std::memory_order_relaxed); chunk < loop.ChunkCount;
+                    chunk = loop.NextChunk.fetch_add(1, std::memory_order_relaxed))
+                {
+                    const size begin = chunk * loop.Grain;
+                    const size end = (std::min)(begin + loop.Grain, loop.Count);
+                    (*loop.Function)(chunk, begin, end);
+                    items += end - begin;
+                }
+
+                if(loop.Adaptive != nullptr && items > 0)
+                {
+                    loop.Adaptive->Record(items, GetChunkTime() - start);
+                }
+            }
+        };
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE size GetChunkCount(size count, size grain) noexcept
+        {
+            return (count + grain - 1) / grain;
+        }
+
+        /**
+         * @brief Calls fn(chunk, begin, end) for every chunk of grain items of [0, count), on the calling thread and on
+         * jobs. Returns once every chunk is done
+         */
+        template<typename F>
+        void ForEachChunk(JobSystem &jobs, size count, size grain, AdaptiveGrain *adaptive, F &fn)
+        {
+            ChunkLoop<F> loop{.Function = &fn,
+                              .Count = count,
+                              .Grain = grain,
+                              .ChunkCount = GetChunkCount(count, grain),
+                              .Adaptive = adaptive};
+
+            // NOTE: One job per thread at most, each one keeps taking chunks until there are none left
+            const auto helpers =
+                static_cast<u32>((std::min)(static_cast<size>(jobs.GetThreadCount()), loop.ChunkCount) - 1);
+            JobCounter counter;
+            if(helpers > 0)
+            {
+                const Job job{.Function = &ChunkLoop<F>::Run, .Data = &loop, .Counter = &counter};
+                SmallArray<Job, 64> helperJobs;
+                for(u32 i = 0; i < helpers; ++i)
+                {
+                    helperJobs.PushBack(job);
+                }
+                jobs.Run(std::span<const Job>{helperJobs.GetData(), helperJobs.GetSize()});
+            }
+
+            ChunkLoop<F>::Run(&loop);
+            jobs.Wait(counter);
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Calls fn(begin, end) over [0, count) in chunks of the grain size, in parallel
+     */
+    template<typename F>
+        requires std::invocable<F &, size, size>
+    void ParallelFor(JobSystem &jobs, size count, GrainSize grain, F &&fn)
+    {
+        if(count == 0)
+        {
+            return;
+        }
+
+        auto chunk = [&fn](size, size begin, size end) { fn(begin, end); };
+        Detail::ForEachChunk(jobs, count, grain.Get(count, jobs.GetThreadCount()), grain.GetAdaptive(), chunk);
+    }
+
+    /**
+     * @brief Calls fn(chunk) over consecutive chunks of values of the grain size, in parallel
+     */
+    template<typename T, typename F>
+        requires std::invocable<F &, std::span<T>>
+    void ParallelFor(JobSystem &jobs, std::span<T> values, GrainSize grain, F &&fn)
+    {
+        ParallelFor(jobs, values.size(), grain,
+                    [&fn, values](size begin, size end) { fn(values.subspan(begin, end - begin)); });
+    }
+
+    /**
+     * @brief Reduces [0, count) in parallel. Every chunk is reduced with map(begin, end) and the results are combined
+     * in order, so combine only needs to be associative
+     *
+     * @param identity The result of an empty range
+     * @param map Returns the reduction of [begin, end)
+     * @param combine Returns the combination of two reductions
+     */
+    template<typename T, typename Map, typename Combine>
+        requires std::invocable<Map &, size, size> && std::invocable<Combine &, T, T>
+    SSSENGINE_PURE T ParallelReduce(JobSystem &jobs, size count, GrainSize grain, T identity, Map &&map,
+                                    Combine &&combine)
+    {
+        if(count == 0)
+        {
+            return identity;
+        }
+
+        const size grainSize = grain.Get(count, jobs.GetThreadCount());
+        const size chunkCount = Detail::GetChunkCount(count, grainSize);
+        Detail::TemporaryArray<T> partials{Detail::GetTemporaryAllocator()};
+        partials.Reserve(chunkCount);
+        for(size i = 0; i < chunkCount; ++i)
+        {
+            partials.PushBack(identity);
+        }
+
+        auto chunk = [&](size index, size begin, size end) { partials[index] = map(begin, end); };
+        Detail::ForEachChunk(jobs, count, grainSize, grain.GetAdaptive(), chunk);
+
+        T result = std::move(identity);
+        for(T &partial: partials)
+        {
+            result = combine(std::move(result), std::move(partial));
+        }
+        return result;
+    }
+
+    namespace Detail
+    {
+        template<bool Inclusive, typename T, typename Op>
+        void Scan(JobSystem &jobs, std::span<const T> input, std::span<T> output, GrainSize grain, T identity, Op &op)
+        {
+            SSSENGINE_ASSERT(output.size() >= input.size());
+            const size count = input.size();
+            if(count == 0)
+            {
+                return;
+            }
+
+            // NOTE: Both passes must use the same chunks, the adaptive grain is only asked once
+            const size grainSize = grain.Get(count, jobs.GetThreadCount());
+            const size chunkCount = GetChunkCount(count, grainSize);
+
+            // NOTE: The first pass reduces every chunk, the second scans each chunk starting from the reduction of the
+            // chunks before it. Input and output may be the same span, each element is read before it is written
+            TemporaryArray<T> offsets{GetTemporaryAllocator()};
+            offsets.Reserve(chunkCount);
+            for(size i = 0; i < chunkCount; ++i)
+            {
+                offsets.PushBack(identity);
+            }
+
+            auto reduce = [&](size index, size begin, size end)
+            {
+                T total = identity;
+                for(size i = begin; i < end; ++i)
+                {
+                    total = op(std::move(total), input[i]);
+                }
+                offsets[index] = std::move(total);
+            };
+            ForEachChunk(jobs, count, grainSize, grain.GetAdaptive(), reduce);
+
+            T running = identity;
+            for(T &offset: offsets)
+            {
+                T next = op(running, offset);
+                offset = std::move(running);
+                running = std::move(next);
+            }
+
+            auto scan = [&](size index, size begin, size end)
+            {
+                T total = offsets[index];
+                for(size i = begin; i < end; ++i)
+                {
+                    if constexpr(Inclusive)
+                    {
+                        total = op(std::move(total), input[i]);
+                        output[i] = total;
+                    }
+                    else
+                    {
+                        T next = op(total, input[i]);
+                        output[i] = std::move(total);
+                        total = std::move(next);
+                    }
+                }
+            };
+            ForEachChunk(jobs, count, grainSize, grain.GetAdaptive(), scan);
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Writes to output[i] the combination of input[0] to input[i], in parallel. op must be associative
+     * T is deduced from output only, so the input can be any contiguous range of T
+     *
+     * @param identity The value that op leaves unchanged (0 for sums)
+     */
+    template<typename T, typename Op = std::plus<>>
+    void ParallelScan(JobSystem &jobs, std::span<const std::type_identity_t<T>> input, std::span<T> output,
+                      GrainSize grain, std::type_identity_t<T> identity = T{}, Op op = {})
+    {
+        Detail::Scan<true>(jobs, input, output, grain, std::move(identity), op);
+    }
+
+    /**
+     * @brief Writes to output[i] the combination of input[0] to input[i - 1], identity for the first one. Turns counts
+     * into offsets
+     */
+    template<typename T, typename Op = std::plus<>>
+    void ParallelExclusiveScan(JobSystem &jobs, std::span<const std::type_identity_t<T>> input, std::span<T> output,
+                               GrainSize grain, std::type_identity_t<T> identity = T{}, Op op = {})
+    {
+        Detail::Scan<false>(jobs, input, output, grain, std::move(identity), op);
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Below this sorts run on the calling thread
+         */
+        SSSENGINE_MAYBE_UNUSED constexpr size MinParallelSort = 16 * 1024;
+        /**
+         * @brief The smallest part of the keys a thread sorts or scatters on its own
+         */
+        SSSENGINE_MAYBE_UNUSED constexpr size MinSortPart = 8 * 1024;
+
+        /**
+         * @brief Least significant digit radix sort, a byte per pass. Every pass counts the digits of each part in
+         * parallel, turns the counts into the offsets each part writes to, and scatters the parts in parallel. Passes
+         * where every key has the same digit are skipped
+         */
+        template<std::integral K>
+        void RadixSort(JobSystem &jobs, std::span<K> keys)
+        {
+            using Unsigned = std::make_unsigned_t<K>;
+            constexpr size DigitCount = 256;
+            // NOTE: Flipping the sign bit orders signed keys like unsigned ones
+            constexpr Unsigned Bias = std::is_signed_v<K> ? Unsigned{1} << (sizeof(K) * 8 - 1) : Unsigned{0};
+
+            const size count = keys.size();
+            const size partCount =
+                (std::min)(static_cast<size>(jobs.GetThreadCount()) * 2, GetChunkCount(count, MinSortPart));
+            const size partSize = GetChunkCount(count, partCount);
+
+            TemporaryArray<K> buffer{GetTemporaryAllocator()};
+            buffer.ResizeUninitialized(count);
+            TemporaryArray<size> offsets{GetTemporaryAllocator()};
+            offsets.Resize(partCount * DigitCount);
+
+            K *source = keys.data();
+            K *destination = buffer.GetData();
+            for(u32 pass = 0; pass < sizeof(K); ++pass)
+            {
+                const auto digit = [pass](K key)
+                { return static_cast<size>((static_cast<Unsigned>(key) ^ Bias) >> (pass * 8) & 0xFF); };
+
+                ParallelFor(jobs, partCount, 1,
+                            [&](size first, size last)
+                            {
+                                const K *const keysToCount = source;
+                                for(size part = first; part < last; ++part)
+                                {
+                                    size counts[DigitCount] = {};
+                                    const size end = (std::min)((part + 1) * partSize, count);
+                                    for(size i = part * partSize; i < end; ++i)
+                                    {
+                                        ++counts[digit(keysToCount[i])];
+                                    }
+                                    std::copy_n(counts, DigitCount, offsets.GetData() + part * DigitCount);
+                                }
+                            });
+
+                // NOTE: Digit major so the parts keep their order inside a digit, which keeps the sort stable
+                size running = 0;
+                bool skip = false;
+                for(size value = 0; value < DigitCount; ++value)
+                {
+                    const size digitStart = running;
+                    for(size part = 0; part < partCount; ++part)
+                    {
+                        size &offset = offsets[part * DigitCount + value];
+                        const size partCountOfDigit = offset;
+                        offset = running;
+                        running += partCountOfDigit;
+                    }
+                    skip = skip || running - digitStart == count;
+                }
+                if(skip)
+                {
+                    continue;
+                }
+
+                ParallelFor(jobs, partCount, 1,
+                            [&](size first, size last)
+                            {
+                                // NOTE: Locals, so the compiler doesn't reload them after every store of a key
+                                const K *const from = source;
+                                K *const to = destination;
+                                for(size part = first; part < last; ++part)
+                                {
+                                    size writes[DigitCount];
+                                    std::copy_n(offsets.GetData() + part * DigitCount, DigitCount, writes);
+                                    const size end = (std::min)((part + 1) * partSize, count);
+                                    for(size i = part * partSize; i < end; ++i)
+                                    {
+                                        const K key = from[i];
+                                        to[writes[digit(key)]++] = key;
+                                    }
+                                }
+                            });
+                std::swap(source, destination);
+            }
+
+            if(source != keys.data())
+            {
+                ParallelFor(jobs, keys, MinSortPart,
+                            [&](std::span<K> chunk)
+                            { std::copy_n(source + (chunk.data() - keys.data()), chunk.size(), chunk.data()); });
+            }
+        }
+
+        /**
+         * @brief Sorts power of two parts in parallel and merges them in pairs, halving the parts every round
+         */
+        template<typename T, typename Compare>
+        void MergeSort(JobSystem &jobs, std::span<T> values, Compare &compare)
+        {
+            const size count = values.size();
+            const size partCount =
+                std::bit_floor((std::min)(static_cast<size>(jobs.GetThreadCount()) * 2, count / MinSortPart));
+            const size partSize = GetChunkCount(count, partCount);
+
+            ParallelFor(jobs, partCount, 1,
+                        [&](size first, size last)
+                        {
+                            for(size part = first; part < last; ++part)
+                            {
+                                const size begin = (std::min)(part * partSize, count);
+                                const size end = (std::min)(begin + partSize, count);
+                                std::sort(values.begin() + begin, values.begin() + end, compare);
+                            }
+                        });
+
+            for(size width = partSize; width < count; width *= 2)
+            {
+                const size pairCount = GetChunkCount(count, width * 2);
+                ParallelFor(jobs, pairCount, 1,
+                            [&](size first, size last)
+                            {
+                                for(size pair = first; pair < last; ++pair)
+                                {
+                                    const size begin = pair * width * 2;
+                                    const size middle = (std::min)(begin + width, count);
+                                    const size end = (std::min)(begin + width * 2, count);
+                                    std::inplace_merge(values.begin() + begin, values.begin() + middle,
+                                                       values.begin() + end, compare);
+                                }
+                            });
+            }
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Sorts values in parallel. Integer keys in the default order use a radix sort, which beats std::sort even
+     * on one thread. Anything else sorts parts with std::sort and merges them, so it is not stable
+     */
+    template<typename T, typename Compare = std::less<>>
+    void ParallelSort(JobSystem &jobs, std::span<T> values, Compare compare = {})
+    {
+        constexpr bool Radix = std::integral<T> && !std::same_as<T, bool> && std::same_as<Compare, std::less<>>;
+        if(values.size() < Detail::MinParallelSort || (!Radix && jobs.GetThreadCount() == 1))
+        {
+            std::sort(values.begin(), values.end(), compare);
+            return;
+        }
+
+        if constexpr(Radix)
+        {
+            Detail::RadixSort(jobs, values);
+        }
+        else
+        {
+            Detail::MergeSort(jobs, values, compare);
+        }
+    }
+} // namespace SSSEngine::Core::Threading
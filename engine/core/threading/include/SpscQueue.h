@@ -0,0 +1,242 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Bounded wait-free queue between one producer thread and one consumer thread
+ * The producer only writes the tail and the consumer only writes the head, each on its own cache line. Both sides keep
+ * a copy of the other index and only read the shared one when the copy says the queue is full or empty, so in the
+ * steady state a push or a pop doesn't touch a cache line the other thread writes.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "Attributes.h"
+#include "ContainerAllocator.h"
+#include "Memory.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @class SpscQueue
+     * @brief Fixed capacity FIFO queue. Only one thread may push and only one thread may pop at a time
+     *
+     * @tparam T The type of the values. Must be nothrow movable
+     * @tparam A The allocator of the slots, only used when the queue is created and destroyed
+     */
+    template<typename T, ContainerAllocatorConcept A = GlobalAllocator>
+    class SpscQueue
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                      "SpscQueue values must be nothrow movable");
+
+        public:
+        using ValueType = T;
+
+        /**
+         * @param capacity The number of values the queue can hold. Rounded up to a power of two
+         * @throws std::bad_alloc if the slots could not be allocated
+         */
+        explicit SpscQueue(size capacity, const A &allocator = A{}) :
+        m_capacity{std::bit_ceil((std::max)(capacity, size{2}))}, m_allocator{allocator}
+        {
+            m_slots = static_cast<T *>(m_allocator.Allocate(sizeof(T) * m_capacity, alignof(T)));
+            if(m_slots == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        SpscQueue(const SpscQueue &) = delete;
+        SpscQueue(SpscQueue &&) = delete;
+        SpscQueue &operator=(const SpscQueue &) = delete;
+        SpscQueue &operator=(SpscQueue &&) = delete;
+
+        /**
+         * @brief Destroys the values still in the queue. No thread may be using it
+         */
+        ~SpscQueue()
+        {
+            const size tail = m_producer.Tail.load(std::memory_order_relaxed);
+            for(size head = m_consumer.Head.load(std::memory_order_relaxed); head != tail; ++head)
+            {
+                std::destroy_at(Slot(head));
+            }
+            m_allocator.Deallocate(m_slots, sizeof(T) * m_capacity, alignof(T));
+        }
+
+        /**
+         * @brief Constructs a value at the back of the queue. Producer only
+         *
+         * @return False if the queue was full, nothing is constructed then
+         */
+        template<typename... Args>
+        bool TryEmplace(Args &&...args)
+        {
+            const size tail = m_producer.Tail.load(std::memory_order_relaxed);
+            if(tail - m_producer.CachedHead == m_capacity)
+            {
+                m_producer.CachedHead = m_consumer.Head.load(std::memory_order_acquire);
+                if(tail - m_producer.CachedHead == m_capacity)
+                {
+                    return false;
+                }
+            }
+
+            std::construct_at(Slot(tail), std::forward<Args>(args)...);
+            m_producer.Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPush(const T &value)
+        {
+            return TryEmplace(value);
+        }
+
+        bool TryPush(T &&value)
+        {
+            return TryEmplace(std::move(value));
+        }
+
+        /**
+         * @brief Moves as many values as fit into the queue, in order, and publishes them all at once. Producer only
+         *
+         * @param values The values to push. The first returned count are moved from
+         * @return The number of values pushed
+         */
+        size TryPushBatch(std::span<T> values) noexcept
+        {
+            const size tail = m_producer.Tail.load(std::memory_order_relaxed);
+            if(m_capacity - (tail - m_producer.CachedHead) < values.size())
+            {
+                m_producer.CachedHead = m_consumer.Head.load(std::memory_order_acquire);
+            }
+
+            const size count = (std::min)(values.size(), m_capacity - (tail - m_producer.CachedHead));
+            for(size i = 0; i < count; ++i)
+            {
+                std::construct_at(Slot(tail + i), std::move(values[i]));
+            }
+            m_producer.Tail.store(tail + count, std::memory_order_release);
+
+            return count;
+        }
+
+        /**
+         * @brief Moves the value at the front of the queue into out. Consumer only
+         *
+         * @return False if the queue was empty, out is untouched then
+         */
+        bool TryPop(T &out) noexcept
+        {
+            const size head = m_consumer.Head.load(std::memory_order_relaxed);
+            if(head == m_consumer.CachedTail)
+            {
+                m_consumer.CachedTail = m_producer.Tail.load(std::memory_order_acquire);
+                if(head == m_consumer.CachedTail)
+                {
+                    return false;
+                }
+            }
+
+            T *value = Slot(head);
+            out = std::move(*value);
+            std::destroy_at(value);
+            m_consumer.Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Moves as many values as are in the queue, up to out.size(), into out in order. Consumer only
+         *
+         * @return The number of values popped
+         */
+        size TryPopBatch(std::span<T> out) noexcept
+        {
+            const size head = m_consumer.Head.load(std::memory_order_relaxed);
+            if(m_consumer.CachedTail - head < out.size())
+            {
+                m_consumer.CachedTail = m_producer.Tail.load(std::memory_order_acquire);
+            }
+
+            const size count = (std::min)(out.size(), m_consumer.CachedTail - head);
+            for(size i = 0; i < count; ++i)
+            {
+                T *value = Slot(head + i);
+                out[i] = std::move(*value);
+                std::destroy_at(value);
+            }
+            m_consumer.Head.store(head + count, std::memory_order_release);
+
+            return count;
+        }
+
+        SSSENGINE_PURE size GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief The number of values in the queue. Only a hint while other threads push or pop
+         */
+        SSSENGINE_PURE size GetSizeApprox() const noexcept
+        {
+            const size head = m_consumer.Head.load(std::memory_order_acquire);
+            const size tail = m_producer.Tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        private:
+        SSSENGINE_PURE T *Slot(size index) const noexcept
+        {
+            return m_slots + (index & (m_capacity - 1));
+        }
+
+        // NOTE: The indices only grow and are wrapped when a slot is accessed, so full and empty can be told apart
+        // without leaving a slot unused. A 64 bit index doesn't wrap in the lifetime of the program
+        struct alignas(Platform::CacheLineDestructive) ProducerState
+        {
+            std::atomic<size> Tail{0};
+            size CachedHead{0};
+        };
+
+        struct alignas(Platform::CacheLineDestructive) ConsumerState
+        {
+            std::atomic<size> Head{0};
+            size CachedTail{0};
+        };
+
+        ProducerState m_producer;
+        ConsumerState m_consumer;
+
+        // NOTE: Never written after construction, shared by both threads on a line of their own
+        alignas(Platform::CacheLineDestructive) T *m_slots{nullptr};
+        size m_capacity{0};
+        SSSENGINE_NO_UNIQUE_ADDRESS A m_allocator;
+    };
+} // namespace SSSEngine::Core::Threading
@@ -0,0 +1,194 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Fixed capacity Chase-Lev work stealing deque
+ * The owner thread pushes and pops at the bottom without taking turns with anyone, only the last value needs a compare
+ * exchange in case a thief takes it at the same time. Other threads steal from the top with a compare exchange. This
+ * is the version of Le, Pop, Cohen and Zappa Nardelli for the C++ memory model, without growing the buffer.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "Attributes.h"
+#include "ContainerAllocator.h"
+#include "Memory.h"
+#include "Types.h"
+
+namespace SSSEngine::Core::Threading
+{
+    /**
+     * @class WorkStealingDeque
+     * @brief Deque of small values where one thread pushes and pops at the bottom and any thread steals from the top
+     *
+     * @tparam T The type of the values. Stored in atomics, so it must be trivially copyable and lock-free
+     * @tparam A The allocator of the buffer, only used when the deque is created and destroyed
+     */
+    template<typename T, ContainerAllocatorConcept A = GlobalAllocator>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free,
+                      "WorkStealingDeque values must fit in a lock-free atomic");
+
+        public:
+        using ValueType = T;
+
+        /**
+         * @param capacity The number of values the deque can hold. Rounded up to a power of two
+         * @throws std::bad_alloc if the buffer could not be allocated
+         */
+        explicit WorkStealingDeque(size capacity, const A &allocator = A{}) :
+        m_capacity{std::bit_ceil((std::max)(capacity, size{2}))}, m_allocator{allocator}
+        {
+            m_buffer = static_cast<std::atomic<T> *>(
+                m_allocator.Allocate(sizeof(std::atomic<T>) * m_capacity, alignof(std::atomic<T>)));
+            if(m_buffer == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            std::uninitialized_default_construct_n(m_buffer, m_capacity);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+        WorkStealingDeque(WorkStealingDeque &&) = delete;
+        WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+        WorkStealingDeque &operator=(WorkStealingDeque &&) = delete;
+
+        ~WorkStealingDeque()
+        {
+            std::destroy_n(m_buffer, m_capacity);
+            m_allocator.Deallocate(m_buffer, sizeof(std::atomic<T>) * m_capacity, alignof(std::atomic<T>));
+        }
+
+        /**
+         * @brief Adds value at the bottom. Owner only
+         *
+         * @return False if the deque was full
+         */
+        bool Push(T value) noexcept
+        {
+            const i64 bottom = m_bottom.load(std::memory_order_relaxed);
+            const i64 top = m_top.load(std::memory_order_acquire);
+            if(bottom - top >= static_cast<i64>(m_capacity))
+            {
+                return false;
+            }
+
+            Slot(bottom).store(value, std::memory_order_relaxed);
+            // NOTE: Publishes the value and everything written before pushing it to the thieves that read bottom
+            m_bottom.store(bottom + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Takes the value at the bottom, the last one pushed. Owner only
+         *
+         * @return False if the deque was empty, or a thief took the last value first
+         */
+        bool Pop(T &out) noexcept
+        {
+            const i64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            // NOTE: Thieves must see the lowered bottom before we read top, or both sides could take the last value
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            i64 top = m_top.load(std::memory_order_relaxed);
+
+            if(top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = Slot(bottom).load(std::memory_order_relaxed);
+            if(top == bottom)
+            {
+                // NOTE: The last value, a thief may be taking it. Whoever moves top first gets it
+                const bool won =
+                    m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Takes the value at the top, the oldest one. Any thread
+         *
+         * @return False if the deque was empty or another thread took the value first. Callers usually try another
+         * deque instead of retrying
+         */
+        bool Steal(T &out) noexcept
+        {
+            i64 top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const i64 bottom = m_bottom.load(std::memory_order_acquire);
+            if(top >= bottom)
+            {
+                return false;
+            }
+
+            // NOTE: The slot can only be overwritten after top moves past it, which fails the compare exchange
+            const T value = Slot(top).load(std::memory_order_relaxed);
+            if(!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            out = value;
+            return true;
+        }
+
+        SSSENGINE_PURE size GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief The number of values in the deque. Only a hint while other threads push, pop or steal
+         */
+        SSSENGINE_PURE size GetSizeApprox() const noexcept
+        {
+            const i64 bottom = m_bottom.load(std::memory_order_relaxed);
+            const i64 top = m_top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size>(bottom - top) : 0;
+        }
+
+        private:
+        SSSENGINE_PURE std::atomic<T> &Slot(i64 index) const noexcept
+        {
+            return m_buffer[static_cast<size>(index) & (m_capacity - 1)];
+        }
+
+        // NOTE: Signed so the owner can lower bottom below top while popping from an empty deque
+        alignas(Platform::CacheLineDestructive) std::atomic<i64> m_top{0};
+        alignas(Platform::CacheLineDestructive) std::atomic<i64> m_bottom{0};
+
+        alignas(Platform::CacheLineDestructive) std::atomic<T> *m_buffer{nullptr};
+        size m_capacity{0};
+        SSSENGINE_NO_UNIQUE_ADDRESS A m_allocator;
+    };
+} // namespace SSSEngine::Core::Threading
@@ -0,0 +1,278 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "JobSystem.h"
+#include "Cpu.h"
+#include "Debug.h"
+#include "Threading.h"
+
+namespace SSSEngine::Core::Threading
+{
+    namespace
+    {
+        /**
+         * @brief The system the calling thread belongs to and its index in it
+         */
+        struct CurrentThread
+        {
+            const JobSystem *System{nullptr};
+            u32 Index{JobSystem::InvalidThread};
+            u32 RandomState{0};
+        };
+
+        thread_local CurrentThread Current;
+
+        /**
+         * @brief Xorshift, only used to spread the thieves over the victims
+         */
+        u32 NextRandom()
+        {
+            u32 state = Current.RandomState == 0 ? 0x9E3779B9u : Current.RandomState;
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            Current.RandomState = state;
+            return state;
+        }
+    } // namespace
+
+    JobSystem::JobSystem(u32 threadCount) :
+    m_threadCount{threadCount == 0 ? Platform::GetPhysicalCoreCount() : threadCount},
+    m_threads{std::make_unique<ThreadState[]>(m_threadCount)}
+    {
+        SSSENGINE_ASSERT(Current.System == nullptr && "The thread is already part of a job system");
+        Current = {.System = this, .Index = 0, .RandomState = 1};
+
+        for(u32 i = 1; i < m_threadCount; ++i)
+        {
+            m_threads[i].Thread = std::thread([this, i]() { WorkerMain(i); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        m_running.store(false, std::memory_order_seq_cst);
+        m_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+        Platform::WakeAllOnAddress(m_wakeEpoch);
+
+        for(u32 i = 1; i < m_threadCount; ++i)
+        {
+            m_threads[i].Thread.join();
+        }
+
+        if(Current.System == this)
+        {
+            Current = {};
+        }
+    }
+
+    void JobSystem::Run(const Job &job)
+    {
+        if(Submit(job, GetCurrentThreadIndex()))
+        {
+            Wake(1);
+        }
+    }
+
+    void JobSystem::Run(std::span<const Job> jobs)
+    {
+        const u32 threadIndex = GetCurrentThreadIndex();
+        u32 queued = 0;
+        for(const Job &job: jobs)
+        {
+            queued += Submit(job, threadIndex) ? 1 : 0;
+        }
+        Wake(queued);
+    }
+
+    void JobSystem::Wait(const JobCounter &counter)
+    {
+        const u32 threadIndex = GetCurrentThreadIndex();
+        u32 idle = 0;
+        while(!counter.IsDone())
+        {
+            Memory::Handle<Job> handle;
+            if(TryTake(threadIndex, handle))
+            {
+                Execute(handle);
+                idle = 0;
+            }
+            else if(++idle < SpinCount)
+            {
+                Platform::CpuRelax();
+            }
+            else
+            {
+                // NOTE: The jobs left are running on other threads, give them the core
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    u32 JobSystem::GetCurrentThreadIndex() const noexcept
+    {
+        return Current.System == this ? Current.Index : InvalidThread;
+    }
+
+    bool JobSystem::Submit(const Job &job, u32 threadIndex)
+    {
+        SSSENGINE_ASSERT(job.Function != nullptr);
+        if(job.Counter != nullptr)
+        {
+            job.Counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const Memory::Handle<Job> handle = m_jobs.Create(job);
+        if(handle.IsValid())
+        {
+            const bool queued = (threadIndex != InvalidThread && m_threads[threadIndex].Deque.Push(handle)) ||
+                                m_shared.TryPush(handle);
+            if(queued)
+            {
+                return true;
+            }
+            m_jobs.Destroy(handle);
+        }
+
+        // NOTE: Every queue is full, the caller does the job itself
+        job.Function(job.Data);
+        Finish(job);
+        return false;
+    }
+
+    bool JobSystem::TryTake(u32 threadIndex, Memory::Handle<Job> &handle)
+    {
+        if(threadIndex != InvalidThread && m_threads[threadIndex].Deque.Pop(handle))
+        {
+            return true;
+        }
+        if(m_shared.TryPop(handle))
+        {
+            return true;
+        }
+
+        // NOTE: Start at a random thread so the thieves don't all go after the same victim
+        const u32 first = NextRandom() % m_threadCount;
+        for(u32 i = 0; i < m_threadCount; ++i)
+        {
+            const u32 victim = (first + i) % m_threadCount;
+            if(victim != threadIndex && m_threads[victim].Deque.Steal(handle))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::Execute(Memory::Handle<Job> handle)
+    {
+        // NOTE: The slot is freed before running so jobs that queue more jobs can reuse it
+        const Job job = *m_jobs.Get(handle);
+        m_jobs.Destroy(handle);
+
+        job.Function(job.Data);
+        Finish(job);
+    }
+
+    void JobSystem::Finish(const Job &job)
+    {
+        if(job.Counter != nullptr)
+        {
+            job.Counter->m_pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void JobSystem::Wake(u32 count)
+    {
+        if(count == 0)
+        {
+            return;
+        }
+
+        // NOTE: Pairs with the registration in WorkerMain, see there
+        m_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+        if(m_sleepers.load(std::memory_order_seq_cst) == 0)
+        {
+            return;
+        }
+
+        if(count == 1)
+        {
+            Platform::WakeOneOnAddress(m_wakeEpoch);
+        }
+        else
+        {
+            Platform::WakeAllOnAddress(m_wakeEpoch);
+        }
+    }
+
+    void JobSystem::WorkerMain(u32 threadIndex)
+    {
+        Current = {.System = this, .Index = threadIndex, .RandomState = threadIndex + 1};
+
+        u32 idle = 0;
+        while(true)
+        {
+            Memory::Handle<Job> handle;
+            if(TryTake(threadIndex, handle))
+            {
+                Execute(handle);
+                idle = 0;
+                continue;
+            }
+            if(++idle < SpinCount)
+            {
+                Platform::CpuRelax();
+                continue;
+            }
+
+            // NOTE: Registering, reading the epoch and looking for jobs again are sequentially consistent, like bumping
+            // the epoch and reading the sleepers in Wake. Either the submitter sees us registered and wakes us, or we
+            // see its new epoch and WaitOnAddress returns right away
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            const u32 epoch = m_wakeEpoch.load(std::memory_order_seq_cst);
+            const bool running = m_running.load(std::memory_order_seq_cst);
+            const bool found = running && TryTake(threadIndex, handle);
+            if(running && !found)
+            {
+                Platform::WaitOnAddress(m_wakeEpoch, epoch);
+            }
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+
+            if(!running)
+            {
+                return;
+            }
+            if(found)
+            {
+                Execute(handle);
+            }
+            idle = 0;
+        }
+    }
+} // namespace SSSEngine::Core::Threading
@@ -0,0 +1,63 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <algorithm>
+#include <atomic>
+#include "Parallel.h"
+#include "Timer.h"
+
+namespace SSSEngine::Core::Threading
+{
+    size AdaptiveGrain::GetGrainSize(size count, u32 threadCount) const noexcept
+    {
+        const u64 cost = m_costPerItem.load(std::memory_order_relaxed);
+        // NOTE: Until the first measurement the loop is split evenly in a few chunks per thread
+        const size grain = cost == 0 ? count / (static_cast<size>(threadCount) * InitialChunksPerThread)
+                                     : static_cast<size>(TargetChunkNanoseconds * CostScale / cost);
+
+        return std::clamp(grain, m_minGrain, (std::max)(count, m_minGrain));
+    }
+
+    void AdaptiveGrain::Record(size items, u64 nanoseconds) noexcept
+    {
+        if(items == 0)
+        {
+            return;
+        }
+
+        const u64 sample = (std::max)(nanoseconds * CostScale / items, u64{1});
+        const u64 previous = m_costPerItem.load(std::memory_order_relaxed);
+        // NOTE: Exponential moving average, a new sample weighs a quarter
+        const u64 cost = previous == 0 ? sample : previous - previous / 4 + sample / 4;
+        m_costPerItem.store((std::max)(cost, u64{1}), std::memory_order_relaxed);
+    }
+
+    namespace Detail
+    {
+        u64 GetChunkTime() noexcept
+        {
+            return Platform::ToNanoSeconds(Platform::GetCurrentTime());
+        }
+    } // namespace Detail
+} // namespace SSSEngine::Core::Threading
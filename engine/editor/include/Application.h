@@ -26,6 +26,9 @@
 
 #include <memory>
 
+#include "Arena.h"
+#include "FrameAllocator.h"
+#include "JobSystem.h"
 #include "Renderer.h"
 #include "Window.h"
 
@@ -49,12 +52,32 @@ namespace SSSEngine::Editor
         ~Application()
         {
             Renderer::Unload();
+            std::destroy_at(m_Window);
         };
 
         void Run();
 
+        static constexpr size PersistentArenaSize = 1_GiB;
+        static constexpr size FrameAllocatorSize = 32_MiB;
+        /**
+         * @brief How many frames between logs of the memory tags
+         */
+        static constexpr u64 MemoryDumpInterval = 3600;
+
         private:
-        std::unique_ptr<Core::Window> m_Window;
+        /**
+         * @brief Backs everything that lives as long as the application
+         */
+        Core::Memory::Arena m_PersistentArena{PersistentArenaSize, Core::Memory::MemoryTag::Editor};
+        /**
+         * @brief Backs the scratch data of the frames in flight
+         */
+        Core::Memory::FrameAllocator m_FrameAllocator{FrameAllocatorSize};
+        /**
+         * @brief Runs the parallel work of the frames, one thread per physical core with the main thread included
+         */
+        Core::Threading::JobSystem m_JobSystem;
+        Core::Window *m_Window{nullptr};
         bool m_Running = false;
     };
 
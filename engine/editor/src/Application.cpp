@@ -23,26 +23,30 @@
  */
 
 #include <iostream>
-#include <memory>
 
 #include "Application.h"
 #include "Debug.h"
 #include "Platform.h"
 #include "Audio.h"
+#include "Cpu.h"
 #include "Timer.h"
 #include "Input.h"
+#include "MathKernels.h"
+#include "MemoryTags.h"
 #include "WindowHandle.h"
 
 namespace SSSEngine::Editor
 {
     Application::Application()
     {
+        Math::Kernels::LoadKernels(Platform::GetSimdLevel());
+
         Renderer::LoadDirectx();
         Audio::Init();
 
-        // TODO: Manage memory
-        m_Window = std::make_unique<Core::Window>(
-            Platform::WindowVec{0, 0}, Platform::WindowVec{3440, 1440}, Platform::MainWindowName);
+        m_Window = m_PersistentArena.New<Core::Window>(Platform::WindowVec{0, 0}, Platform::WindowVec{3440, 1440},
+                                                      Platform::MainWindowName);
+        SSSENGINE_ASSERT(m_Window);
     }
 
     void Application::Run()
@@ -52,8 +56,9 @@ namespace SSSEngine::Editor
 
         Renderer::LoadAssetsTest();
         Platform::Timestamp firstTimestamp = Platform::GetCurrentTime();
-        while(m_Running)
+        for(u64 frameIndex = 0; m_Running; ++frameIndex)
         {
+            m_FrameAllocator.BeginFrame(frameIndex);
             m_Running = Input::HandleInput();
 
             // Render
@@ -62,6 +67,10 @@ namespace SSSEngine::Editor
                 {
                     Renderer::BeginFrame();
                     Renderer::Render();
+
+                    // NOTE: Render waits for the GPU at the end of the frame, so the frame is retired right away until
+                    // frames overlap
+                    m_FrameAllocator.Retire(frameIndex);
                 }
                 catch(std::exception &e)
                 {
@@ -71,6 +80,12 @@ namespace SSSEngine::Editor
                 }
             }
 
+            Core::Memory::UpdateMemoryTags();
+            if(frameIndex % MemoryDumpInterval == 0)
+            {
+                Core::Memory::DumpMemoryTags();
+            }
+
             Platform::Timestamp lastTimestamp = Platform::GetCurrentTime();
             u64 elapsedMicroseconds = Platform::ToMicroSeconds(lastTimestamp - firstTimestamp);
             SSSENGINE_ASSERT(elapsedMicroseconds > 0);
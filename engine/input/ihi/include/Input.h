@@ -24,8 +24,7 @@
 
 #pragma once
 
-#include <unordered_map>
-
+#include "FlatHashMap.h"
 #include "HelperMacros.h"
 #include "Keycodes.h"
 #include "ButtonState.h"
@@ -35,8 +34,8 @@ namespace SSSEngine::Input
 {
     // TODO: This is an initial input system and will be updated later
     // It will need a way to figure each event even during each frame by buffering input and dispatching events
-    SSSENGINE_GLOBAL std::unordered_map<KeyboardCodes, ButtonState> KeyboardButtons;
-    SSSENGINE_GLOBAL std::unordered_map<MouseButton, ButtonState> MouseButtons;
+    SSSENGINE_GLOBAL FlatHashMap<KeyboardCodes, ButtonState> KeyboardButtons;
+    SSSENGINE_GLOBAL FlatHashMap<MouseButton, ButtonState> MouseButtons;
     SSSENGINE_GLOBAL Math::Vector2<float> MouseDirection;
 
     bool HandleInput();
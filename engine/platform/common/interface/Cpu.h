@@ -0,0 +1,135 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Query of the instruction sets supported by the CPU running the engine
+ */
+
+#pragma once
+
+#include "Attributes.h"
+#include "HelperMacros.h"
+#include "Intrinsics.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    /**
+     * @class CpuFeatures
+     * @brief The instruction sets that can be used. A feature is only set when both the CPU and the OS support it
+     *
+     */
+    struct CpuFeatures
+    {
+        bool Sse42 = false;
+        bool Avx = false;
+        bool Avx2 = false;
+        bool Fma = false;
+        bool F16C = false;
+        bool Avx512F = false;
+        bool Avx512VL = false;
+    };
+
+    /**
+     * @brief Gets the features of the CPU. The query is only done on the first call
+     */
+    const CpuFeatures &GetCpuFeatures();
+
+    /**
+     * @brief The number of physical cores the process can run on, the hardware threads of a core count once. At least
+     * 1. The query is only done on the first call
+     */
+    u32 GetPhysicalCoreCount();
+
+    /**
+     * @brief The highest SimdLevel every feature of which is supported
+     */
+    SSSENGINE_GLOBAL SimdLevel GetSimdLevel(const CpuFeatures &features)
+    {
+        if(!features.Sse42)
+        {
+            return SimdLevel::Sse2;
+        }
+        if(!features.Avx)
+        {
+            return SimdLevel::Sse42;
+        }
+        if(!features.Avx2 || !features.Fma || !features.F16C)
+        {
+            return SimdLevel::Avx;
+        }
+        if(!features.Avx512F || !features.Avx512VL)
+        {
+            return SimdLevel::Avx2;
+        }
+
+        return SimdLevel::Avx512;
+    }
+
+    SSSENGINE_GLOBAL SimdLevel GetSimdLevel()
+    {
+        return GetSimdLevel(GetCpuFeatures());
+    }
+
+    namespace Detail
+    {
+        /**
+         * @brief Bit of ECX of CPUID leaf 1 set when the OS enabled XGETBV
+         */
+        SSSENGINE_MAYBE_UNUSED constexpr u32 OsXsaveBit = 1u << 27;
+
+        /**
+         * @brief Decodes the registers returned by CPUID and XGETBV. Shared by the platform implementations since only
+         * the way to read the registers changes
+         *
+         * @param leaf1Ecx ECX of CPUID leaf 1
+         * @param leaf7Ebx EBX of CPUID leaf 7 sub leaf 0
+         * @param xcr0 The XCR0 register. Must be 0 when the OS does not support XSAVE (OSXSAVE not set)
+         */
+        SSSENGINE_GLOBAL CpuFeatures DecodeCpuFeatures(u32 leaf1Ecx, u32 leaf7Ebx, u64 xcr0)
+        {
+            constexpr u32 Sse42Bit = 1u << 20;
+            constexpr u32 FmaBit = 1u << 12;
+            constexpr u32 AvxBit = 1u << 28;
+            constexpr u32 F16CBit = 1u << 29;
+            constexpr u32 Avx2Bit = 1u << 5;
+            constexpr u32 Avx512FBit = 1u << 16;
+            constexpr u32 Avx512VLBit = 1u << 31;
+
+            // NOTE: The OS must save the registers on context switches. SSE and AVX state for AVX, plus the opmask and
+            // the upper ZMM registers for AVX-512
+            constexpr u64 AvxState = 0x6;
+            constexpr u64 Avx512State = 0xE6;
+            const bool avxEnabled = (xcr0 & AvxState) == AvxState;
+            const bool avx512Enabled = (xcr0 & Avx512State) == Avx512State;
+
+            CpuFeatures features;
+            features.Sse42 = (leaf1Ecx & Sse42Bit) != 0;
+            features.Avx = avxEnabled && (leaf1Ecx & AvxBit) != 0;
+            features.Fma = features.Avx && (leaf1Ecx & FmaBit) != 0;
+            features.F16C = features.Avx && (leaf1Ecx & F16CBit) != 0;
+            features.Avx2 = features.Avx && (leaf7Ebx & Avx2Bit) != 0;
+            features.Avx512F = avx512Enabled && (leaf7Ebx & Avx512FBit) != 0;
+            features.Avx512VL = features.Avx512F && (leaf7Ebx & Avx512VLBit) != 0;
+
+            return features;
+        }
+    } // namespace Detail
+} // namespace SSSEngine::Platform
@@ -20,10 +20,14 @@
 /**
  * @file
  * @brief Interface for interacting with the OS Memory capabilities
+ * Besides plain allocations, address space can be reserved up front and committed as it is used. Reserving is cheap
+ * and only committed pages count against the system memory, so allocators can reserve their maximum size once and never
+ * move. Reservations can also ask for 2 MiB pages to cut the TLB misses of large, densely used ranges.
  */
 
 #pragma once
 
+#include "HelperMacros.h"
 #include "Types.h"
 #include <new>
 
@@ -33,10 +37,40 @@ namespace SSSEngine::Platform
 #ifdef __cpp_lib_hardware_interference_size
     SSSENGINE_GLOBAL constexpr size CacheLineConstructive = std::hardware_constructive_interference_size;
     SSSENGINE_GLOBAL constexpr size CacheLineDestructive = std::hardware_destructive_interference_size;
-#elif
-    SSSENGINE_GLOBAL size CacheLineConstructive = 64 SSSENGINE_GLOBAL size CacheLineDestructive = 64
+#else
+    SSSENGINE_GLOBAL constexpr size CacheLineConstructive = 64;
+    SSSENGINE_GLOBAL constexpr size CacheLineDestructive = 64;
 #endif
 
+    /**
+     * @brief The size of the huge pages on x64 (large pages on Windows)
+     */
+    SSSENGINE_GLOBAL constexpr size HugePageSize = 2_MiB;
+
+    /**
+     * @class PageKind
+     * @brief The kind of pages backing a reservation
+     *
+     */
+    enum class PageKind : u8
+    {
+        /**
+         * @brief The default pages of the OS, 4 KiB on x64
+         */
+        Normal,
+        /**
+         * @brief Normal pages the OS may promote to huge pages on its own (transparent huge pages on Linux, aligned to
+         * HugePageSize so the whole range qualifies). Same as Normal where the OS does not support it
+         */
+        TransparentHuge,
+        /**
+         * @brief Explicit huge pages. They can't be paged out so the OS must have them available (hugetlbfs pages on
+         * Linux, the lock pages in memory privilege on Windows). The whole reservation is committed right away and must
+         * not be passed to Commit or Decommit. The size is rounded up to HugePageSize
+         */
+        Huge,
+    };
+
     /**
      * @class MemorySnapshot
      * @brief Represents a memory snapshot
@@ -80,7 +114,51 @@ namespace SSSEngine::Platform
      * @see AllocateMemory
      *
      * @param address The memory address to free
+     * @param bytes The size given to AllocateMemory. Needed by the OSes that unmap by range
+     * @return True if it succeeded, false otherwise
+     */
+    bool FreeMemory(void *address, size bytes);
+
+    /**
+     * @brief The size of a normal page. Commit and Decommit work on whole pages
+     */
+    size GetPageSize();
+
+    /**
+     * @brief Reserves address space without backing it with memory. Accessing it before committing it is an access
+     * violation
+     *
+     * @param bytes The size of the range. Rounded up to the page size of the kind
+     * @param kind The pages that will back the range
+     * @return The start of the range, aligned at least to the page size of the kind. nullptr if it failed
+     */
+    void *ReserveAddressSpace(size bytes, PageKind kind = PageKind::Normal);
+
+    /**
+     * @brief Backs pages of a reserved range with zeroed memory that can be read and written
+     *
+     * @param address Must be aligned to GetPageSize and inside a range returned by ReserveAddressSpace
+     * @param bytes Rounded up to the page size
+     * @return True if it succeeded, false otherwise
+     */
+    bool Commit(void *address, size bytes);
+
+    /**
+     * @brief Gives the memory of committed pages back to the OS but keeps them reserved. The next Commit zeroes them
+     *
+     * @param address Must be aligned to GetPageSize and inside a range returned by ReserveAddressSpace
+     * @param bytes Rounded up to the page size
+     * @return True if it succeeded, false otherwise
+     */
+    bool Decommit(void *address, size bytes);
+
+    /**
+     * @brief Releases a whole range returned by ReserveAddressSpace, committed or not
+     *
+     * @param address The address returned by ReserveAddressSpace
+     * @param bytes The size given to ReserveAddressSpace
+     * @param kind The kind given to ReserveAddressSpace
      * @return True if it succeeded, false otherwise
      */
-    bool FreeMemory(void *address);
+    bool ReleaseAddressSpace(void *address, size bytes, PageKind kind = PageKind::Normal);
 } // namespace SSSEngine::Platform
@@ -0,0 +1,67 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Interface for blocking threads on the OS
+ * Threads sleep on the address of a 32 bit value until another thread changes it and wakes them (futex on Linux,
+ * WaitOnAddress on Windows). Nothing is allocated to wait, so any atomic can be waited on, and waking a value nobody
+ * waits on only costs the system call.
+ */
+
+#pragma once
+
+#include <atomic>
+#include "Attributes.h"
+#include "Intrinsics.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32) && std::atomic<u32>::is_always_lock_free,
+                  "The OS waits on the raw value of the atomic");
+
+    /**
+     * @brief Blocks the calling thread while address holds undesired. Returns right away if it doesn't. The thread can
+     * also wake up without the value changing, callers must check it again
+     *
+     * @param address The value to wait on
+     * @param undesired The value that keeps the thread blocked
+     */
+    void WaitOnAddress(const std::atomic<u32> &address, u32 undesired);
+
+    /**
+     * @brief Wakes one thread blocked on address by WaitOnAddress, if any
+     */
+    void WakeOneOnAddress(std::atomic<u32> &address);
+
+    /**
+     * @brief Wakes every thread blocked on address by WaitOnAddress
+     */
+    void WakeAllOnAddress(std::atomic<u32> &address);
+
+    /**
+     * @brief Tells the CPU the thread is spinning on a value another core will write, so it can save power and give
+     * the core to the sibling hyperthread
+     */
+    SSSENGINE_FORCE_INLINE void CpuRelax()
+    {
+        _mm_pause();
+    }
+} // namespace SSSEngine::Platform
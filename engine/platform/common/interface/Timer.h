@@ -72,4 +72,9 @@ namespace SSSEngine::Platform
      * @return [TODO:return]
      */
     u64 ToMicroSeconds(Timestamp timestamp);
+
+    /**
+     * @brief Converts a timestamp to a duration in nanoseconds. Meant for short intervals, like timing a piece of work
+     */
+    u64 ToNanoSeconds(Timestamp timestamp);
 } // namespace SSSEngine::Platform
@@ -0,0 +1,121 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <cpuid.h>
+#include <fstream>
+#include <sched.h>
+#include <string>
+#include "Cpu.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    namespace
+    {
+        u64 ReadXcr0()
+        {
+            u32 eax = 0;
+            u32 edx = 0;
+            // NOTE: xgetbv with ECX = 0. Inline assembly so the file doesn't need to be compiled with -mxsave
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+            return (static_cast<u64>(edx) << 32) | eax;
+        }
+
+        /**
+         * @brief The lowest numbered hardware thread of the core of cpu, or cpu itself if the topology is unknown
+         */
+        u32 GetFirstSibling(u32 cpu)
+        {
+            std::ifstream siblings{"/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                   "/topology/thread_siblings_list"};
+            // NOTE: The list is sorted, "0,8" or "0-1", so the first number is the lowest
+            u32 first = cpu;
+            siblings >> first;
+            return first;
+        }
+    } // namespace
+
+    const CpuFeatures &GetCpuFeatures()
+    {
+        SSSENGINE_FUNCTION_LOCAL const CpuFeatures Features = []()
+        {
+            u32 eax = 0;
+            u32 ebx = 0;
+            u32 ecx = 0;
+            u32 edx = 0;
+
+            if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+            {
+                return CpuFeatures{};
+            }
+            const u32 leaf1Ecx = ecx;
+
+            u32 leaf7Ebx = 0;
+            if(__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0)
+            {
+                leaf7Ebx = ebx;
+            }
+
+            const u64 xcr0 = (leaf1Ecx & Detail::OsXsaveBit) != 0 ? ReadXcr0() : 0;
+
+            return Detail::DecodeCpuFeatures(leaf1Ecx, leaf7Ebx, xcr0);
+        }();
+
+        return Features;
+    }
+
+    u32 GetPhysicalCoreCount()
+    {
+        SSSENGINE_FUNCTION_LOCAL const u32 CoreCount = []()
+        {
+            cpu_set_t affinity;
+            CPU_ZERO(&affinity);
+            if(sched_getaffinity(0, sizeof(affinity), &affinity) != 0)
+            {
+                return 1u;
+            }
+
+            // NOTE: Every core is counted through its lowest hardware thread the process can run on
+            u32 cores = 0;
+            for(u32 cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if(!CPU_ISSET(cpu, &affinity))
+                {
+                    continue;
+                }
+
+                const u32 first = GetFirstSibling(cpu);
+                if(first == cpu || first >= CPU_SETSIZE || !CPU_ISSET(first, &affinity))
+                {
+                    ++cores;
+                }
+            }
+
+            return cores > 0 ? cores : 1u;
+        }();
+
+        return CoreCount;
+    }
+} // namespace SSSEngine::Platform
@@ -0,0 +1,144 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Memory.h on top of mmap. Reserved ranges are mapped without access and committing only changes the protection,
+ * Linux gives the pages memory the first time they are touched
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include "Bits.h"
+#include "Memory.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    namespace
+    {
+        // NOTE: Same as MAP_HUGE_2MB from linux/mman.h, which glibc does not expose
+        constexpr int MapHuge2MiB = 21 << MAP_HUGE_SHIFT;
+
+        void *Map(void *address, size bytes, int protection, int flags)
+        {
+            void *mapped = mmap(address, bytes, protection, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+            return mapped == MAP_FAILED ? nullptr : mapped;
+        }
+
+        /**
+         * @brief Reserves bytes aligned to alignment. mmap only aligns to the page size so the range is reserved with
+         * enough room to align it and the rest is unmapped
+         */
+        void *ReserveAligned(size bytes, size alignment)
+        {
+            const size padded = bytes + alignment;
+            auto *const base = static_cast<byte *>(Map(nullptr, padded, PROT_NONE, MAP_NORESERVE));
+            if(base == nullptr)
+            {
+                return nullptr;
+            }
+
+            const uintptr start = AlignUp(reinterpret_cast<uintptr>(base), static_cast<uintptr>(alignment));
+            auto *const aligned = reinterpret_cast<byte *>(start);
+            if(const size head = static_cast<size>(aligned - base); head > 0)
+            {
+                munmap(base, head);
+            }
+            munmap(aligned + bytes, static_cast<size>(base + padded - (aligned + bytes)));
+
+            return aligned;
+        }
+
+        size RoundToPages(size bytes, PageKind kind)
+        {
+            return AlignUp(bytes, kind == PageKind::Normal ? GetPageSize() : HugePageSize);
+        }
+    } // namespace
+
+    MemorySnapshot GetSystemMemoryInfo()
+    {
+        const auto pageSize = static_cast<u64>(sysconf(_SC_PAGESIZE));
+        return {.TotalSize = static_cast<u64>(sysconf(_SC_PHYS_PAGES)) * pageSize,
+                .Available = static_cast<u64>(sysconf(_SC_AVPHYS_PAGES)) * pageSize};
+    }
+
+    void *AllocateMemory(size bytes, void *startingAddress)
+    {
+        return Map(startingAddress, bytes, PROT_READ | PROT_WRITE, 0);
+    }
+
+    bool FreeMemory(void *address, size bytes)
+    {
+        return munmap(address, bytes) == 0;
+    }
+
+    size GetPageSize()
+    {
+        SSSENGINE_FUNCTION_LOCAL const size PageSize = static_cast<size>(sysconf(_SC_PAGESIZE));
+        return PageSize;
+    }
+
+    void *ReserveAddressSpace(size bytes, PageKind kind)
+    {
+        bytes = RoundToPages(bytes, kind);
+
+        switch(kind)
+        {
+            case PageKind::Normal:
+                return Map(nullptr, bytes, PROT_NONE, MAP_NORESERVE);
+            case PageKind::TransparentHuge:
+            {
+                void *address = ReserveAligned(bytes, HugePageSize);
+                // NOTE: Fails when transparent huge pages are disabled, the range is still usable with normal pages
+                if(address != nullptr)
+                {
+                    madvise(address, bytes, MADV_HUGEPAGE);
+                }
+
+                return address;
+            }
+            case PageKind::Huge:
+                // NOTE: Without MAP_NORESERVE the huge pages are taken from the pool by mmap, so running out fails
+                // here instead of crashing on first touch
+                return Map(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_HUGETLB | MapHuge2MiB);
+        }
+
+        return nullptr;
+    }
+
+    bool Commit(void *address, size bytes)
+    {
+        return mprotect(address, AlignUp(bytes, GetPageSize()), PROT_READ | PROT_WRITE) == 0;
+    }
+
+    bool Decommit(void *address, size bytes)
+    {
+        bytes = AlignUp(bytes, GetPageSize());
+
+        // NOTE: MADV_DONTNEED frees the pages right away, the next touch maps zeroed pages again
+        const bool released = madvise(address, bytes, MADV_DONTNEED) == 0;
+        return mprotect(address, bytes, PROT_NONE) == 0 && released;
+    }
+
+    bool ReleaseAddressSpace(void *address, size bytes, PageKind kind)
+    {
+        return munmap(address, RoundToPages(bytes, kind)) == 0;
+    }
+} // namespace SSSEngine::Platform
@@ -0,0 +1,60 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Threading.h on top of futex. The private operations skip the shared futex table since the values are never
+ * shared with other processes
+ */
+
+#include <atomic>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "Threading.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    namespace
+    {
+        long Futex(const std::atomic<u32> &address, int operation, u32 value)
+        {
+            // NOTE: The kernel only reads and compares the value, the const_cast never results in a write
+            return syscall(SYS_futex, const_cast<std::atomic<u32> *>(&address), operation, value, nullptr, nullptr, 0);
+        }
+    } // namespace
+
+    void WaitOnAddress(const std::atomic<u32> &address, u32 undesired)
+    {
+        // NOTE: EAGAIN (the value already changed) and EINTR are both a wake up to the caller
+        Futex(address, FUTEX_WAIT_PRIVATE, undesired);
+    }
+
+    void WakeOneOnAddress(std::atomic<u32> &address)
+    {
+        Futex(address, FUTEX_WAKE_PRIVATE, 1);
+    }
+
+    void WakeAllOnAddress(std::atomic<u32> &address)
+    {
+        Futex(address, FUTEX_WAKE_PRIVATE, INT_MAX);
+    }
+} // namespace SSSEngine::Platform
@@ -0,0 +1,48 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Timer.h on top of the monotonic clock. Timestamps are in nanoseconds
+ */
+
+#include <time.h>
+#include "Timer.h"
+#include "Types.h"
+
+namespace SSSEngine::Platform
+{
+    Timestamp GetCurrentTime()
+    {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return {static_cast<u64>(now.tv_sec) * 1'000'000'000 + static_cast<u64>(now.tv_nsec)};
+    }
+
+    u64 ToMicroSeconds(Timestamp timestamp)
+    {
+        return timestamp.time / 1'000;
+    }
+
+    u64 ToNanoSeconds(Timestamp timestamp)
+    {
+        return timestamp.time;
+    }
+} // namespace SSSEngine::Platform
@@ -26,6 +26,7 @@
 #include <windows.h>
 #include <wrl/client.h>
 #include <xinput.h>
+#include "Cpu.h"
 #include "Platform.h"
 #include "Win32Window.h"
 
@@ -52,10 +53,7 @@ extern "C"
 
 constexpr WCHAR WindowClassName[] = L"SSS Engine";
 
-// LOW_PRIORITY: Check for cpu attributes to ensure minimum specs
-//  -> SIMD
-//  -> Minimum memory perhaps or just try to allocate and if fails allocate
-//  less?
+// LOW_PRIORITY: Check for minimum memory perhaps or just try to allocate and if fails allocate less?
 // NOLINTNEXTLINE
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLine, int nShowCmd)
 {
@@ -69,6 +67,16 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
      *  that is not platform specific should instead be moved into the application class to initialize like audio,
      *  input...
      */
+    // NOTE: Everything is compiled for CompiledSimdLevel so any code could use those instructions
+    if(SSSEngine::Platform::GetSimdLevel() < SSSEngine::CompiledSimdLevel)
+    {
+        MessageBoxW(nullptr,
+                    L"This CPU does not support the instruction sets required by SSS Engine",
+                    WindowClassName, // NOLINT(*-pro-bounds-array-to-pointer-decay)
+                    MB_OK | MB_ICONERROR);
+        return -1;
+    }
+
     InitConsole();
 
     // COM initialization
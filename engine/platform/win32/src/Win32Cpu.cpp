@@ -0,0 +1,92 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief
+ */
+
+#include <intrin.h>
+#include <memory>
+#include "Cpu.h"
+#include "Types.h"
+#include "Windows.h"
+
+namespace SSSEngine::Platform
+{
+    const CpuFeatures &GetCpuFeatures()
+    {
+        SSSENGINE_FUNCTION_LOCAL const CpuFeatures Features = []()
+        {
+            int registers[4]; // NOTE: EAX, EBX, ECX and EDX
+            __cpuid(registers, 0);
+            const int highestLeaf = registers[0];
+
+            __cpuid(registers, 1);
+            const auto leaf1Ecx = static_cast<u32>(registers[2]);
+
+            u32 leaf7Ebx = 0;
+            if(highestLeaf >= 7)
+            {
+                __cpuidex(registers, 7, 0);
+                leaf7Ebx = static_cast<u32>(registers[1]);
+            }
+
+            const u64 xcr0 = (leaf1Ecx & Detail::OsXsaveBit) != 0 ? _xgetbv(0) : 0;
+
+            return Detail::DecodeCpuFeatures(leaf1Ecx, leaf7Ebx, xcr0);
+        }();
+
+        return Features;
+    }
+
+    u32 GetPhysicalCoreCount()
+    {
+        SSSENGINE_FUNCTION_LOCAL const u32 CoreCount = []()
+        {
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &length);
+            if(GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            {
+                return 1u;
+            }
+
+            const auto buffer = std::make_unique_for_overwrite<byte[]>(length);
+            auto *const first = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX *>(buffer.get());
+            if(!GetLogicalProcessorInformationEx(RelationProcessorCore, first, &length))
+            {
+                return 1u;
+            }
+
+            // NOTE: One entry per core, entries have different sizes
+            u32 cores = 0;
+            for(DWORD offset = 0; offset < length;)
+            {
+                const auto *const entry =
+                    reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX *>(buffer.get() + offset);
+                ++cores;
+                offset += entry->Size;
+            }
+
+            return cores > 0 ? cores : 1u;
+        }();
+
+        return CoreCount;
+    }
+} // namespace SSSEngine::Platform
@@ -17,14 +17,44 @@
     USA
 */
 
+#include "Bits.h"
 #include "Memory.h"
 #include "Windows.h"
 
 namespace SSSEngine::Platform
 {
+    namespace
+    {
+        /**
+         * @brief Large pages need the lock pages in memory privilege, which is granted to the user but disabled in the
+         * process token until it is enabled
+         */
+        bool EnableLockMemoryPrivilege()
+        {
+            HANDLE token = nullptr;
+            if(!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+            {
+                return false;
+            }
+
+            TOKEN_PRIVILEGES privileges{};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+            bool enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                           AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr);
+            // NOTE: AdjustTokenPrivileges succeeds even when the user does not hold the privilege
+            enabled = enabled && GetLastError() == ERROR_SUCCESS;
+
+            CloseHandle(token);
+            return enabled;
+        }
+    } // namespace
+
     MemorySnapshot GetSystemMemoryInfo()
     {
-        MEMORYSTATUSEX memoryStatus;
+        MEMORYSTATUSEX memoryStatus{};
+        memoryStatus.dwLength = sizeof(memoryStatus);
         GlobalMemoryStatusEx(&memoryStatus);
 
         return {.TotalSize = memoryStatus.ullTotalPhys, .Available = memoryStatus.ullAvailPhys};
@@ -36,9 +66,54 @@ namespace SSSEngine::Platform
         return address;
     }
 
-    bool FreeMemory(void *address)
+    bool FreeMemory(void *address, [[maybe_unused]] size bytes)
     {
         return VirtualFree(address, 0, MEM_RELEASE);
     }
 
+    size GetPageSize()
+    {
+        SSSENGINE_FUNCTION_LOCAL const size PageSize = []
+        {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<size>(info.dwPageSize);
+        }();
+        return PageSize;
+    }
+
+    void *ReserveAddressSpace(size bytes, PageKind kind)
+    {
+        // NOTE: Windows has no transparent huge pages, TransparentHuge is a normal reservation
+        if(kind != PageKind::Huge)
+        {
+            return VirtualAlloc(nullptr, AlignUp(bytes, GetPageSize()), MEM_RESERVE, PAGE_NOACCESS);
+        }
+
+        SSSENGINE_FUNCTION_LOCAL const bool CanUseLargePages = EnableLockMemoryPrivilege();
+        if(!CanUseLargePages)
+        {
+            return nullptr;
+        }
+
+        // NOTE: Large pages can't be reserved alone, they are committed with the reservation
+        const size largePageSize = GetLargePageMinimum();
+        return VirtualAlloc(nullptr, AlignUp(bytes, largePageSize > 0 ? largePageSize : HugePageSize),
+                            MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+
+    bool Commit(void *address, size bytes)
+    {
+        return VirtualAlloc(address, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    bool Decommit(void *address, size bytes)
+    {
+        return VirtualFree(address, bytes, MEM_DECOMMIT);
+    }
+
+    bool ReleaseAddressSpace(void *address, [[maybe_unused]] size bytes, [[maybe_unused]] PageKind kind)
+    {
+        return VirtualFree(address, 0, MEM_RELEASE);
+    }
 } // namespace SSSEngine::Platform
@@ -0,0 +1,50 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Threading.h on top of WaitOnAddress
+ */
+
+#include <atomic>
+#include "HelperMacros.h"
+#include "Threading.h"
+#include "Types.h"
+#include "Windows.h"
+
+SSSENGINE_LIB("Synchronization.lib")
+
+namespace SSSEngine::Platform
+{
+    void WaitOnAddress(const std::atomic<u32> &address, u32 undesired)
+    {
+        auto *const value = const_cast<std::atomic<u32> *>(&address);
+        ::WaitOnAddress(value, &undesired, sizeof(u32), INFINITE);
+    }
+
+    void WakeOneOnAddress(std::atomic<u32> &address)
+    {
+        WakeByAddressSingle(&address);
+    }
+
+    void WakeAllOnAddress(std::atomic<u32> &address)
+    {
+        WakeByAddressAll(&address);
+    }
+} // namespace SSSEngine::Platform
@@ -59,4 +59,11 @@ namespace SSSEngine::Platform
         // Also should we store the inverse of the frequency and multiply instead?
         return timestamp.time / Frequency.QuadPart;
     }
+
+    u64 ToNanoSeconds(Timestamp timestamp)
+    {
+        // NOTE: Whole seconds and the remainder are converted apart so the multiplication doesn't overflow
+        const auto frequency = static_cast<u64>(Frequency.QuadPart);
+        return timestamp.time / frequency * 1'000'000'000 + timestamp.time % frequency * 1'000'000'000 / frequency;
+    }
 } // namespace SSSEngine::Platform
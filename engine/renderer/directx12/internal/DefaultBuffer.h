@@ -28,6 +28,7 @@
 
 #include "Debug.h"
 #include "Device.h"
+#include "GpuMemory.h"
 #include "Types.h"
 #include "Win32Utils.h"
 #include "d3d12.h"
@@ -39,35 +40,15 @@
 namespace SSSEngine::Renderer::DirectX12
 {
 
-    Microsoft::WRL::ComPtr<ID3D12Resource>
-    CreateDefaultBuffer(ID3D12GraphicsCommandList *cmdList, const void *data, u64 byteSize,
-                        Microsoft::WRL::ComPtr<ID3D12Resource> &uploadBuffer)
+    GpuBuffer CreateDefaultBuffer(ID3D12GraphicsCommandList *cmdList, const void *data, u64 byteSize,
+                                  GpuBuffer &uploadBuffer)
     {
         SSSENGINE_ASSERT(cmdList != nullptr);
         SSSENGINE_ASSERT(data);
 
-        Microsoft::WRL::ComPtr<ID3D12Resource> defaultBuffer;
-        {
-            auto heapType = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
-            auto buffer = CD3DX12_RESOURCE_DESC::Buffer(byteSize);
-            Platform::Win32::ThrowIfFailed(Device->CreateCommittedResource(&heapType,
-                                                                           D3D12_HEAP_FLAG_NONE,
-                                                                           &buffer,
-                                                                           D3D12_RESOURCE_STATE_COMMON,
-                                                                           nullptr,
-                                                                           IID_PPV_ARGS(defaultBuffer.GetAddressOf())));
-        }
+        GpuBuffer defaultBuffer = DefaultBufferMemory.CreateBuffer(byteSize, D3D12_RESOURCE_STATE_COMMON);
         // Intermediate Heap to upload data since we cannot upload directly to a default heap
-        {
-            auto heapType = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-            auto buffer = CD3DX12_RESOURCE_DESC::Buffer(byteSize);
-            Platform::Win32::ThrowIfFailed(Device->CreateCommittedResource(&heapType,
-                                                                           D3D12_HEAP_FLAG_NONE,
-                                                                           &buffer,
-                                                                           D3D12_RESOURCE_STATE_GENERIC_READ,
-                                                                           nullptr,
-                                                                           IID_PPV_ARGS(uploadBuffer.GetAddressOf())));
-        }
+        uploadBuffer = UploadBufferMemory.CreateBuffer(byteSize, D3D12_RESOURCE_STATE_GENERIC_READ);
 
         D3D12_SUBRESOURCE_DATA subResourceData{
             .pData = data,
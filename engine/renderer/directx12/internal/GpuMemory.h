@@ -0,0 +1,121 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Buffers placed in a few big heaps instead of one committed resource each
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+#include "Attributes.h"
+#include "GpuHeapAllocator.h"
+#include "HelperMacros.h"
+#include "Types.h"
+#include "d3d12.h"
+#include "wrl/client.h"
+
+namespace SSSEngine::Renderer::DirectX12
+{
+    class BufferMemory;
+
+    /**
+     * @class GpuBuffer
+     * @brief Owns a buffer resource and the heap range it is placed in. The range is freed after the resource is
+     * released, so the GPU must be done with the buffer before it is destroyed
+     *
+     */
+    class GpuBuffer final
+    {
+        public:
+        GpuBuffer() = default;
+        GpuBuffer(Microsoft::WRL::ComPtr<ID3D12Resource> resource, const GpuAllocation &allocation,
+                  BufferMemory *memory) noexcept;
+        ~GpuBuffer();
+        GpuBuffer(const GpuBuffer &other) = delete;
+        GpuBuffer(GpuBuffer &&other) noexcept;
+        GpuBuffer &operator=(const GpuBuffer &other) = delete;
+        GpuBuffer &operator=(GpuBuffer &&other) noexcept;
+
+        /**
+         * @brief Releases the resource and gives its range back to the heap
+         */
+        void Reset() noexcept;
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ID3D12Resource *Get() const noexcept
+        {
+            return m_resource.Get();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE ID3D12Resource *operator->() const noexcept
+        {
+            return m_resource.Get();
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE const Microsoft::WRL::ComPtr<ID3D12Resource> &GetResource() const noexcept
+        {
+            return m_resource;
+        }
+
+        private:
+        Microsoft::WRL::ComPtr<ID3D12Resource> m_resource;
+        GpuAllocation m_allocation;
+        BufferMemory *m_memory{nullptr};
+    };
+
+    /**
+     * @class BufferMemory
+     * @brief Places buffers of one heap type in ranges of shared heaps. Buffers too big for a heap get a committed
+     * resource of their own
+     *
+     */
+    class BufferMemory final
+    {
+        public:
+        static constexpr u64 HeapSize = 64_MiB;
+
+        explicit BufferMemory(D3D12_HEAP_TYPE type);
+        BufferMemory(const BufferMemory &other) = delete;
+        BufferMemory(BufferMemory &&other) = delete;
+        BufferMemory &operator=(const BufferMemory &other) = delete;
+        BufferMemory &operator=(BufferMemory &&other) = delete;
+
+        /**
+         * @brief Creates a buffer of at least size bytes in the given state
+         */
+        SSSENGINE_PURE GpuBuffer CreateBuffer(u64 size, D3D12_RESOURCE_STATES initialState);
+
+        void Free(const GpuAllocation &allocation);
+
+        /**
+         * @brief Releases the heaps. Every buffer must have been destroyed
+         */
+        void Reset();
+
+        private:
+        GpuHeapAllocator m_allocator;
+        std::vector<Microsoft::WRL::ComPtr<ID3D12Heap>> m_heaps;
+        D3D12_HEAP_TYPE m_type;
+    };
+
+    SSSENGINE_GLOBAL BufferMemory DefaultBufferMemory{D3D12_HEAP_TYPE_DEFAULT};
+    SSSENGINE_GLOBAL BufferMemory UploadBufferMemory{D3D12_HEAP_TYPE_UPLOAD};
+} // namespace SSSEngine::Renderer::DirectX12
@@ -26,6 +26,7 @@
 
 #include "Attributes.h"
 #include "Device.h"
+#include "GpuMemory.h"
 #include "Types.h"
 #include "Win32Utils.h"
 #include "d3d12.h"
@@ -43,13 +44,9 @@ namespace SSSEngine::Renderer::DirectX12
     class UploadBuffer
     {
         public:
-        explicit UploadBuffer(u32 count)
+        explicit UploadBuffer(u32 count) :
+        m_uploadBuffer{UploadBufferMemory.CreateBuffer(Size * count, D3D12_RESOURCE_STATE_GENERIC_READ)}
         {
-            auto heaptype = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-            auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(Size * count);
-            Platform::Win32::ThrowIfFailed(Device->CreateCommittedResource(
-                &heaptype, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_uploadBuffer)));
-
             Platform::Win32::ThrowIfFailed(m_uploadBuffer->Map(0, nullptr, reinterpret_cast<void **>(&m_data)));
         }
 
@@ -73,11 +70,11 @@ namespace SSSEngine::Renderer::DirectX12
 
         SSSENGINE_PURE Microsoft::WRL::ComPtr<ID3D12Resource> GetBufferResource() const noexcept
         {
-            return m_uploadBuffer;
+            return m_uploadBuffer.GetResource();
         }
 
         private:
-        Microsoft::WRL::ComPtr<ID3D12Resource> m_uploadBuffer;
+        GpuBuffer m_uploadBuffer;
         byte *m_data{};
     };
 } // namespace SSSEngine::Renderer::DirectX12
@@ -23,9 +23,7 @@
  */
 
 // TODO: Remove std library
-#include <cmath>
 #include <memory>
-#include <vector>
 
 #include "comdef.h"
 
@@ -36,6 +34,7 @@
 #include "DefaultBuffer.h"
 #include "HelperMacros.h"
 #include "DirectXMath.h"
+#include "Transcendental.h"
 #include "Types.h"
 #include "Win32Utils.h"
 #include "d3d12.h"
@@ -52,7 +51,10 @@
 #include "Debug.h"
 #include "Device.h"
 #include "Factory.h"
+#include "GpuMemory.h"
 #include "RenderingContext.h"
+#include "SlotMap.h"
+#include "SwapChainHandle.h"
 #include "UploadBuffer.h"
 #include "Vertex.h"
 
@@ -65,18 +67,18 @@ namespace SSSEngine::Renderer::DirectX12
     {
         using namespace Platform::Win32;
 
-        // TODO: Replace vector with custom array like structure
-        std::vector<RenderingContext> RenderingContexts;
+        SlotMap<RenderingContext> RenderingContexts;
 
         Microsoft::WRL::ComPtr<ID3D12RootSignature> RootSignature;
         Microsoft::WRL::ComPtr<ID3D12PipelineState> PipelineState;
         Microsoft::WRL::ComPtr<ID3D12InfoQueue> InfoQueue;
 
-        Microsoft::WRL::ComPtr<ID3D12Resource> IntermediateBuffer; // NOTE: This buffer needs to exist until its
-                                                                   // contents are copied to the vertex buffer
-        Microsoft::WRL::ComPtr<ID3D12Resource> VertexBuffer;
+        // NOTE: These buffers need to exist until their contents are copied to the vertex and index buffers
+        GpuBuffer VertexIntermediateBuffer;
+        GpuBuffer IndexIntermediateBuffer;
+        GpuBuffer VertexBuffer;
         D3D12_VERTEX_BUFFER_VIEW VertexBufferView;
-        Microsoft::WRL::ComPtr<ID3D12Resource> IndexBuffer;
+        GpuBuffer IndexBuffer;
         D3D12_INDEX_BUFFER_VIEW IndexBufferView;
 
         // Constant buffer
@@ -318,9 +320,13 @@ namespace SSSEngine::Renderer::DirectX12
             SSSENGINE_FUNCTION_LOCAL float theta{0.25f * XM_PI};
             constexpr float Radius{10.f};
 
-            float x = Radius * sinf(phi) * cosf(theta);
-            float y = Radius * sinf(phi) * sinf(theta);
-            float z = Radius * cosf(phi);
+            f32 sinPhi, cosPhi, sinTheta, cosTheta;
+            Math::FastSinCos(phi, sinPhi, cosPhi);
+            Math::FastSinCos(theta, sinTheta, cosTheta);
+
+            float x = Radius * sinPhi * cosTheta;
+            float y = Radius * sinPhi * sinTheta;
+            float z = Radius * cosPhi;
 
             XMVECTOR pos = XMVectorSet(x, y, z, 1);
             XMVECTOR target = XMVectorZero();
@@ -360,12 +366,13 @@ namespace SSSEngine::Renderer::DirectX12
         SSSENGINE_ASSERT(width > 0 && height > 0 && "Must pass appropriate values for width and height");
 
         // TODO: Use the window as the index to find the correct swap chain to resize
-        RenderingContexts[0].ResizeSwapChain(width, height);
+        RenderingContexts.GetValues()[0].ResizeSwapChain(width, height);
     }
 
-    SSSENGINE_DLL_EXPORT void CreateSwapChain(const SSSEngine::Platform::WindowHandle &window)
+    SSSENGINE_DLL_EXPORT SwapChainHandle CreateSwapChain(const SSSEngine::Platform::WindowHandle &window)
     {
-        RenderingContexts.emplace_back(window);
+        const SlotMapKey<RenderingContext> key = RenderingContexts.Emplace(window);
+        return {key.Index, key.Generation};
     }
 
     // TODO: Remove this eventually
@@ -433,15 +440,15 @@ namespace SSSEngine::Renderer::DirectX12
                                 0};
         constexpr UINT IndexBufferSize = sizeof(Indices);
 
-        SSSENGINE_ASSERT(RenderingContexts.size() > 0);
+        SSSENGINE_ASSERT(!RenderingContexts.IsEmpty());
 
-        auto &renderingContext = RenderingContexts[0];
+        auto &renderingContext = RenderingContexts.GetValues()[0];
         auto cmdList = renderingContext.commandList.Get();
 
         SSSENGINE_ASSERT(cmdList);
 
-        VertexBuffer = CreateDefaultBuffer(cmdList, Vertices, VertexBufferSize, IntermediateBuffer);
-        IndexBuffer = CreateDefaultBuffer(cmdList, Indices, IndexBufferSize, IntermediateBuffer);
+        VertexBuffer = CreateDefaultBuffer(cmdList, Vertices, VertexBufferSize, VertexIntermediateBuffer);
+        IndexBuffer = CreateDefaultBuffer(cmdList, Indices, IndexBufferSize, IndexIntermediateBuffer);
 
         VertexBufferView.BufferLocation = VertexBuffer->GetGPUVirtualAddress();
         VertexBufferView.StrideInBytes = sizeof(Vertex);
@@ -465,10 +472,14 @@ namespace SSSEngine::Renderer::DirectX12
         RootSignature.Reset();
         PipelineState.Reset();
         InfoQueue.Reset();
-        IntermediateBuffer.Reset();
+        VertexIntermediateBuffer.Reset();
+        IndexIntermediateBuffer.Reset();
         VertexBuffer.Reset();
         IndexBuffer.Reset();
+        ObjectMatrixBuffer.reset();
         ObjectMatrixBufferDescriptor.Reset();
+        DefaultBufferMemory.Reset();
+        UploadBufferMemory.Reset();
 
         for(RenderingContext &context: RenderingContexts)
         {
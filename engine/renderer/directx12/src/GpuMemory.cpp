@@ -0,0 +1,127 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include "GpuMemory.h"
+#include "Debug.h"
+#include "Device.h"
+#include "Win32Utils.h"
+#include "d3dx12_core.h"
+
+namespace SSSEngine::Renderer::DirectX12
+{
+    GpuBuffer::GpuBuffer(Microsoft::WRL::ComPtr<ID3D12Resource> resource, const GpuAllocation &allocation,
+                         BufferMemory *memory) noexcept :
+    m_resource{std::move(resource)}, m_allocation{allocation}, m_memory{memory}
+    {
+    }
+
+    GpuBuffer::~GpuBuffer()
+    {
+        Reset();
+    }
+
+    GpuBuffer::GpuBuffer(GpuBuffer &&other) noexcept :
+    m_resource{std::move(other.m_resource)}, m_allocation{std::exchange(other.m_allocation, {})},
+    m_memory{std::exchange(other.m_memory, nullptr)}
+    {
+    }
+
+    GpuBuffer &GpuBuffer::operator=(GpuBuffer &&other) noexcept
+    {
+        if(this != &other)
+        {
+            Reset();
+            m_resource = std::move(other.m_resource);
+            m_allocation = std::exchange(other.m_allocation, {});
+            m_memory = std::exchange(other.m_memory, nullptr);
+        }
+        return *this;
+    }
+
+    void GpuBuffer::Reset() noexcept
+    {
+        m_resource.Reset();
+        if(m_memory != nullptr && m_allocation.IsValid())
+        {
+            m_memory->Free(m_allocation);
+        }
+        m_allocation = {};
+        m_memory = nullptr;
+    }
+
+    BufferMemory::BufferMemory(D3D12_HEAP_TYPE type) :
+    m_allocator{HeapSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT}, m_type{type}
+    {
+    }
+
+    GpuBuffer BufferMemory::CreateBuffer(u64 size, D3D12_RESOURCE_STATES initialState)
+    {
+        using namespace Platform::Win32;
+
+        const auto desc = CD3DX12_RESOURCE_DESC::Buffer(size);
+        const D3D12_RESOURCE_ALLOCATION_INFO info = Device->GetResourceAllocationInfo(0, 1, &desc);
+
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+        const GpuAllocation allocation = m_allocator.Allocate(info.SizeInBytes, info.Alignment);
+        if(!allocation.IsValid())
+        {
+            auto heapType = CD3DX12_HEAP_PROPERTIES(m_type);
+            SSSENGINE_THROW_IF_FAILED(Device->CreateCommittedResource(
+                &heapType, D3D12_HEAP_FLAG_NONE, &desc, initialState, nullptr, IID_PPV_ARGS(&resource)));
+            return {std::move(resource), {}, nullptr};
+        }
+
+        // NOTE: The allocator added a heap for this range
+        while(m_heaps.size() < m_allocator.GetHeapCount())
+        {
+            const CD3DX12_HEAP_DESC heapDesc{
+                HeapSize, m_type, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS};
+            Microsoft::WRL::ComPtr<ID3D12Heap> heap;
+            const HRESULT result = Device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap));
+            if(FAILED(result))
+            {
+                m_allocator.Free(allocation);
+            }
+            SSSENGINE_THROW_IF_FAILED(result);
+            m_heaps.push_back(std::move(heap));
+        }
+
+        const HRESULT result = Device->CreatePlacedResource(
+            m_heaps[allocation.Heap].Get(), allocation.Offset, &desc, initialState, nullptr, IID_PPV_ARGS(&resource));
+        if(FAILED(result))
+        {
+            m_allocator.Free(allocation);
+        }
+        SSSENGINE_THROW_IF_FAILED(result);
+
+        return {std::move(resource), allocation, this};
+    }
+
+    void BufferMemory::Free(const GpuAllocation &allocation)
+    {
+        m_allocator.Free(allocation);
+    }
+
+    void BufferMemory::Reset()
+    {
+        SSSENGINE_ASSERT(m_allocator.GetUsed() == 0 && "Buffers are still alive");
+        m_heaps.clear();
+        m_allocator = GpuHeapAllocator{HeapSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT};
+    }
+} // namespace SSSEngine::Renderer::DirectX12
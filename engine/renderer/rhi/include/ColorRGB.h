@@ -24,6 +24,11 @@
 
 #pragma once
 
+#include <span>
+#include "ColorSpace.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Packed.h"
 #include "Types.h"
 
 namespace SSSEngine::Renderer
@@ -58,4 +63,104 @@ namespace SSSEngine::Renderer
         ColorRGB RGB{.R = 0, .G = 0, .B = 0};
         float A{0};
     };
+
+    SSSENGINE_STATIC_ASSERT(sizeof(ColorRGB) == 3 * sizeof(f32), "ColorRGB must be tightly packed to be converted")
+    SSSENGINE_STATIC_ASSERT(sizeof(ColorRGBA) == 4 * sizeof(f32), "ColorRGBA must be tightly packed to be converted")
+    SSSENGINE_STATIC_ASSERT(sizeof(Color32RGBA) == 4, "Color32RGBA must be tightly packed to be converted")
+
+    /**
+     * @brief Clamps every channel to [0, 1] and rounds it to 8 bits
+     */
+    SSSENGINE_GLOBAL Color32RGBA PackColor(const ColorRGBA &color)
+    {
+        return {Math::ToUnorm8(color.RGB.R),
+                Math::ToUnorm8(color.RGB.G),
+                Math::ToUnorm8(color.RGB.B),
+                Math::ToUnorm8(color.A)};
+    }
+
+    SSSENGINE_GLOBAL ColorRGBA UnpackColor(Color32RGBA color)
+    {
+        return {.RGB = {.R = Math::FromUnorm8(color.R), .G = Math::FromUnorm8(color.G), .B = Math::FromUnorm8(color.B)},
+                .A = Math::FromUnorm8(color.A)};
+    }
+
+    /**
+     * @brief PackColor on every color
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void PackColors(std::span<const ColorRGBA> colors, std::span<Color32RGBA> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= colors.size());
+
+        // NOTE: Both are arrays of channels so the whole batch converts as one
+        Math::ConvertToUnorm8({&colors.data()->RGB.R, colors.size() * 4}, {&result.data()->R, colors.size() * 4});
+    }
+
+    /**
+     * @brief UnpackColor on every color
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void UnpackColors(std::span<const Color32RGBA> colors, std::span<ColorRGBA> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= colors.size());
+
+        Math::ConvertFromUnorm8({&colors.data()->R, colors.size() * 4}, {&result.data()->RGB.R, colors.size() * 4});
+    }
+
+    /**
+     * @brief Encodes linear colors to 8 bit sRGB, the alpha is only quantized. For sRGB textures and screenshots
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void PackColorsSrgb(std::span<const ColorRGBA> colors, std::span<Color32RGBA> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= colors.size());
+
+        Math::ConvertLinearToSrgb8({&colors.data()->RGB.R, colors.size() * 4}, {&result.data()->R, colors.size() * 4});
+    }
+
+    /**
+     * @brief Decodes 8 bit sRGB colors to linear, the alpha is only normalized
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void UnpackColorsSrgb(std::span<const Color32RGBA> colors, std::span<ColorRGBA> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= colors.size());
+
+        Math::ConvertSrgb8ToLinear({&colors.data()->R, colors.size() * 4}, {&result.data()->RGB.R, colors.size() * 4});
+    }
+
+    /**
+     * @brief Packs HDR colors to DXGI_FORMAT_R11G11B10_FLOAT. @see Math::ToR11G11B10
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void PackColors(std::span<const ColorRGB> colors, std::span<Math::R11G11B10> result)
+    {
+        Math::ConvertToR11G11B10({&colors.data()->R, colors.size() * 3}, result);
+    }
+
+    SSSENGINE_GLOBAL void UnpackColors(std::span<const Math::R11G11B10> colors, std::span<ColorRGB> result)
+    {
+        Math::ConvertFromR11G11B10(colors, {&result.data()->R, result.size() * 3});
+    }
+
+    /**
+     * @brief Packs HDR colors to DXGI_FORMAT_R9G9B9E5_SHAREDEXP. @see Math::ToRgb9E5
+     *
+     * @param result Must be able to hold every color
+     */
+    SSSENGINE_GLOBAL void PackColors(std::span<const ColorRGB> colors, std::span<Math::Rgb9E5> result)
+    {
+        Math::ConvertToRgb9E5({&colors.data()->R, colors.size() * 3}, result);
+    }
+
+    SSSENGINE_GLOBAL void UnpackColors(std::span<const Math::Rgb9E5> colors, std::span<ColorRGB> result)
+    {
+        Math::ConvertFromRgb9E5(colors, {&result.data()->R, result.size() * 3});
+    }
 } // namespace SSSEngine::Renderer
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include "Types.h"
+
 namespace SSSEngine::Renderer
 {
     // INVESTIGATE: This could just be a handle instead of specific type
@@ -31,6 +33,10 @@ namespace SSSEngine::Renderer
     // It actually can be a window id only
     struct SwapChainHandle
     {
-        int index;
+        /**
+         * @brief The key of the swap chain in the backend
+         */
+        u32 Index;
+        u32 Generation;
     };
 } // namespace SSSEngine::Renderer
@@ -24,8 +24,12 @@
 
 #pragma once
 
-#include "Vector.h"
+#include <span>
 #include "ColorRGB.h"
+#include "Debug.h"
+#include "HelperMacros.h"
+#include "Packed.h"
+#include "Vector.h"
 
 namespace SSSEngine::Renderer
 {
@@ -44,4 +48,49 @@ namespace SSSEngine::Renderer
         // SSSMath::Float2 Uv0;
         // SSSMath::Float2 Uv1;
     };
+
+    /**
+     * @class PackedVertex
+     * @brief Vertex with every attribute in a compact format, 20 bytes instead of the 48 of the float formats
+     * The formats are Position R16G16B16A16_FLOAT (W is 1), Normal R16G16_SNORM (octahedral, decode in the shader),
+     * Color R8G8B8A8_UNORM and Uv0 R16G16_FLOAT. Half positions have 11 bits of precision so large meshes should be
+     * split or stored relative to their bounds
+     *
+     */
+    struct PackedVertex
+    {
+        Math::Half4 Position{};
+        Math::OctahedralNormal Normal{};
+        Color32RGBA Color{};
+        Math::Half2 Uv0{};
+    };
+
+    SSSENGINE_STATIC_ASSERT(sizeof(PackedVertex) == 20, "PackedVertex must be tightly packed")
+
+    SSSENGINE_GLOBAL PackedVertex PackVertex(const Vertex &vertex)
+    {
+        PackedVertex packed;
+        packed.Position = {Math::ToHalf(vertex.Position.X),
+                           Math::ToHalf(vertex.Position.Y),
+                           Math::ToHalf(vertex.Position.Z),
+                           Math::ToHalf(1)};
+        packed.Color = PackColor(vertex.Color);
+
+        return packed;
+    }
+
+    /**
+     * @brief PackVertex on every vertex
+     *
+     * @param result Must be able to hold every vertex
+     */
+    SSSENGINE_GLOBAL void PackVertices(std::span<const Vertex> vertices, std::span<PackedVertex> result)
+    {
+        SSSENGINE_ASSERT(result.size() >= vertices.size());
+
+        for(size i = 0; i < vertices.size(); ++i)
+        {
+            result[i] = PackVertex(vertices[i]);
+        }
+    }
 } // namespace SSSEngine::Renderer
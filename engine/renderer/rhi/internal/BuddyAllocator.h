@@ -0,0 +1,115 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Buddy allocator over offsets
+ * Only hands out offsets and keeps its bookkeeping on the side, so it can manage memory the CPU can't touch such as
+ * GPU heaps.
+ */
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include "Attributes.h"
+#include "Types.h"
+
+namespace SSSEngine::Renderer
+{
+    /**
+     * @class BuddyAllocator
+     * @brief Splits a power of 2 range into power of 2 blocks. A block is always aligned to its own size, so any
+     * alignment up to the requested size class comes for free
+     *
+     * Allocating and freeing are O(log(size / minBlockSize)). Not thread safe.
+     */
+    class BuddyAllocator final
+    {
+        public:
+        static constexpr u64 InvalidOffset = std::numeric_limits<u64>::max();
+
+        /**
+         * @param size The size of the range. Must be a power of 2 multiple of minBlockSize
+         * @param minBlockSize The smallest block handed out. Must be a power of 2
+         */
+        BuddyAllocator(u64 size, u64 minBlockSize);
+        BuddyAllocator(const BuddyAllocator &other) = delete;
+        BuddyAllocator(BuddyAllocator &&other) noexcept = default;
+        BuddyAllocator &operator=(const BuddyAllocator &other) = delete;
+        BuddyAllocator &operator=(BuddyAllocator &&other) noexcept = default;
+
+        /**
+         * @brief Finds a block of at least size bytes whose offset is a multiple of alignment
+         *
+         * @param alignment Must be a power of 2
+         * @return The offset of the block. InvalidOffset if no block is big enough
+         */
+        SSSENGINE_PURE u64 Allocate(u64 size, u64 alignment = 1);
+
+        /**
+         * @brief Frees the block at offset and merges it with its free buddies
+         */
+        void Free(u64 offset);
+
+        /**
+         * @brief The size of the block at offset, which can be bigger than what was asked for
+         */
+        SSSENGINE_PURE u64 GetBlockSize(u64 offset) const noexcept;
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u64 GetSize() const noexcept
+        {
+            return m_minBlockSize << m_maxOrder;
+        }
+
+        /**
+         * @brief The bytes in allocated blocks, including the rounding to powers of 2
+         */
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u64 GetUsed() const noexcept
+        {
+            return m_used;
+        }
+
+        /**
+         * @brief The size of the biggest block that can be allocated right now
+         */
+        SSSENGINE_PURE u64 GetLargestFreeBlock() const noexcept;
+
+        private:
+        static constexpr u32 NoBlock = std::numeric_limits<u32>::max();
+        static constexpr u8 NotFree = std::numeric_limits<u8>::max();
+        static constexpr u32 MaxOrders = 32;
+
+        void PushFree(u32 block, u32 order) noexcept;
+        void RemoveFree(u32 block, u32 order) noexcept;
+
+        // NOTE: Indexed by the first minimum block of each block. Only the first minimum block of a block is ever used,
+        // so a block can be free or allocated but never both
+        std::unique_ptr<u32[]> m_next;
+        std::unique_ptr<u32[]> m_previous;
+        std::unique_ptr<u8[]> m_freeOrder;
+        std::unique_ptr<u8[]> m_allocatedOrder;
+
+        u32 m_freeLists[MaxOrders]{};
+        u64 m_minBlockSize{0};
+        u64 m_used{0};
+        u32 m_minBlockShift{0};
+        u32 m_maxOrder{0};
+    };
+} // namespace SSSEngine::Renderer
@@ -0,0 +1,108 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+/**
+ * @file
+ * @brief Backend neutral suballocation of GPU heaps
+ * Resources are placed in ranges of a few big heaps instead of each one getting its own allocation from the driver.
+ * The allocator only deals with offsets, the backend owns the real heaps and creates the resources in them.
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "Attributes.h"
+#include "BuddyAllocator.h"
+#include "Types.h"
+
+namespace SSSEngine::Renderer
+{
+    /**
+     * @class GpuAllocation
+     * @brief A range of one of the heaps of a GpuHeapAllocator
+     *
+     */
+    struct GpuAllocation
+    {
+        static constexpr u32 InvalidHeap = std::numeric_limits<u32>::max();
+
+        u32 Heap{InvalidHeap};
+        u64 Offset{0};
+        u64 Size{0};
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE constexpr bool IsValid() const noexcept
+        {
+            return Heap != InvalidHeap;
+        }
+    };
+
+    /**
+     * @class GpuHeapAllocator
+     * @brief Hands out ranges from a growing list of equally sized heaps
+     *
+     * When no heap has room a new one is added, the backend must then create the heaps up to GetHeapCount before
+     * using the allocation. Not thread safe.
+     */
+    class GpuHeapAllocator final
+    {
+        public:
+        static constexpr u32 DefaultMaxHeaps = 64;
+
+        /**
+         * @param heapSize The size of every heap. Must be a power of 2 multiple of minBlockSize
+         * @param minBlockSize The smallest range handed out, usually the smallest alignment the backend places
+         * resources at
+         * @param maxHeaps The most heaps that will be created
+         */
+        GpuHeapAllocator(u64 heapSize, u64 minBlockSize, u32 maxHeaps = DefaultMaxHeaps);
+
+        /**
+         * @brief Finds a range of at least size bytes whose offset is a multiple of alignment, adding a heap if needed
+         *
+         * @param alignment Must be a power of 2
+         * @return The range. Invalid if size is 0. Also invalid if it is bigger than a heap or every heap is full and no
+         * more can be added, the resource should then get a dedicated allocation
+         */
+        SSSENGINE_PURE GpuAllocation Allocate(u64 size, u64 alignment);
+
+        void Free(const GpuAllocation &allocation);
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u32 GetHeapCount() const noexcept
+        {
+            return static_cast<u32>(m_heaps.size());
+        }
+
+        SSSENGINE_PURE SSSENGINE_FORCE_INLINE u64 GetHeapSize() const noexcept
+        {
+            return m_heapSize;
+        }
+
+        /**
+         * @brief The bytes in use across all heaps, including the rounding of every range
+         */
+        SSSENGINE_PURE u64 GetUsed() const noexcept;
+
+        private:
+        std::vector<BuddyAllocator> m_heaps;
+        u64 m_heapSize{0};
+        u64 m_minBlockSize{0};
+        u32 m_maxHeaps{0};
+    };
+} // namespace SSSEngine::Renderer
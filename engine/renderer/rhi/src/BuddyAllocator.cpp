@@ -0,0 +1,166 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include "BuddyAllocator.h"
+#include "Bits.h"
+#include "Debug.h"
+
+namespace SSSEngine::Renderer
+{
+    BuddyAllocator::BuddyAllocator(u64 size, u64 minBlockSize) :
+    m_minBlockSize{minBlockSize}, m_minBlockShift{static_cast<u32>(std::countr_zero(minBlockSize))}
+    {
+        SSSENGINE_ASSERT(IsPowerOfTwo(minBlockSize));
+        SSSENGINE_ASSERT(size >= minBlockSize && IsPowerOfTwo(size / minBlockSize) && size % minBlockSize == 0);
+
+        const u64 blockCount = size >> m_minBlockShift;
+        SSSENGINE_ASSERT(blockCount < NoBlock && "Too many blocks, use a bigger minimum block");
+        m_maxOrder = static_cast<u32>(std::countr_zero(blockCount));
+
+        m_next = std::make_unique<u32[]>(blockCount);
+        m_previous = std::make_unique<u32[]>(blockCount);
+        m_freeOrder = std::make_unique<u8[]>(blockCount);
+        m_allocatedOrder = std::make_unique<u8[]>(blockCount);
+        std::fill_n(m_freeOrder.get(), blockCount, NotFree);
+        std::fill_n(m_allocatedOrder.get(), blockCount, NotFree);
+        std::fill(std::begin(m_freeLists), std::end(m_freeLists), NoBlock);
+
+        PushFree(0, m_maxOrder);
+    }
+
+    u64 BuddyAllocator::Allocate(u64 size, u64 alignment)
+    {
+        SSSENGINE_ASSERT(IsPowerOfTwo(alignment));
+
+        // NOTE: Blocks are aligned to their size, so asking for at least alignment bytes is enough
+        const u64 blockSize = std::bit_ceil(std::max({size, alignment, m_minBlockSize}));
+        const u32 order = static_cast<u32>(std::countr_zero(blockSize)) - m_minBlockShift;
+        if(size == 0 || order > m_maxOrder)
+        {
+            return InvalidOffset;
+        }
+
+        u32 found = order;
+        while(found <= m_maxOrder && m_freeLists[found] == NoBlock)
+        {
+            ++found;
+        }
+        if(found > m_maxOrder)
+        {
+            return InvalidOffset;
+        }
+
+        const u32 block = m_freeLists[found];
+        RemoveFree(block, found);
+
+        // NOTE: Keep the lower half and free the upper one until the block is the right size
+        while(found > order)
+        {
+            --found;
+            PushFree(block + (1u << found), found);
+        }
+
+        m_allocatedOrder[block] = static_cast<u8>(order);
+        m_used += blockSize;
+        return static_cast<u64>(block) << m_minBlockShift;
+    }
+
+    void BuddyAllocator::Free(u64 offset)
+    {
+        SSSENGINE_ASSERT(offset % m_minBlockSize == 0 && offset < GetSize());
+
+        u32 block = static_cast<u32>(offset >> m_minBlockShift);
+        u32 order = m_allocatedOrder[block];
+        SSSENGINE_ASSERT(order != NotFree && "Freeing a block that isn't allocated");
+
+        m_allocatedOrder[block] = NotFree;
+        m_used -= m_minBlockSize << order;
+
+        while(order < m_maxOrder)
+        {
+            const u32 buddy = block ^ (1u << order);
+            if(m_freeOrder[buddy] != order)
+            {
+                break;
+            }
+
+            RemoveFree(buddy, order);
+            block = std::min(block, buddy);
+            ++order;
+        }
+
+        PushFree(block, order);
+    }
+
+    u64 BuddyAllocator::GetBlockSize(u64 offset) const noexcept
+    {
+        const u32 order = m_allocatedOrder[offset >> m_minBlockShift];
+        SSSENGINE_ASSERT(order != NotFree && "Not an allocated block");
+        return m_minBlockSize << order;
+    }
+
+    u64 BuddyAllocator::GetLargestFreeBlock() const noexcept
+    {
+        for(u32 order = m_maxOrder + 1; order-- > 0;)
+        {
+            if(m_freeLists[order] != NoBlock)
+            {
+                return m_minBlockSize << order;
+            }
+        }
+        return 0;
+    }
+
+    void BuddyAllocator::PushFree(u32 block, u32 order) noexcept
+    {
+        const u32 head = m_freeLists[order];
+        m_next[block] = head;
+        m_previous[block] = NoBlock;
+        if(head != NoBlock)
+        {
+            m_previous[head] = block;
+        }
+
+        m_freeLists[order] = block;
+        m_freeOrder[block] = static_cast<u8>(order);
+    }
+
+    void BuddyAllocator::RemoveFree(u32 block, u32 order) noexcept
+    {
+        const u32 next = m_next[block];
+        const u32 previous = m_previous[block];
+        if(previous != NoBlock)
+        {
+            m_next[previous] = next;
+        }
+        else
+        {
+            m_freeLists[order] = next;
+        }
+        if(next != NoBlock)
+        {
+            m_previous[next] = previous;
+        }
+
+        m_freeOrder[block] = NotFree;
+    }
+} // namespace SSSEngine::Renderer
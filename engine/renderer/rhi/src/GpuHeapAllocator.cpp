@@ -0,0 +1,73 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include "GpuHeapAllocator.h"
+#include "Debug.h"
+
+namespace SSSEngine::Renderer
+{
+    GpuHeapAllocator::GpuHeapAllocator(u64 heapSize, u64 minBlockSize, u32 maxHeaps) :
+    m_heapSize{heapSize}, m_minBlockSize{minBlockSize}, m_maxHeaps{maxHeaps}
+    {
+        m_heaps.reserve(maxHeaps);
+    }
+
+    GpuAllocation GpuHeapAllocator::Allocate(u64 size, u64 alignment)
+    {
+        if(size == 0 || size > m_heapSize || alignment > m_heapSize)
+        {
+            return {};
+        }
+
+        for(u32 heap = 0; heap < m_heaps.size(); ++heap)
+        {
+            const u64 offset = m_heaps[heap].Allocate(size, alignment);
+            if(offset != BuddyAllocator::InvalidOffset)
+            {
+                return {heap, offset, m_heaps[heap].GetBlockSize(offset)};
+            }
+        }
+
+        if(m_heaps.size() == m_maxHeaps)
+        {
+            return {};
+        }
+
+        const u32 heap = GetHeapCount();
+        const u64 offset = m_heaps.emplace_back(m_heapSize, m_minBlockSize).Allocate(size, alignment);
+        SSSENGINE_ASSERT(offset != BuddyAllocator::InvalidOffset);
+        return {heap, offset, m_heaps[heap].GetBlockSize(offset)};
+    }
+
+    void GpuHeapAllocator::Free(const GpuAllocation &allocation)
+    {
+        SSSENGINE_ASSERT(allocation.IsValid() && allocation.Heap < m_heaps.size());
+        m_heaps[allocation.Heap].Free(allocation.Offset);
+    }
+
+    u64 GpuHeapAllocator::GetUsed() const noexcept
+    {
+        u64 used = 0;
+        for(const BuddyAllocator &heap: m_heaps)
+        {
+            used += heap.GetUsed();
+        }
+        return used;
+    }
+} // namespace SSSEngine::Renderer
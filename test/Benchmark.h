@@ -0,0 +1,99 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include "Attributes.h"
+#include "HelperMacros.h"
+#include "Timer.h"
+#include "Types.h"
+
+namespace SSSBenchmark
+{
+    // INVESTIGATE: Statistics (min, max, median) over several runs instead of a single timed run
+
+    struct BenchmarkData
+    {
+        using function = void(u64);
+        const char *name;
+        u64 iterations;
+        function *benchmark;
+    };
+
+    SSSENGINE_GLOBAL std::vector<BenchmarkData> Benchmarks{};
+
+    /**
+     * @brief Forces the compiler to consider value as used so the code computing it is not optimized away
+     *
+     * @param value The value to keep
+     */
+    template<typename T>
+    SSSENGINE_FORCE_INLINE void DoNotOptimize(const T &value)
+    {
+#ifdef SSSENGINE_MSVC
+        SSSENGINE_FUNCTION_LOCAL const void *volatile Sink;
+        Sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    class Benchmark
+    {
+        public:
+        explicit Benchmark(const BenchmarkData &data)
+        {
+            Add(data);
+        }
+
+        static void Add(const BenchmarkData &data)
+        {
+            Benchmarks.push_back(data);
+        }
+
+        static void Execute()
+        {
+            using namespace SSSEngine;
+
+            for(auto const &benchmark: Benchmarks)
+            {
+                // NOTE: Warm up caches and branch predictors before measuring
+                benchmark.benchmark(benchmark.iterations / 10 + 1);
+
+                const Platform::Timestamp start = Platform::GetCurrentTime();
+                benchmark.benchmark(benchmark.iterations);
+                const Platform::Timestamp end = Platform::GetCurrentTime();
+
+                const u64 microseconds = Platform::ToMicroSeconds(end - start);
+                const f64 nanosecondsPerIteration =
+                    static_cast<f64>(microseconds) * 1000.0 / static_cast<f64>(benchmark.iterations);
+
+                std::cout << benchmark.name << ": " << microseconds << "us total, " << nanosecondsPerIteration
+                          << "ns per iteration (" << benchmark.iterations << " iterations)\n";
+            }
+        }
+    };
+
+#define SSSBENCHMARK(name, count)                                                                                      \
+    void name(u64 iterations);                                                                                         \
+    Benchmark _##name({#name, count, name});                                                                           \
+    void name(u64 iterations)
+} // namespace SSSBenchmark
@@ -0,0 +1,71 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "BatchTransform.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size PointCount = 50'000;
+
+        Mat4x4f Transformation{0.5f, 1, 0, 0, -1, 2, 0.25f, 0, 3, 0, 1, 0, 10, -20, 30, 1};
+
+        std::vector<Float3> Points(PointCount, Float3{1, 2, 3});
+        std::vector<Float3> Result(PointCount);
+
+        std::vector<f32> X(PointCount, 1), Y(PointCount, 2), Z(PointCount, 3);
+        std::vector<f32> ResultX(PointCount), ResultY(PointCount), ResultZ(PointCount);
+    } // namespace
+
+    SSSBENCHMARK(TransformPointsScalarLoop, 1'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size p = 0; p < PointCount; ++p)
+            {
+                const Float4 result = Float4{Points[p].X, Points[p].Y, Points[p].Z, 1} * Transformation;
+                Result[p] = {result.X, result.Y, result.Z};
+            }
+            DoNotOptimize(Result.data());
+        }
+    }
+
+    SSSBENCHMARK(TransformPointsArrayOfStructures, 1'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            TransformPoints(Transformation, Points, Result);
+            DoNotOptimize(Result.data());
+        }
+    }
+
+    SSSBENCHMARK(TransformPointsStructureOfArrays, 1'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            TransformPoints(Transformation, ConstFloat3Stream{X, Y, Z}, Float3Stream{ResultX, ResultY, ResultZ});
+            DoNotOptimize(ResultX.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,154 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <vector>
+#include "Test.h"
+#include "BatchTransform.h"
+#include "Cpu.h"
+#include "MathKernels.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        constexpr Mat4x4f Transformation{0.5f, 1, 0, 0, -1, 2, 0.25f, 0, 3, 0, 1, 0, 10, -20, 30, 1};
+
+        // NOTE: Odd size so that the 8 wide, 4 wide and padded remainder paths all run
+        constexpr size Count = 23;
+
+        bool NearlyEqual(Float3 lhs, Float3 rhs)
+        {
+            constexpr f32 Tolerance = 1e-4f;
+            return std::abs(lhs.X - rhs.X) < Tolerance && std::abs(lhs.Y - rhs.Y) < Tolerance &&
+                   std::abs(lhs.Z - rhs.Z) < Tolerance;
+        }
+
+        Float3 Expected(Float3 point, f32 w)
+        {
+            const Float4 result = Float4{point.X, point.Y, point.Z, w} * Transformation;
+            return {result.X, result.Y, result.Z};
+        }
+
+        std::vector<Float3> MakePoints()
+        {
+            std::vector<Float3> points;
+            for(size i = 0; i < Count; ++i)
+            {
+                const auto value = static_cast<f32>(i);
+                points.push_back({value, value * 0.5f - 3, 7 - value * 2});
+            }
+
+            return points;
+        }
+    } // namespace
+
+    SSSTEST_TEST(BatchTransformPoints)
+    {
+        const std::vector<Float3> points = MakePoints();
+        std::vector<Float3> result(Count);
+
+        TransformPoints(Transformation, points, result);
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Expected(points[i], 1)), true);
+        }
+    }
+
+    SSSTEST_TEST(BatchTransformVectors)
+    {
+        const std::vector<Float3> vectors = MakePoints();
+        std::vector<Float3> result(Count);
+
+        TransformVectors(Transformation, vectors, result);
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Expected(vectors[i], 0)), true);
+        }
+    }
+
+    SSSTEST_TEST(BatchTransformInPlace)
+    {
+        const std::vector<Float3> points = MakePoints();
+        std::vector<Float3> result = points;
+
+        TransformPoints(Transformation, result, result);
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Expected(points[i], 1)), true);
+        }
+    }
+
+    SSSTEST_TEST(BatchTransformStream)
+    {
+        const std::vector<Float3> points = MakePoints();
+        std::vector<f32> x, y, z;
+        for(const Float3 &point: points)
+        {
+            x.push_back(point.X);
+            y.push_back(point.Y);
+            z.push_back(point.Z);
+        }
+
+        std::vector<f32> resultX(Count), resultY(Count), resultZ(Count);
+        TransformPoints(Transformation, ConstFloat3Stream{x, y, z}, Float3Stream{resultX, resultY, resultZ});
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual({resultX[i], resultY[i], resultZ[i]}, Expected(points[i], 1)), true);
+        }
+
+        TransformVectors(Transformation, ConstFloat3Stream{x, y, z}, Float3Stream{resultX, resultY, resultZ});
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual({resultX[i], resultY[i], resultZ[i]}, Expected(points[i], 0)), true);
+        }
+    }
+
+    SSSTEST_TEST(BatchTransformEveryKernelLevel)
+    {
+        const std::vector<Float3> points = MakePoints();
+        std::vector<Float3> result(Count);
+
+        // NOTE: Only the levels with their own kernels, the ones in between load the closest lower kernels
+        for(const SSSEngine::SimdLevel level: {SSSEngine::SimdLevel::Sse2, SSSEngine::SimdLevel::Avx2})
+        {
+            if(level > SSSEngine::Platform::GetSimdLevel())
+            {
+                continue;
+            }
+
+            SSSTEST_EXPECT_EQ(Kernels::LoadKernels(level) == level, true);
+            TransformPoints(Transformation, points, result);
+
+            for(size i = 0; i < Count; ++i)
+            {
+                SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Expected(points[i], 1)), true);
+            }
+        }
+
+        Kernels::LoadKernels(SSSEngine::SimdLevel::Sse2);
+    }
+} // namespace SSSTest
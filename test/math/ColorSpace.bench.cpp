@@ -0,0 +1,92 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <vector>
+#include "Benchmark.h"
+#include "ColorSpace.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        // NOTE: A 256x256 RGBA texture
+        constexpr size PixelCount = 256 * 256;
+
+        std::vector<f32> Rgba = []
+        {
+            std::vector<f32> values(PixelCount * 4);
+            for(size i = 0; i < values.size(); ++i)
+            {
+                values[i] = static_cast<f32>(i % 1000) / 1000;
+            }
+
+            return values;
+        }();
+
+        std::vector<u8> Srgb8(PixelCount * 4);
+        std::vector<R11G11B10> SmallFloats(PixelCount);
+    } // namespace
+
+    SSSBENCHMARK(LinearToSrgb8StdPowLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size c = 0; c < Rgba.size(); ++c)
+            {
+                const f32 linear = Rgba[c];
+                const f32 srgb = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1 / 2.4f) - 0.055f;
+                Srgb8[c] = ToUnorm8(c % 4 == 3 ? linear : srgb);
+            }
+            DoNotOptimize(Srgb8.data());
+        }
+    }
+
+    SSSBENCHMARK(LinearToSrgb8Batch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            ConvertLinearToSrgb8(Rgba, Srgb8);
+            DoNotOptimize(Srgb8.data());
+        }
+    }
+
+    SSSBENCHMARK(ToR11G11B10ScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size p = 0; p < PixelCount; ++p)
+            {
+                SmallFloats[p] = ToR11G11B10(Float3{Rgba[p * 3], Rgba[p * 3 + 1], Rgba[p * 3 + 2]});
+            }
+            DoNotOptimize(SmallFloats.data());
+        }
+    }
+
+    SSSBENCHMARK(ToR11G11B10Batch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            ConvertToR11G11B10({Rgba.data(), PixelCount * 3}, SmallFloats);
+            DoNotOptimize(SmallFloats.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,207 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "Test.h"
+#include "ColorSpace.h"
+#include "Cpu.h"
+#include "MathKernels.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        // NOTE: Odd amount of pixels so that the wide and padded remainder paths all run
+        constexpr size Pixels = 37;
+
+        f64 ExactSrgbToLinear(f64 srgb)
+        {
+            return srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4);
+        }
+
+        f64 ExactLinearToSrgb(f64 linear)
+        {
+            return linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1 / 2.4) - 0.055;
+        }
+
+        std::vector<f32> MakeChannels(size count)
+        {
+            // NOTE: Out of range values, NaN, infinity, denormals and the thresholds of the curves
+            std::vector<f32> values{0.0f,
+                                    -0.5f,
+                                    1.0f,
+                                    1.5f,
+                                    std::numeric_limits<f32>::quiet_NaN(),
+                                    std::numeric_limits<f32>::infinity(),
+                                    1e-40f,
+                                    0.0031308f,
+                                    0.04045f,
+                                    65024.0f,
+                                    70000.0f,
+                                    6.1e-5f};
+            for(size i = values.size(); i < count; ++i)
+            {
+                const auto value = static_cast<f32>(i);
+                values.push_back(i % 3 == 0 ? std::abs(std::sin(value)) : std::abs(std::cos(value)) * value);
+            }
+
+            return values;
+        }
+
+        void ExpectBatchesMatchScalar()
+        {
+            const std::vector<f32> channels = MakeChannels(Pixels * 4);
+
+            std::vector<f32> encoded(channels.size());
+            ConvertLinearToSrgb(channels, encoded);
+            std::vector<f32> decoded(channels.size());
+            ConvertSrgbToLinear(channels, decoded);
+            for(size i = 0; i < channels.size(); ++i)
+            {
+                // NOTE: The SIMD versions can use FMA so the last bits may differ
+                SSSTEST_EXPECT_EQ(std::abs(encoded[i] - LinearToSrgb(channels[i])) < 1e-6f, true);
+                SSSTEST_EXPECT_EQ(std::abs(decoded[i] - SrgbToLinear(channels[i])) < 1e-6f, true);
+            }
+
+            std::vector<u8> bytes(channels.size());
+            ConvertLinearToSrgb8(channels, bytes);
+            std::vector<f32> restored(channels.size());
+            ConvertSrgb8ToLinear(bytes, restored);
+            for(size i = 0; i < channels.size(); ++i)
+            {
+                const bool alpha = i % 4 == 3;
+                const u8 expected = alpha ? ToUnorm8(channels[i]) : ToUnorm8(LinearToSrgb(channels[i]));
+                SSSTEST_EXPECT_EQ(std::abs(bytes[i] - expected) <= 1, true);
+                SSSTEST_EXPECT_EQ(restored[i], alpha ? FromUnorm8(bytes[i]) : Srgb8ToLinear(bytes[i]));
+            }
+
+            const std::vector<f32> rgb = MakeChannels(Pixels * 3);
+            std::vector<R11G11B10> smallFloats(Pixels);
+            ConvertToR11G11B10(rgb, smallFloats);
+            std::vector<Rgb9E5> sharedExponents(Pixels);
+            ConvertToRgb9E5(rgb, sharedExponents);
+            std::vector<f32> smallFloatsRgb(rgb.size());
+            ConvertFromR11G11B10(smallFloats, smallFloatsRgb);
+            std::vector<f32> sharedExponentsRgb(rgb.size());
+            ConvertFromRgb9E5(sharedExponents, sharedExponentsRgb);
+            for(size i = 0; i < Pixels; ++i)
+            {
+                const Float3 color{rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]};
+                SSSTEST_EXPECT_EQ(smallFloats[i] == ToR11G11B10(color), true);
+                SSSTEST_EXPECT_EQ(sharedExponents[i] == ToRgb9E5(color), true);
+
+                const Float3 smallFloat = FromR11G11B10(smallFloats[i]);
+                const Float3 sharedExponent = FromRgb9E5(sharedExponents[i]);
+                SSSTEST_EXPECT_EQ(
+                    (Float3{smallFloatsRgb[i * 3], smallFloatsRgb[i * 3 + 1], smallFloatsRgb[i * 3 + 2]}) == smallFloat,
+                    true);
+                SSSTEST_EXPECT_EQ((Float3{sharedExponentsRgb[i * 3],
+                                          sharedExponentsRgb[i * 3 + 1],
+                                          sharedExponentsRgb[i * 3 + 2]}) == sharedExponent,
+                                  true);
+            }
+        }
+    } // namespace
+
+    SSSTEST_TEST(ColorSpaceSrgbCurves)
+    {
+        for(size i = 0; i <= 10'000; ++i)
+        {
+            const f32 value = static_cast<f32>(i) / 10'000;
+            const f64 linear = ExactSrgbToLinear(value);
+            const f64 srgb = ExactLinearToSrgb(value);
+            SSSTEST_EXPECT_EQ(std::abs(SrgbToLinear(value) - linear) <= 1e-5 * linear + 1e-7, true);
+            SSSTEST_EXPECT_EQ(std::abs(LinearToSrgb(value) - srgb) <= 1e-5 * srgb + 1e-7, true);
+        }
+
+        SSSTEST_EXPECT_EQ(LinearToSrgb(-1), 0.0f);
+        SSSTEST_EXPECT_EQ(LinearToSrgb(std::numeric_limits<f32>::quiet_NaN()), 0.0f);
+        SSSTEST_EXPECT_EQ(std::abs(LinearToSrgb(2) - 1) < 1e-6f, true);
+        SSSTEST_EXPECT_EQ(std::abs(SrgbToLinear(2) - 1) < 1e-6f, true);
+    }
+
+    SSSTEST_TEST(ColorSpaceSrgb8Table)
+    {
+        for(u32 i = 0; i < 256; ++i)
+        {
+            const auto srgb = static_cast<u8>(i);
+            const f32 linear = Srgb8ToLinear(srgb);
+            SSSTEST_EXPECT_EQ(linear, static_cast<f32>(ExactSrgbToLinear(static_cast<f64>(i) / 255)));
+            // NOTE: Every 8 bit value survives decoding and encoding
+            SSSTEST_EXPECT_EQ(ToUnorm8(LinearToSrgb(linear)), srgb);
+        }
+    }
+
+    SSSTEST_TEST(ColorSpaceR11G11B10)
+    {
+        SSSTEST_EXPECT_EQ(ToR11G11B10(Float3{1, 1, 1}).Bits, 0x3C0u | (0x3C0u << 11) | (0x1E0u << 22));
+        // NOTE: Too large values become the largest finite value, negative values and NaN become 0
+        SSSTEST_EXPECT_EQ(ToR11G11B10(Float3{1e9f, -1, std::numeric_limits<f32>::quiet_NaN()}).Bits, 0x7BFu);
+        SSSTEST_EXPECT_EQ(FromR11G11B10({0x7BFu | (0x3DFu << 22)}) == (Float3{65024, 0, 64512}), true);
+
+        // NOTE: Every finite value of each channel survives the round trip
+        for(u32 bits = 0; bits < (31u << 6); ++bits)
+        {
+            const R11G11B10 color{bits | (bits << 11) | ((bits >> 1) << 22)};
+            SSSTEST_EXPECT_EQ(ToR11G11B10(FromR11G11B10(color)) == color, true);
+        }
+    }
+
+    SSSTEST_TEST(ColorSpaceRgb9E5)
+    {
+        SSSTEST_EXPECT_EQ(ToRgb9E5(Float3{1, 1, 1}).Bits, 256u | (256u << 9) | (256u << 18) | (16u << 27));
+        SSSTEST_EXPECT_EQ(FromRgb9E5(ToRgb9E5(Float3{1, 0.5f, 0})) == (Float3{1, 0.5f, 0}), true);
+        SSSTEST_EXPECT_EQ(FromRgb9E5(ToRgb9E5(Float3{1e9f, -1, 0})) == (Float3{65408, 0, 0}), true);
+        // NOTE: 511.5 rounds up to 512 so the exponent goes up by one
+        SSSTEST_EXPECT_EQ(ToRgb9E5(Float3{511.75f, 0, 0}).Bits, 256u | (25u << 27));
+
+        for(const f32 value: MakeChannels(300))
+        {
+            if(!(value > 0) || value > 65408)
+            {
+                continue;
+            }
+
+            // NOTE: The largest channel keeps 9 bits of precision unless it is below the smallest exponent
+            const Float3 restored = FromRgb9E5(ToRgb9E5(Float3{value, value * 0.25f, 0}));
+            SSSTEST_EXPECT_EQ(std::abs(restored.X - value) <= value / 512 + std::ldexp(1.0f, -25), true);
+        }
+    }
+
+    SSSTEST_TEST(ColorSpaceBatchesEveryKernelLevel)
+    {
+        for(const SSSEngine::SimdLevel level: {SSSEngine::SimdLevel::Sse2, SSSEngine::SimdLevel::Avx2})
+        {
+            if(level > SSSEngine::Platform::GetSimdLevel())
+            {
+                continue;
+            }
+
+            Kernels::LoadKernels(level);
+            ExpectBatchesMatchScalar();
+        }
+
+        Kernels::LoadKernels(SSSEngine::SimdLevel::Sse2);
+    }
+} // namespace SSSTest
@@ -0,0 +1,107 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "Frustum.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size ObjectCount = 100'000;
+
+        constexpr f32 Near = 1;
+        constexpr f32 Far = 1000;
+        const Frustum CameraFrustum = ExtractFrustum(
+            Mat4x4f{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, Far / (Far - Near), 1, 0, 0, -Near * Far / (Far - Near), 0});
+
+        // NOTE: Objects spread in a cube around the camera so roughly a sixth of them are visible
+        std::vector<f32> MakeCoordinates(u32 seed)
+        {
+            std::vector<f32> coordinates(ObjectCount);
+            for(size i = 0; i < ObjectCount; ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                coordinates[i] = static_cast<f32>(seed >> 8) / static_cast<f32>(1u << 24) * 2000 - 1000;
+            }
+
+            return coordinates;
+        }
+
+        std::vector<f32> CenterX = MakeCoordinates(1);
+        std::vector<f32> CenterY = MakeCoordinates(2);
+        std::vector<f32> CenterZ = MakeCoordinates(3);
+        std::vector<f32> Extents(ObjectCount, 2);
+
+        std::vector<BoundingBox> Boxes = []
+        {
+            std::vector<BoundingBox> boxes;
+            for(size i = 0; i < ObjectCount; ++i)
+            {
+                boxes.push_back({{CenterX[i], CenterY[i], CenterZ[i]}, {2, 2, 2}});
+            }
+
+            return boxes;
+        }();
+
+        std::vector<u32> Visible(ObjectCount);
+    } // namespace
+
+    SSSBENCHMARK(CullBoxesScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            size written = 0;
+            for(size b = 0; b < ObjectCount; ++b)
+            {
+                if(Intersects(CameraFrustum, Boxes[b]))
+                {
+                    Visible[written++] = static_cast<u32>(b);
+                }
+            }
+            DoNotOptimize(Visible.data());
+            DoNotOptimize(written);
+        }
+    }
+
+    SSSBENCHMARK(CullBoxesBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            const BoundingBoxStream boxes{{CenterX, CenterY, CenterZ}, {Extents, Extents, Extents}};
+            const size written = CullBoundingBoxes(CameraFrustum, boxes, Visible);
+            DoNotOptimize(Visible.data());
+            DoNotOptimize(written);
+        }
+    }
+
+    SSSBENCHMARK(CullSpheresBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            const size written =
+                CullBoundingSpheres(CameraFrustum, BoundingSphereStream{{CenterX, CenterY, CenterZ}, Extents}, Visible);
+            DoNotOptimize(Visible.data());
+            DoNotOptimize(written);
+        }
+    }
+} // namespace SSSBenchmark
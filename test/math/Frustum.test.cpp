@@ -0,0 +1,215 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Test.h"
+#include "Cpu.h"
+#include "Frustum.h"
+#include "MathKernels.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        // NOTE: Odd size so that the 8 wide, 4 wide and padded remainder paths all run
+        constexpr size Count = 103;
+
+        // NOTE: Direct3D style perspective with a 90 degree field of view, near plane at 1 and far plane at 100
+        constexpr f32 Near = 1;
+        constexpr f32 Far = 100;
+        constexpr Mat4x4f Perspective{
+            1, 0, 0, 0, 0, 1, 0, 0, 0, 0, Far / (Far - Near), 1, 0, 0, -Near * Far / (Far - Near), 0};
+
+        struct Boxes
+        {
+            std::vector<f32> centerX, centerY, centerZ, extentX, extentY, extentZ;
+
+            BoundingBox operator[](size index) const
+            {
+                return {{centerX[index], centerY[index], centerZ[index]},
+                        {extentX[index], extentY[index], extentZ[index]}};
+            }
+
+            BoundingBoxStream Stream() const
+            {
+                return {{centerX, centerY, centerZ}, {extentX, extentY, extentZ}};
+            }
+        };
+
+        Boxes MakeBoxes()
+        {
+            Boxes boxes;
+            for(size i = 0; i < Count; ++i)
+            {
+                const auto value = static_cast<f32>(i);
+                boxes.centerX.push_back(value * 1.7f - 80);
+                boxes.centerY.push_back(static_cast<f32>(i % 7) * 5 - 15);
+                boxes.centerZ.push_back(value * 1.3f - 20);
+                boxes.extentX.push_back(1 + static_cast<f32>(i % 3));
+                boxes.extentY.push_back(0.5f);
+                boxes.extentZ.push_back(static_cast<f32>(i % 5));
+            }
+
+            return boxes;
+        }
+
+        std::vector<u32> ExpectedVisible(const Frustum &frustum, const Boxes &boxes)
+        {
+            std::vector<u32> visible;
+            for(size i = 0; i < Count; ++i)
+            {
+                if(Intersects(frustum, boxes[i]))
+                {
+                    visible.push_back(static_cast<u32>(i));
+                }
+            }
+
+            return visible;
+        }
+    } // namespace
+
+    SSSTEST_TEST(FrustumExtractIdentity)
+    {
+        // NOTE: The identity is the clip space box itself, x and y in [-1, 1] and z in [0, 1]
+        const Frustum frustum = ExtractFrustum(IdentityMatrix<Mat4x4f>());
+
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Left].Normal == (Float3{1, 0, 0}), true);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Left].Distance, 1.0f);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Top].Normal == (Float3{0, -1, 0}), true);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Near].Normal == (Float3{0, 0, 1}), true);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Near].Distance, 0.0f);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Far].Normal == (Float3{0, 0, -1}), true);
+        SSSTEST_EXPECT_EQ(frustum[FrustumPlane::Far].Distance, 1.0f);
+    }
+
+    SSSTEST_TEST(FrustumIntersectsPerspective)
+    {
+        const Frustum frustum = ExtractFrustum(Perspective);
+
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingBox{{0, 0, 50}, {1, 1, 1}}), true);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingBox{{0, 0, -5}, {1, 1, 1}}), false);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingBox{{0, 0, 150}, {1, 1, 1}}), false);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingBox{{60, 0, 50}, {1, 1, 1}}), false);
+        // NOTE: Straddles the right plane
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingBox{{52, 0, 50}, {3, 1, 1}}), true);
+
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingSphere{{0, 20, 50}, 1}), true);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingSphere{{0, 60, 50}, 1}), false);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingSphere{{0, 0, 0}, 2}), true);
+        SSSTEST_EXPECT_EQ(Intersects(frustum, BoundingSphere{{0, 0, 0}, 0.5f}), false);
+    }
+
+    SSSTEST_TEST(FrustumCullBoundingBoxes)
+    {
+        const Frustum frustum = ExtractFrustum(Perspective);
+        const Boxes boxes = MakeBoxes();
+        const std::vector<u32> expected = ExpectedVisible(frustum, boxes);
+
+        std::vector<u32> visible(Count);
+        const size written = CullBoundingBoxes(frustum, boxes.Stream(), visible);
+
+        SSSTEST_EXPECT_EQ(expected.empty(), false);
+        SSSTEST_EXPECT_EQ(expected.size() < Count, true);
+        SSSTEST_EXPECT_EQ(written, expected.size());
+        visible.resize(written);
+        SSSTEST_EXPECT_EQ(visible == expected, true);
+    }
+
+    SSSTEST_TEST(FrustumCullSubspans)
+    {
+        const Frustum frustum = ExtractFrustum(Perspective);
+        const Boxes boxes = MakeBoxes();
+        const std::vector<u32> expected = ExpectedVisible(frustum, boxes);
+
+        // NOTE: How the batch would be split between threads, each part with its own output
+        constexpr size Split = 45;
+        std::vector<u32> first(Split), second(Count - Split);
+        const size firstWritten = CullBoundingBoxes(frustum, boxes.Stream().Subspan(0, Split), first);
+        const size secondWritten =
+            CullBoundingBoxes(frustum, boxes.Stream().Subspan(Split, Count - Split), second, static_cast<u32>(Split));
+
+        first.resize(firstWritten);
+        first.insert(first.end(), second.begin(), second.begin() + static_cast<std::ptrdiff_t>(secondWritten));
+        SSSTEST_EXPECT_EQ(first == expected, true);
+    }
+
+    SSSTEST_TEST(FrustumCullBoundingSpheres)
+    {
+        const Frustum frustum = ExtractFrustum(Perspective);
+        const Boxes boxes = MakeBoxes();
+
+        std::vector<f32> radius;
+        std::vector<u32> expected;
+        for(size i = 0; i < Count; ++i)
+        {
+            const BoundingSphere sphere = BoundingSphereFromBox(boxes[i]);
+            radius.push_back(sphere.Radius);
+            if(Intersects(frustum, sphere))
+            {
+                expected.push_back(static_cast<u32>(i));
+            }
+        }
+
+        std::vector<u32> visible(Count);
+        const size written = CullBoundingSpheres(
+            frustum, BoundingSphereStream{{boxes.centerX, boxes.centerY, boxes.centerZ}, radius}, visible);
+
+        visible.resize(written);
+        SSSTEST_EXPECT_EQ(visible == expected, true);
+    }
+
+    SSSTEST_TEST(FrustumCullEveryKernelLevel)
+    {
+        const Frustum frustum = ExtractFrustum(Perspective);
+        const Boxes boxes = MakeBoxes();
+        const std::vector<u32> expected = ExpectedVisible(frustum, boxes);
+
+        for(const SSSEngine::SimdLevel level: {SSSEngine::SimdLevel::Sse2, SSSEngine::SimdLevel::Avx2})
+        {
+            if(level > SSSEngine::Platform::GetSimdLevel())
+            {
+                continue;
+            }
+
+            Kernels::LoadKernels(level);
+            std::vector<u32> visible(Count);
+            visible.resize(CullBoundingBoxes(frustum, boxes.Stream(), visible));
+            SSSTEST_EXPECT_EQ(visible == expected, true);
+        }
+
+        Kernels::LoadKernels(SSSEngine::SimdLevel::Sse2);
+    }
+
+    SSSTEST_TEST(BoundingBoxOperations)
+    {
+        const std::vector<Float3> points{{1, 2, 3}, {-1, 5, 0}, {3, -2, 1}};
+        const BoundingBox box = BoundingBoxFromPoints(points);
+        SSSTEST_EXPECT_EQ(box == BoundingBoxFromMinMax({-1, -2, 0}, {3, 5, 3}), true);
+
+        const BoundingBox merged = Merge(box, BoundingBoxFromMinMax({0, 0, 0}, {10, 1, 1}));
+        SSSTEST_EXPECT_EQ(merged == BoundingBoxFromMinMax({-1, -2, 0}, {10, 5, 3}), true);
+
+        // NOTE: A quarter turn around Z swaps the X and Y extents
+        constexpr Mat4x4f Rotation{0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 1};
+        const BoundingBox transformed = TransformBoundingBox(BoundingBox{{1, 0, 0}, {1, 2, 3}}, Rotation);
+        SSSTEST_EXPECT_EQ(transformed == (BoundingBox{{5, 1, 0}, {2, 1, 3}}), true);
+    }
+} // namespace SSSTest
@@ -0,0 +1,145 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include "Benchmark.h"
+#include "Matrix.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        // NOTE: The implementation of operator* before the SIMD kernels, kept as the baseline to compare against
+        Mat4x4f LegacyMultiply(const Mat4x4f &lhs, const Mat4x4f &rhs)
+        {
+            Mat4x4f result;
+
+            for(MatrixSize i = 0; i < 4; ++i)
+            {
+                for(MatrixSize k = 0; k < 4; ++k)
+                {
+                    for(MatrixSize j = 0; j < 4; ++j)
+                    {
+                        result[i, j] += lhs[i, k] * rhs[k, j];
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        Mat4x4f World{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 4, 5, 6, 1};
+        Mat4x4f View{0.7f, 0, -0.7f, 0, 0, 1, 0, 0, 0.7f, 0, 0.7f, 0, 0, 0, 10, 1};
+        Mat4x4f Projection{1.2f, 0, 0, 0, 0, 2.4f, 0, 0, 0, 0, 1.001f, 1, 0, 0, -0.1f, 0};
+    } // namespace
+
+    SSSBENCHMARK(MatrixMultiplyLegacyLoop, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f worldViewProj = LegacyMultiply(LegacyMultiply(World, View), Projection);
+            DoNotOptimize(worldViewProj);
+        }
+    }
+
+    SSSBENCHMARK(MatrixMultiplyScalar, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f worldViewProj = Detail::MultiplyScalar(Detail::MultiplyScalar(World, View), Projection);
+            DoNotOptimize(worldViewProj);
+        }
+    }
+
+    SSSBENCHMARK(MatrixMultiplySimd, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f worldViewProj = World * View * Projection;
+            DoNotOptimize(worldViewProj);
+        }
+    }
+
+    SSSBENCHMARK(MatrixMultiplySimdIntermediate, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            const Mat4x4f worldView = World * View;
+            Mat4x4f worldViewProj = worldView * Projection;
+            DoNotOptimize(worldViewProj);
+        }
+    }
+
+    SSSBENCHMARK(MatrixTransformVector, 10'000'000)
+    {
+        Float4 vector{1, 2, 3, 1};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            vector = vector * World;
+            DoNotOptimize(vector);
+        }
+    }
+
+    SSSBENCHMARK(MatrixInverseScalar, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f inverse;
+            Detail::InverseScalar(View, inverse);
+            DoNotOptimize(inverse);
+        }
+    }
+
+    SSSBENCHMARK(MatrixInverseSimd, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f inverse = Inverse(View);
+            DoNotOptimize(inverse);
+        }
+    }
+
+    SSSBENCHMARK(MatrixInverseAffine, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f inverse = InverseAffine(View);
+            DoNotOptimize(inverse);
+        }
+    }
+
+    SSSBENCHMARK(MatrixInverseRigid, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Mat4x4f inverse = InverseRigid(View);
+            DoNotOptimize(inverse);
+        }
+    }
+
+    SSSBENCHMARK(MatrixDeterminant, 10'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            f32 determinant = Determinant(View);
+            DoNotOptimize(determinant);
+        }
+    }
+} // namespace SSSBenchmark
@@ -17,6 +17,7 @@
     USA
 */
 
+#include <cmath>
 #include "Test.h"
 #include "Matrix.h"
 
@@ -24,6 +25,31 @@ using namespace SSSEngine::Math;
 
 namespace SSSTest
 {
+    namespace
+    {
+        bool NearlyEqual(const Mat4x4f &lhs, const Mat4x4f &rhs)
+        {
+            for(MatrixSize i = 0; i < Mat4x4f::NumberElements(); ++i)
+            {
+                if(std::abs(lhs.data[i] - rhs.data[i]) > 1e-5f)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<typename Lhs, typename Rhs>
+        concept CanMultiply = requires(const Lhs &lhs, const Rhs &rhs) { lhs * rhs; };
+
+        // NOTE: A rotation of 90 degrees around Y followed by a translation
+        constexpr Mat4x4f Rigid{0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 4, -5, 6, 1};
+        // NOTE: Rigid with a non uniform scale and a shear applied first
+        constexpr Mat4x4f Affine{0, 0, -2, 0, 0, 0.5f, 0, 0, 3, 1, 0, 0, 4, -5, 6, 1};
+        constexpr Mat4x4f General{2, 1, 0, 3, 1, 3, 2, 0, 0, 1, 4, 1, 1, 0, 2, 5};
+    } // namespace
+
     SSSTEST_TEST(MatrixEquality)
     {
         Mat4x4f m1{1, 4, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
@@ -44,6 +70,94 @@ namespace SSSTest
         SSSTEST_EXPECT_EQ(result, expected);
     }
 
+    SSSTEST_TEST(MatrixMultiplicationRuntimeMatchesConstexpr)
+    {
+        constexpr Mat4x4f M1{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        constexpr Mat4x4f M2{2, 0, 1, 3, 1, 4, 0, 2, 5, 1, 2, 0, 0, 3, 1, 1};
+        constexpr Mat4x4f Expected = M1 * M2;
+        constexpr Mat4x4f Known{19, 23, 11, 11, 51, 55, 27, 35, 83, 87, 43, 59, 115, 119, 59, 83};
+
+        Mat4x4f m1 = M1;
+        Mat4x4f m2 = M2;
+        Mat4x4f result = m1 * m2;
+
+        SSSTEST_EXPECT_EQ(Expected, Known);
+        SSSTEST_EXPECT_EQ(result, Expected);
+    }
+
+    SSSTEST_TEST(MatrixNonSquareMultiplication)
+    {
+        using Mat3x2f = Matrix<f32, 3, 2>;
+        using Mat4x3f = Matrix<f32, 4, 3>;
+        using Mat4x2f = Matrix<f32, 4, 2>;
+
+        constexpr Mat3x2f Lhs{1, 2, 3, 4, 5, 6};
+        constexpr Mat4x3f Rhs{1, 0, 2, 1, 0, 1, 1, 0, 2, 1, 0, 1};
+        constexpr Mat4x2f Expected{7, 5, 4, 4, 16, 11, 13, 10};
+
+        constexpr Mat4x2f ConstantResult = Lhs * Rhs;
+        SSSTEST_EXPECT_EQ(ConstantResult, Expected);
+
+        Mat3x2f lhs = Lhs;
+        Mat4x3f rhs = Rhs;
+        Mat4x2f result = lhs * rhs;
+        SSSTEST_EXPECT_EQ(result, Expected);
+        SSSTEST_EXPECT_EQ(Detail::MultiplyScalar(lhs, rhs), Expected);
+
+        SSSENGINE_STATIC_ASSERT((CanMultiply<Mat3x2f, Mat4x3f>), "A 2x3 matrix can multiply a 3x4 matrix")
+        SSSENGINE_STATIC_ASSERT((!CanMultiply<Mat3x2f, Mat3x2f>), "A 2x3 matrix can't multiply a 2x3 matrix")
+        SSSENGINE_STATIC_ASSERT((!CanMultiply<Mat4x3f, Mat3x2f>), "A 3x4 matrix can't multiply a 2x3 matrix")
+    }
+
+    SSSTEST_TEST(MatrixProductChain)
+    {
+        constexpr Mat4x4f M1{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        constexpr Mat4x4f M2{2, 0, 1, 3, 1, 4, 0, 2, 5, 1, 2, 0, 0, 3, 1, 1};
+        constexpr Mat4x4f M3{1, 0, 0, 1, 0, 2, 0, 0, 1, 0, 1, 0, 0, 1, 0, 3};
+        constexpr Mat4x4f Expected = Detail::MultiplyScalar(Detail::MultiplyScalar(M1, M2), M3);
+        constexpr Mat4x4f ConstantChain = M1 * M2 * M3;
+
+        SSSTEST_EXPECT_EQ(ConstantChain, Expected);
+
+        Mat4x4f m1 = M1;
+        Mat4x4f m2 = M2;
+        Mat4x4f m3 = M3;
+        Mat4x4f chain = m1 * m2 * m3;
+        Mat4x4f rightNested = m1 * (m2 * m3);
+
+        SSSTEST_EXPECT_EQ(chain, Expected);
+        SSSTEST_EXPECT_EQ(rightNested, Expected);
+        SSSTEST_EXPECT_EQ(m1 * m2 * m3, Expected);
+    }
+
+    SSSTEST_TEST(MatrixProductKeepsTemporaries)
+    {
+        auto scaled = [](f32 scale) { return Mat4x4f{scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, scale, 0, 0, 0, 0, 1}; };
+        Mat4x4f translation{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1};
+
+        // NOTE: The temporaries must be stored by value in the expression or they would be dangling by now
+        const auto expression = scaled(2) * scaled(3) * translation;
+        const Mat4x4f result = expression;
+
+        const Mat4x4f expected{6, 0, 0, 0, 0, 6, 0, 0, 0, 0, 6, 0, 1, 2, 3, 1};
+        SSSTEST_EXPECT_EQ(result, expected);
+    }
+
+    SSSTEST_TEST(MatrixVectorTransform)
+    {
+        constexpr Mat4x4f Translation{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 5, 6, 7, 1};
+        constexpr Float4 Point{1, 2, 3, 1};
+        constexpr Float4 Direction{1, 2, 3, 0};
+        constexpr Float4 Expected = Point * Translation;
+
+        Float4 point = Point;
+        Float4 direction = Direction;
+
+        SSSTEST_EXPECT_EQ(Expected, (Float4{6, 8, 10, 1}));
+        SSSTEST_EXPECT_EQ(point * Translation, Expected);
+        SSSTEST_EXPECT_EQ(direction * Translation, Direction);
+    }
+
     SSSTEST_TEST(MatrixSubscriptOperator)
     {
         Mat4x4f m{1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6};
@@ -79,4 +193,48 @@ namespace SSSTest
             SSSTEST_EXPECT_EQ(Identity2x2, Expected);
         }
     }
+
+    SSSTEST_TEST(MatrixDeterminant)
+    {
+        constexpr f32 Expected = 32;
+        constexpr f32 ConstantDeterminant = Determinant(General);
+
+        SSSTEST_EXPECT_EQ(ConstantDeterminant, Expected);
+        SSSTEST_EXPECT_EQ(std::abs(Determinant(General) - Expected) < 1e-4f, true);
+        SSSTEST_EXPECT_EQ(std::abs(Determinant(Affine) - 3.0f) < 1e-5f, true);
+    }
+
+    SSSTEST_TEST(MatrixInverse)
+    {
+        constexpr Mat4x4f Identity = IdentityMatrix<Mat4x4f>();
+        constexpr Mat4x4f ConstantInverse = Inverse(General);
+
+        const Mat4x4f inverse = Inverse(General);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse, ConstantInverse), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(General * inverse, Identity), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse * General, Identity), true);
+    }
+
+    SSSTEST_TEST(MatrixInverseAffine)
+    {
+        constexpr Mat4x4f ConstantInverse = InverseAffine(Affine);
+
+        const Mat4x4f inverse = InverseAffine(Affine);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse, ConstantInverse), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse, Inverse(Affine)), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(Affine * inverse, IdentityMatrix<Mat4x4f>()), true);
+    }
+
+    SSSTEST_TEST(MatrixInverseRigid)
+    {
+        constexpr Mat4x4f ConstantInverse = InverseRigid(Rigid);
+
+        const Mat4x4f inverse = InverseRigid(Rigid);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse, ConstantInverse), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(inverse, Inverse(Rigid)), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(Rigid * inverse, IdentityMatrix<Mat4x4f>()), true);
+    }
 } // namespace SSSTest
@@ -0,0 +1,91 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "Packed.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size ValueCount = 300'000;
+        constexpr size NormalCount = 100'000;
+
+        std::vector<f32> Values = []
+        {
+            std::vector<f32> values(ValueCount);
+            for(size i = 0; i < ValueCount; ++i)
+            {
+                values[i] = static_cast<f32>(i) * 0.37f - 5000;
+            }
+
+            return values;
+        }();
+
+        std::vector<Float3> Normals(NormalCount, Float3{0.48f, -0.6f, -0.64f});
+
+        std::vector<Half> Halves(ValueCount);
+        std::vector<OctahedralNormal> Encoded(NormalCount);
+    } // namespace
+
+    SSSBENCHMARK(ToHalfScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size v = 0; v < ValueCount; ++v)
+            {
+                Halves[v] = ToHalf(Values[v]);
+            }
+            DoNotOptimize(Halves.data());
+        }
+    }
+
+    SSSBENCHMARK(ToHalfBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            ConvertToHalf(Values, Halves);
+            DoNotOptimize(Halves.data());
+        }
+    }
+
+    SSSBENCHMARK(EncodeOctahedralScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size n = 0; n < NormalCount; ++n)
+            {
+                Encoded[n] = EncodeOctahedral(Normals[n]);
+            }
+            DoNotOptimize(Encoded.data());
+        }
+    }
+
+    SSSBENCHMARK(EncodeOctahedralBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            EncodeOctahedral(Normals, Encoded);
+            DoNotOptimize(Encoded.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,183 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "Test.h"
+#include "Cpu.h"
+#include "MathKernels.h"
+#include "Packed.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        // NOTE: Odd size so that the wide and padded remainder paths all run
+        constexpr size Count = 37;
+
+        std::vector<f32> MakeValues()
+        {
+            // NOTE: Normals, denormals, ties, out of range values and infinity for the halves
+            std::vector<f32> values{0.0f,
+                                    -0.0f,
+                                    1.0f,
+                                    -2.5f,
+                                    65504.0f,
+                                    65520.0f,
+                                    1e-7f,
+                                    -6.1e-5f,
+                                    1.00048828125f,
+                                    1.00146484375f,
+                                    std::numeric_limits<f32>::infinity(),
+                                    0.33333333f};
+            for(size i = values.size(); i < Count; ++i)
+            {
+                values.push_back(std::sin(static_cast<f32>(i)) * static_cast<f32>(i * i));
+            }
+
+            return values;
+        }
+
+        std::vector<Float3> MakeNormals()
+        {
+            std::vector<Float3> normals;
+            for(size i = 0; i < Count; ++i)
+            {
+                const auto value = static_cast<f32>(i);
+                const Float3 direction{std::sin(value * 1.3f), std::cos(value * 0.7f), std::sin(value * 2.9f) - 0.1f};
+                normals.push_back(direction / std::sqrt(direction.X * direction.X + direction.Y * direction.Y +
+                                                        direction.Z * direction.Z));
+            }
+
+            return normals;
+        }
+
+        void ExpectBatchesMatchScalar()
+        {
+            const std::vector<f32> values = MakeValues();
+
+            std::vector<Half> halves(Count);
+            ConvertToHalf(values, halves);
+            std::vector<f32> restored(Count);
+            ConvertFromHalf(halves, restored);
+            for(size i = 0; i < Count; ++i)
+            {
+                SSSTEST_EXPECT_EQ(halves[i] == ToHalf(values[i]), true);
+                SSSTEST_EXPECT_EQ(std::bit_cast<u32>(restored[i]) == std::bit_cast<u32>(FromHalf(halves[i])), true);
+            }
+
+            std::vector<Snorm16> snorms(Count);
+            ConvertToSnorm16(values, snorms);
+            std::vector<u8> unorms(Count);
+            ConvertToUnorm8(values, unorms);
+            std::vector<f32> normalized(Count);
+            ConvertFromUnorm8(unorms, normalized);
+            for(size i = 0; i < Count; ++i)
+            {
+                SSSTEST_EXPECT_EQ(snorms[i] == ToSnorm16(values[i]), true);
+                SSSTEST_EXPECT_EQ(unorms[i], ToUnorm8(values[i]));
+                SSSTEST_EXPECT_EQ(normalized[i], FromUnorm8(unorms[i]));
+            }
+
+            const std::vector<Float3> normals = MakeNormals();
+            std::vector<OctahedralNormal> encoded(Count);
+            EncodeOctahedral(normals, encoded);
+            for(size i = 0; i < Count; ++i)
+            {
+                const OctahedralNormal expected = EncodeOctahedral(normals[i]);
+                SSSTEST_EXPECT_EQ(encoded[i].X == expected.X && encoded[i].Y == expected.Y, true);
+            }
+        }
+    } // namespace
+
+    SSSTEST_TEST(PackedHalfConversion)
+    {
+        SSSTEST_EXPECT_EQ(ToHalf(1.0f).Bits, 0x3C00);
+        SSSTEST_EXPECT_EQ(ToHalf(-2.0f).Bits, 0xC000);
+        SSSTEST_EXPECT_EQ(ToHalf(65504.0f).Bits, 0x7BFF);
+        SSSTEST_EXPECT_EQ(ToHalf(65520.0f).Bits, 0x7C00);
+        SSSTEST_EXPECT_EQ(ToHalf(std::numeric_limits<f32>::infinity()).Bits, 0x7C00);
+        SSSTEST_EXPECT_EQ(ToHalf(std::numeric_limits<f32>::quiet_NaN()).Bits, 0x7E00);
+        // NOTE: The smallest denormal half
+        SSSTEST_EXPECT_EQ(ToHalf(5.9604645e-8f).Bits, 0x0001);
+        // NOTE: Ties round to even
+        SSSTEST_EXPECT_EQ(ToHalf(1.00048828125f).Bits, 0x3C00);
+        SSSTEST_EXPECT_EQ(ToHalf(1.00146484375f).Bits, 0x3C02);
+
+        // NOTE: Every half survives the round trip
+        for(u32 bits = 0; bits <= 0xFFFF; ++bits)
+        {
+            const Half half{static_cast<u16>(bits)};
+            const bool nan = (bits & 0x7C00) == 0x7C00 && (bits & 0x03FF) != 0;
+            if(nan)
+            {
+                SSSTEST_EXPECT_EQ(std::isnan(FromHalf(half)), true);
+            }
+            else
+            {
+                SSSTEST_EXPECT_EQ(ToHalf(FromHalf(half)) == half, true);
+            }
+        }
+    }
+
+    SSSTEST_TEST(PackedNormalizedConversion)
+    {
+        SSSTEST_EXPECT_EQ(ToSnorm16(1.0f).Value, 32767);
+        SSSTEST_EXPECT_EQ(ToSnorm16(-2.0f).Value, -32767);
+        SSSTEST_EXPECT_EQ(ToSnorm16(0.5f).Value, 16384);
+        SSSTEST_EXPECT_EQ(FromSnorm16(Snorm16{-32768}), -1.0f);
+        SSSTEST_EXPECT_EQ(ToUnorm8(1.5f), 255);
+        SSSTEST_EXPECT_EQ(ToUnorm8(-1.0f), 0);
+        SSSTEST_EXPECT_EQ(ToUnorm8(0.5f), 128);
+        SSSTEST_EXPECT_EQ(FromUnorm8(255), 1.0f);
+    }
+
+    SSSTEST_TEST(PackedOctahedralRoundTrip)
+    {
+        for(const Float3 &normal: MakeNormals())
+        {
+            const Float3 decoded = DecodeOctahedral(EncodeOctahedral(normal));
+            SSSTEST_EXPECT_EQ(std::abs(decoded.X - normal.X) < 1e-4f, true);
+            SSSTEST_EXPECT_EQ(std::abs(decoded.Y - normal.Y) < 1e-4f, true);
+            SSSTEST_EXPECT_EQ(std::abs(decoded.Z - normal.Z) < 1e-4f, true);
+        }
+
+        const Float3 down = DecodeOctahedral(EncodeOctahedral(Float3{0, 0, -1}));
+        SSSTEST_EXPECT_EQ(down == (Float3{0, 0, -1}), true);
+    }
+
+    SSSTEST_TEST(PackedBatchesEveryKernelLevel)
+    {
+        for(const SSSEngine::SimdLevel level: {SSSEngine::SimdLevel::Sse2, SSSEngine::SimdLevel::Avx2})
+        {
+            if(level > SSSEngine::Platform::GetSimdLevel())
+            {
+                continue;
+            }
+
+            Kernels::LoadKernels(level);
+            ExpectBatchesMatchScalar();
+        }
+
+        Kernels::LoadKernels(SSSEngine::SimdLevel::Sse2);
+    }
+} // namespace SSSTest
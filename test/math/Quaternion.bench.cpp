@@ -0,0 +1,83 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "Quaternion.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size TransformCount = 100'000;
+
+        std::vector<Float3> Positions(TransformCount, Float3{1, 2, 3});
+        std::vector<Quaternionf> From(TransformCount, QuaternionFromEuler(Float3{0.3f, -1.2f, 0.8f}));
+        std::vector<Quaternionf> To(TransformCount, QuaternionFromEuler(Float3{-0.5f, 0.4f, 0.1f}));
+        std::vector<f32> Factors(TransformCount, 0.3f);
+        std::vector<Float3> Scales(TransformCount, Float3{1, 2, 0.5f});
+
+        std::vector<Quaternionf> Rotations(TransformCount);
+        std::vector<Mat4x4f> Matrices(TransformCount);
+    } // namespace
+
+    SSSBENCHMARK(SlerpScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size t = 0; t < TransformCount; ++t)
+            {
+                Rotations[t] = Slerp(From[t], To[t], Factors[t]);
+            }
+            DoNotOptimize(Rotations.data());
+        }
+    }
+
+    SSSBENCHMARK(SlerpBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Slerp(From, To, Factors, Rotations);
+            DoNotOptimize(Rotations.data());
+        }
+    }
+
+    SSSBENCHMARK(ComposeTransformScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size t = 0; t < TransformCount; ++t)
+            {
+                Matrices[t] = ComposeTransform(Positions[t], From[t], Scales[t]);
+            }
+            DoNotOptimize(Matrices.data());
+        }
+    }
+
+    SSSBENCHMARK(ComposeTransformsBatch, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            ComposeTransforms(Positions, From, Scales, Matrices);
+            DoNotOptimize(Matrices.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,243 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+#include "Test.h"
+#include "Quaternion.h"
+#include "Cpu.h"
+#include "MathKernels.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        // NOTE: Odd size so that the 8 wide, 4 wide and padded remainder paths all run
+        constexpr size Count = 23;
+
+        bool NearlyEqual(f32 lhs, f32 rhs, f32 tolerance = 1e-4f)
+        {
+            return std::abs(lhs - rhs) < tolerance;
+        }
+
+        bool NearlyEqual(Quaternionf lhs, Quaternionf rhs, f32 tolerance = 1e-4f)
+        {
+            return NearlyEqual(lhs.X, rhs.X, tolerance) && NearlyEqual(lhs.Y, rhs.Y, tolerance) &&
+                   NearlyEqual(lhs.Z, rhs.Z, tolerance) && NearlyEqual(lhs.W, rhs.W, tolerance);
+        }
+
+        bool NearlyEqual(const Mat4x4f &lhs, const Mat4x4f &rhs)
+        {
+            for(MatrixSize i = 0; i < Mat4x4f::NumberElements(); ++i)
+            {
+                if(!NearlyEqual(lhs.data[i], rhs.data[i]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::vector<Quaternionf> MakeRotations(f32 offset)
+        {
+            std::vector<Quaternionf> rotations;
+            for(size i = 0; i < Count; ++i)
+            {
+                const auto value = static_cast<f32>(i) + offset;
+                rotations.push_back(QuaternionFromEuler(Float3{value * 0.3f, value * -0.7f, value * 0.11f}));
+            }
+
+            return rotations;
+        }
+    } // namespace
+
+    SSSTEST_TEST(QuaternionAxisAngleMatchesMatrix)
+    {
+        // NOTE: A quarter turn around Z takes X to Y
+        const Quaternionf rotation = QuaternionFromAxisAngle(Float3{0, 0, 1}, std::numbers::pi_v<f32> / 2);
+        const Float3 rotated = Rotate(Float3{1, 0, 0}, rotation);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(rotated.X, 0), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(rotated.Y, 1), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(rotated.Z, 0), true);
+
+        const Float4 transformed = Float4{1, 0, 0, 1} * ToMatrix(rotation);
+        SSSTEST_EXPECT_EQ(NearlyEqual(transformed.X, rotated.X), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(transformed.Y, rotated.Y), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(transformed.Z, rotated.Z), true);
+    }
+
+    SSSTEST_TEST(QuaternionProductMatchesMatrixProduct)
+    {
+        const Quaternionf first = QuaternionFromEuler(Float3{0.3f, -1.2f, 0.8f});
+        const Quaternionf second = QuaternionFromAxisAngle(Float3{0, 1, 0}, 0.5f);
+
+        const Mat4x4f expected = ToMatrix(first) * ToMatrix(second);
+        SSSTEST_EXPECT_EQ(NearlyEqual(ToMatrix(first * second), expected), true);
+    }
+
+    SSSTEST_TEST(QuaternionEulerMatchesAxisAngles)
+    {
+        const Float3 angles{0.4f, -0.9f, 1.3f};
+
+        const Quaternionf roll = QuaternionFromAxisAngle(Float3{0, 0, 1}, angles.Z);
+        const Quaternionf pitch = QuaternionFromAxisAngle(Float3{1, 0, 0}, angles.X);
+        const Quaternionf yaw = QuaternionFromAxisAngle(Float3{0, 1, 0}, angles.Y);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(QuaternionFromEuler(angles), roll * pitch * yaw), true);
+    }
+
+    SSSTEST_TEST(QuaternionConjugateIsInverse)
+    {
+        const Quaternionf rotation = QuaternionFromEuler(Float3{0.3f, -1.2f, 0.8f});
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(rotation * Conjugate(rotation), Quaternionf{}), true);
+    }
+
+    SSSTEST_TEST(QuaternionSlerpEndpoints)
+    {
+        const Quaternionf from = QuaternionFromAxisAngle(Float3{0, 1, 0}, 0.2f);
+        const Quaternionf to = QuaternionFromAxisAngle(Float3{0, 1, 0}, 1.4f);
+
+        SSSTEST_EXPECT_EQ(NearlyEqual(Slerp(from, to, 0.0f), from), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(Slerp(from, to, 1.0f), to), true);
+        SSSTEST_EXPECT_EQ(NearlyEqual(Slerp(from, to, 0.5f), QuaternionFromAxisAngle(Float3{0, 1, 0}, 0.8f)), true);
+        // NOTE: -to is the same rotation so the result must be the same
+        SSSTEST_EXPECT_EQ(NearlyEqual(Slerp(from, -to, 0.5f), QuaternionFromAxisAngle(Float3{0, 1, 0}, 0.8f)), true);
+    }
+
+    SSSTEST_TEST(QuaternionComposeTransform)
+    {
+        const Float3 position{1, -2, 3};
+        const Quaternionf rotation = QuaternionFromEuler(Float3{0.3f, -1.2f, 0.8f});
+        const Float3 scale{2, 0.5f, 3};
+
+        Mat4x4f scaling{};
+        scaling.data[0] = scale.X;
+        scaling.data[5] = scale.Y;
+        scaling.data[10] = scale.Z;
+        scaling.data[15] = 1;
+
+        Mat4x4f translation{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, position.X, position.Y, position.Z, 1};
+
+        const Mat4x4f expected = scaling * ToMatrix(rotation) * translation;
+        SSSTEST_EXPECT_EQ(NearlyEqual(ComposeTransform(position, rotation, scale), expected), true);
+    }
+
+    SSSTEST_TEST(QuaternionBatchNormalize)
+    {
+        std::vector<Quaternionf> quaternions = MakeRotations(0);
+        for(size i = 0; i < Count; ++i)
+        {
+            quaternions[i] = quaternions[i] * static_cast<f32>(i + 1);
+        }
+
+        std::vector<Quaternionf> result(Count);
+        NormalizeQuaternions(quaternions, result);
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Normalize(quaternions[i])), true);
+        }
+    }
+
+    SSSTEST_TEST(QuaternionBatchInterpolation)
+    {
+        const std::vector<Quaternionf> from = MakeRotations(0);
+        std::vector<Quaternionf> to = MakeRotations(0.5f);
+        std::vector<f32> t;
+        for(size i = 0; i < Count; ++i)
+        {
+            t.push_back(static_cast<f32>(i) / (Count - 1));
+            // NOTE: Makes sure the shortest path is taken in every lane
+            if(i % 3 == 0)
+            {
+                to[i] = -to[i];
+            }
+        }
+
+        std::vector<Quaternionf> result(Count);
+
+        Nlerp(from, to, t, result);
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Nlerp(from[i], to[i], t[i])), true);
+        }
+
+        Slerp(from, to, t, result);
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Slerp(from[i], to[i], t[i])), true);
+        }
+    }
+
+    SSSTEST_TEST(QuaternionBatchComposeTransforms)
+    {
+        const std::vector<Quaternionf> rotations = MakeRotations(0);
+        std::vector<Float3> positions, scales;
+        for(size i = 0; i < Count; ++i)
+        {
+            const auto value = static_cast<f32>(i);
+            positions.push_back({value, -value, value * 2});
+            scales.push_back({1 + value * 0.1f, 2, 0.5f + value});
+        }
+
+        std::vector<Mat4x4f> result(Count);
+        ComposeTransforms(positions, rotations, scales, result);
+
+        for(size i = 0; i < Count; ++i)
+        {
+            SSSTEST_EXPECT_EQ(NearlyEqual(result[i], ComposeTransform(positions[i], rotations[i], scales[i])), true);
+        }
+    }
+
+    SSSTEST_TEST(QuaternionBatchEveryKernelLevel)
+    {
+        const std::vector<Quaternionf> from = MakeRotations(0);
+        const std::vector<Quaternionf> to = MakeRotations(0.5f);
+        const std::vector<f32> t(Count, 0.3f);
+        const std::vector<Float3> positions(Count, Float3{1, 2, 3}), scales(Count, Float3{2, 2, 0.5f});
+        std::vector<Quaternionf> result(Count);
+        std::vector<Mat4x4f> transforms(Count);
+
+        for(const SSSEngine::SimdLevel level: {SSSEngine::SimdLevel::Sse2, SSSEngine::SimdLevel::Avx2})
+        {
+            if(level > SSSEngine::Platform::GetSimdLevel())
+            {
+                continue;
+            }
+
+            SSSTEST_EXPECT_EQ(Kernels::LoadKernels(level) == level, true);
+            Slerp(from, to, t, result);
+            ComposeTransforms(positions, from, scales, transforms);
+
+            for(size i = 0; i < Count; ++i)
+            {
+                SSSTEST_EXPECT_EQ(NearlyEqual(result[i], Slerp(from[i], to[i], t[i])), true);
+                SSSTEST_EXPECT_EQ(NearlyEqual(transforms[i], ComposeTransform(positions[i], from[i], scales[i])), true);
+            }
+        }
+
+        Kernels::LoadKernels(SSSEngine::SimdLevel::Sse2);
+    }
+} // namespace SSSTest
@@ -0,0 +1,117 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <vector>
+#include "Benchmark.h"
+#include "Transcendental.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size ValueCount = 100'000;
+
+        std::vector<f32> Angles = []
+        {
+            std::vector<f32> angles(ValueCount);
+            for(size i = 0; i < ValueCount; ++i)
+            {
+                angles[i] = static_cast<f32>(i) * 0.01f - 500;
+            }
+
+            return angles;
+        }();
+
+        std::vector<f32> Sines(ValueCount);
+        std::vector<f32> Cosines(ValueCount);
+    } // namespace
+
+    SSSBENCHMARK(SinCosStdLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size v = 0; v < ValueCount; ++v)
+            {
+                Sines[v] = std::sin(Angles[v]);
+                Cosines[v] = std::cos(Angles[v]);
+            }
+            DoNotOptimize(Sines.data());
+            DoNotOptimize(Cosines.data());
+        }
+    }
+
+    SSSBENCHMARK(SinCosFastScalarLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size v = 0; v < ValueCount; ++v)
+            {
+                FastSinCos(Angles[v], Sines[v], Cosines[v]);
+            }
+            DoNotOptimize(Sines.data());
+            DoNotOptimize(Cosines.data());
+        }
+    }
+
+    SSSBENCHMARK(SinCosFastSimd, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Simd::ForEachLanes(ValueCount,
+                               [&]<typename Register>(size index)
+                               {
+                                   Register sine, cosine;
+                                   Simd::FastSinCos(Simd::Load<Register>(&Angles[index]), sine, cosine);
+                                   Simd::Store(&Sines[index], sine);
+                                   Simd::Store(&Cosines[index], cosine);
+                               });
+            DoNotOptimize(Sines.data());
+            DoNotOptimize(Cosines.data());
+        }
+    }
+
+    SSSBENCHMARK(ExpStdLoop, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(size v = 0; v < ValueCount; ++v)
+            {
+                Sines[v] = std::exp(Angles[v] * 0.1f);
+            }
+            DoNotOptimize(Sines.data());
+        }
+    }
+
+    SSSBENCHMARK(ExpFastSimd, 100)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Simd::ForEachLanes(ValueCount,
+                               [&]<typename Register>(size index)
+                               {
+                                   const Register x = Simd::Load<Register>(&Angles[index]);
+                                   Simd::Store(&Sines[index], Simd::FastExp(Simd::Mul(x, Simd::Set1<Register>(0.1f))));
+                               });
+            DoNotOptimize(Sines.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,191 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cmath>
+#include <numbers>
+#include "Test.h"
+#include "Transcendental.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSTest
+{
+    namespace
+    {
+        constexpr size Samples = 100'000;
+
+        // NOTE: Checks every lane of the SIMD function and the scalar function against the double precision result
+        template<typename Register, typename Vectorized, typename Scalar, typename Reference, typename Input>
+        f64 MaximumError(Vectorized &&vectorized, Scalar &&scalar, Reference &&reference, Input &&input, bool relative)
+        {
+            constexpr size Lanes = sizeof(Register) / sizeof(f32);
+
+            f64 maximum = 0;
+            auto accumulate = [&](f32 value, f64 expected)
+            {
+                const f64 error = std::abs(static_cast<f64>(value) - expected);
+                maximum = std::fmax(maximum, relative ? error / std::abs(expected) : error);
+            };
+
+            for(size i = 0; i < Samples; i += Lanes)
+            {
+                alignas(32) f32 x[Lanes];
+                alignas(32) f32 y[Lanes];
+                alignas(32) f32 result[Lanes];
+                for(size lane = 0; lane < Lanes; ++lane)
+                {
+                    input(i + lane, x[lane], y[lane]);
+                }
+
+                Simd::Store(result, vectorized(Simd::Load<Register>(x), Simd::Load<Register>(y)));
+                for(size lane = 0; lane < Lanes; ++lane)
+                {
+                    const f64 expected = reference(static_cast<f64>(x[lane]), static_cast<f64>(y[lane]));
+                    accumulate(result[lane], expected);
+                    accumulate(scalar(x[lane], y[lane]), expected);
+                }
+            }
+
+            return maximum;
+        }
+
+        f32 Spread(size index, f32 minimum, f32 maximum)
+        {
+            return minimum + (maximum - minimum) * static_cast<f32>(index) / static_cast<f32>(Samples);
+        }
+
+        template<typename Register>
+        void ExpectErrorBounds()
+        {
+            auto angles = [](size i, f32 &x, f32 &y)
+            {
+                x = Spread(i, -8192, 8192);
+                y = 0;
+            };
+
+            const f64 sinError = MaximumError<Register>([](Register x, Register) { return Simd::FastSin(x); },
+                                                        [](f32 x, f32) { return FastSin(x); },
+                                                        [](f64 x, f64) { return std::sin(x); },
+                                                        angles,
+                                                        false);
+            SSSTEST_EXPECT_EQ(sinError < 2e-7, true);
+
+            const f64 cosError = MaximumError<Register>([](Register x, Register) { return Simd::FastCos(x); },
+                                                        [](f32 x, f32) { return FastCos(x); },
+                                                        [](f64 x, f64) { return std::cos(x); },
+                                                        angles,
+                                                        false);
+            SSSTEST_EXPECT_EQ(cosError < 2e-7, true);
+
+            const f64 atan2Error = MaximumError<Register>(
+                [](Register x, Register y) { return Simd::FastAtan2(y, x); },
+                [](f32 x, f32 y) { return FastAtan2(y, x); },
+                [](f64 x, f64 y) { return std::atan2(y, x); },
+                [](size i, f32 &x, f32 &y)
+                {
+                    const auto value = static_cast<f32>(i);
+                    x = std::cos(value * 0.37f) * (1 + static_cast<f32>(i % 100));
+                    y = std::sin(value * 0.11f) * (1 + static_cast<f32>(i % 37));
+                },
+                false);
+            SSSTEST_EXPECT_EQ(atan2Error < 5e-7, true);
+
+            const f64 expError = MaximumError<Register>([](Register x, Register) { return Simd::FastExp(x); },
+                                                        [](f32 x, f32) { return FastExp(x); },
+                                                        [](f64 x, f64) { return std::exp(x); },
+                                                        [](size i, f32 &x, f32 &y)
+                                                        {
+                                                            x = Spread(i, -87, 88);
+                                                            y = 0;
+                                                        },
+                                                        true);
+            SSSTEST_EXPECT_EQ(expError < 3e-7, true);
+
+            const f64 rsqrtError = MaximumError<Register>([](Register x, Register) { return Simd::FastRSqrt(x); },
+                                                          [](f32 x, f32) { return FastRSqrt(x); },
+                                                          [](f64 x, f64) { return 1 / std::sqrt(x); },
+                                                          [](size i, f32 &x, f32 &y)
+                                                          {
+                                                              x = std::exp2(Spread(i, -100, 100));
+                                                              y = 0;
+                                                          },
+                                                          true);
+            SSSTEST_EXPECT_EQ(rsqrtError < 5e-7, true);
+
+            const f64 logError = MaximumError<Register>([](Register x, Register) { return Simd::FastLog(x); },
+                                                        [](f32 x, f32) { return FastLog(x); },
+                                                        [](f64 x, f64) { return std::log(x); },
+                                                        [](size i, f32 &x, f32 &y)
+                                                        {
+                                                            x = std::exp2(Spread(i, -4, 4));
+                                                            y = 0;
+                                                        },
+                                                        false);
+            SSSTEST_EXPECT_EQ(logError < 2e-7, true);
+
+            const f64 wideLogError = MaximumError<Register>([](Register x, Register) { return Simd::FastLog(x); },
+                                                            [](f32 x, f32) { return FastLog(x); },
+                                                            [](f64 x, f64) { return std::log(x); },
+                                                            [](size i, f32 &x, f32 &y)
+                                                            {
+                                                                x = std::exp2(Spread(i, -120, 120));
+                                                                y = 0;
+                                                            },
+                                                            true);
+            SSSTEST_EXPECT_EQ(wideLogError < 3e-7, true);
+
+            const f64 powError = MaximumError<Register>([](Register x, Register y) { return Simd::FastPow(x, y); },
+                                                        [](f32 x, f32 y) { return FastPow(x, y); },
+                                                        [](f64 x, f64 y) { return std::pow(x, y); },
+                                                        [](size i, f32 &x, f32 &y)
+                                                        {
+                                                            x = Spread(i, 1e-3f, 4);
+                                                            y = 0.25f + static_cast<f32>(i % 16) * 0.125f;
+                                                        },
+                                                        true);
+            SSSTEST_EXPECT_EQ(powError < 2e-6, true);
+        }
+    } // namespace
+
+    SSSTEST_TEST(TranscendentalErrorBounds)
+    {
+        ExpectErrorBounds<Vector128>();
+#ifdef SSSENGINE_SIMD_AVX
+        ExpectErrorBounds<Vector256>();
+#endif
+    }
+
+    SSSTEST_TEST(TranscendentalSpecialValues)
+    {
+        constexpr f32 Pi = std::numbers::pi_v<f32>;
+
+        SSSTEST_EXPECT_EQ(FastSin(0), 0.0f);
+        SSSTEST_EXPECT_EQ(FastCos(0), 1.0f);
+        SSSTEST_EXPECT_EQ(FastAtan2(0, 0), 0.0f);
+        SSSTEST_EXPECT_EQ(std::abs(FastAtan2(1, 0) - Pi / 2) < 1e-6f, true);
+        SSSTEST_EXPECT_EQ(std::abs(FastAtan2(0, -1) - Pi) < 1e-6f, true);
+        SSSTEST_EXPECT_EQ(std::abs(FastAtan2(-0.0f, -1) + Pi) < 1e-6f, true);
+        SSSTEST_EXPECT_EQ(FastExp(0), 1.0f);
+        // NOTE: Clamped to the largest input instead of overflowing
+        SSSTEST_EXPECT_EQ(std::isfinite(FastExp(1000)), true);
+        SSSTEST_EXPECT_EQ(std::abs(FastRSqrt(4) - 0.5f) < 1e-6f, true);
+        SSSTEST_EXPECT_EQ(FastLog(1), 0.0f);
+        SSSTEST_EXPECT_EQ(std::abs(FastPow(2, 10) - 1024) < 1e-3f, true);
+    }
+} // namespace SSSTest
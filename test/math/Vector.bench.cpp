@@ -0,0 +1,81 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "Vector.h"
+
+using namespace SSSEngine::Math;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size PointCount = 100'000;
+
+        std::vector<Float3> Points = []
+        {
+            std::vector<Float3> points(PointCount);
+            for(size i = 0; i < PointCount; ++i)
+            {
+                const auto value = static_cast<f32>(i);
+                points[i] = {value * 0.5f + 1, value * 0.25f - 3, 7 - value};
+            }
+
+            return points;
+        }();
+
+        std::vector<Float3A> AlignedPoints = []
+        {
+            std::vector<Float3A> points(PointCount);
+            for(size i = 0; i < PointCount; ++i)
+            {
+                points[i] = ToFloat3A(Points[i]);
+            }
+
+            return points;
+        }();
+    } // namespace
+
+    SSSBENCHMARK(Float3NormalizeCross, 100)
+    {
+        const Float3 up{0, 1, 0};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(Float3 &point: Points)
+            {
+                point = Normalize(Cross(point, up) + point);
+            }
+            DoNotOptimize(Points.data());
+        }
+    }
+
+    SSSBENCHMARK(Float3ANormalizeCross, 100)
+    {
+        const Float3A up{0, 1, 0};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(Float3A &point: AlignedPoints)
+            {
+                point = Normalize(Cross(point, up) + point);
+            }
+            DoNotOptimize(AlignedPoints.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -17,6 +17,7 @@
     USA
 */
 
+#include <cmath>
 #include "Test.h"
 #include "Vector.h"
 
@@ -179,4 +180,62 @@ namespace SSSTest
             SSSTEST_EXPECT_EQ(v1 * scalar, expected);
         }
     }
+
+    SSSTEST_TEST(VectorFloat4)
+    {
+        // NOTE: Constant evaluation takes the scalar path
+        static_assert(Float4{1, 2, 3, 4} + Float4{1, 1, 1, 1} == Float4{2, 3, 4, 5});
+        static_assert(Dot(Float4{1, 2, 3, 4}, Float4{1, 1, 1, 1}) == 10);
+
+        Float4 v1{1, 2, 4, 5};
+        Float4 v2{4, 5, 4, 4};
+
+        SSSTEST_EXPECT_EQ(v1 + v2, (Float4{5, 7, 8, 9}));
+        SSSTEST_EXPECT_EQ(v2 - v1, (Float4{3, 3, 0, -1}));
+        SSSTEST_EXPECT_EQ(v1 * v2, (Float4{4, 10, 16, 20}));
+        SSSTEST_EXPECT_EQ(v1 * 2.0f, (Float4{2, 4, 8, 10}));
+        SSSTEST_EXPECT_EQ(2.0f * v1, (Float4{2, 4, 8, 10}));
+        SSSTEST_EXPECT_EQ(v1 / 2.0f, (Float4{0.5f, 1, 2, 2.5f}));
+        SSSTEST_EXPECT_NEQ(v1, (Float4{1, 2, 4, 6}));
+
+        SSSTEST_EXPECT_EQ(Dot(v1, v2), 50.0f);
+        SSSTEST_EXPECT_EQ(Length(Float4{2, 4, 4, 0}), 6.0f);
+        SSSTEST_EXPECT_EQ(Normalize(Float4{0, 3, 0, 4}), (Float4{0, 0.6f, 0, 0.8f}));
+    }
+
+    SSSTEST_TEST(VectorFloat3A)
+    {
+        static_assert(Cross(Float3A{1, 0, 0}, Float3A{0, 1, 0}) == Float3A{0, 0, 1});
+
+        Float3A v1{1, 2, 4};
+        Float3A v2{4, 5, 4};
+
+        SSSTEST_EXPECT_EQ(v1 + v2, (Float3A{5, 7, 8}));
+        SSSTEST_EXPECT_EQ(v2 - v1, (Float3A{3, 3, 0}));
+        SSSTEST_EXPECT_EQ(v1 * v2, (Float3A{4, 10, 16}));
+        SSSTEST_EXPECT_EQ(v1 / v2, (Float3A{0.25f, 0.4f, 1}));
+        SSSTEST_EXPECT_EQ(v1 * 2.0f, (Float3A{2, 4, 8}));
+        // NOTE: The padding is kept at 0 even when dividing 0 by 0
+        SSSTEST_EXPECT_EQ((v1 / v2).Padding, 0.0f);
+        SSSTEST_EXPECT_EQ((v1 / 0.0f).Padding, 0.0f);
+        // NOTE: The padding is ignored by the comparison
+        SSSTEST_EXPECT_EQ(v1, (Float3A{1, 2, 4, 7}));
+
+        SSSTEST_EXPECT_EQ(Dot(v1, v2), 30.0f);
+        SSSTEST_EXPECT_EQ(Cross(v1, v2), ToFloat3A(Cross(ToFloat3(v1), ToFloat3(v2))));
+        SSSTEST_EXPECT_EQ(Length(Float3A{2, 4, 4}), 6.0f);
+        SSSTEST_EXPECT_EQ(Normalize(Float3A{0, 3, 4}), (Float3A{0, 0.6f, 0.8f}));
+    }
+
+    SSSTEST_TEST(VectorDotCross)
+    {
+        SSSTEST_EXPECT_EQ(Dot(Int2{1, 2}, Int2{3, 4}), 11);
+        SSSTEST_EXPECT_EQ(Dot(Int3{1, 2, 3}, Int3{3, 4, 5}), 26);
+        SSSTEST_EXPECT_EQ(Dot(Int4{1, 2, 3, 4}, Int4{3, 4, 5, 6}), 50);
+        SSSTEST_EXPECT_EQ(Cross(Int3{1, 0, 0}, Int3{0, 1, 0}), (Int3{0, 0, 1}));
+        SSSTEST_EXPECT_EQ(Cross(Float3{1, 2, 3}, Float3{4, 5, 6}), (Float3{-3, 6, -3}));
+        SSSTEST_EXPECT_EQ(Length(Float2{3, 4}), 5.0f);
+        SSSTEST_EXPECT_EQ(Normalize(Float3{0, 0, 2}), (Float3{0, 0, 1}));
+        SSSTEST_EXPECT_EQ(std::abs(Length(Normalize(Float3{1, 2, 3})) - 1) < 1e-6f, true);
+    }
 } // namespace SSSTest
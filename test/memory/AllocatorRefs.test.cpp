@@ -0,0 +1,62 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include "Test.h"
+#include "AllocatorRefs.h"
+#include "Array.h"
+#include "Heap.h"
+#include "ScratchScope.h"
+
+using namespace SSSEngine;
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(ArrayFromArena)
+    {
+        Arena arena{1_MiB};
+        {
+            Array<u64, ArenaRef> values{ArenaRef{&arena}};
+            for(u64 i = 0; i < 1000; ++i)
+            {
+                values.PushBack(i);
+            }
+            SSSTEST_EXPECT_EQ(arena.Owns(values.GetData()), true);
+            SSSTEST_EXPECT_EQ(values[999], 999);
+        }
+        SSSTEST_EXPECT_GE(arena.GetUsed(), 1000 * sizeof(u64));
+
+        ScratchScope scratch;
+        SmallArray<u32, 4, ArenaRef> small{ArenaRef{&GetThreadScratch()}};
+        small.ResizeUninitialized(100);
+        SSSTEST_EXPECT_EQ(GetThreadScratch().Owns(small.GetData()), true);
+    }
+
+    SSSTEST_TEST(ArrayFromHeap)
+    {
+        Heap heap{1_MiB};
+        {
+            Array<u32, AllocatorRef> values{AllocatorRef{&heap}};
+            values.Resize(10'000);
+            SSSTEST_EXPECT_EQ(values[9'999], 0);
+            SSSTEST_EXPECT_GT(heap.GetAllocatedBytes(), 0);
+        }
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+    }
+} // namespace SSSTest
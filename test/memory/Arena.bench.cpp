@@ -0,0 +1,71 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <utility>
+#include "Benchmark.h"
+#include "Arena.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size AllocationCount = 10'000;
+
+        struct Node
+        {
+            Node *Next;
+            u64 Value;
+        };
+    } // namespace
+
+    SSSBENCHMARK(ArenaNew, 1000)
+    {
+        Arena arena{64_MiB};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Node *head = nullptr;
+            for(size j = 0; j < AllocationCount; ++j)
+            {
+                head = arena.New<Node>(head, j);
+            }
+            DoNotOptimize(head);
+            arena.Reset();
+        }
+    }
+
+    SSSBENCHMARK(HeapNew, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Node *head = nullptr;
+            for(size j = 0; j < AllocationCount; ++j)
+            {
+                head = new Node{head, j};
+            }
+            DoNotOptimize(head);
+
+            while(head != nullptr)
+            {
+                delete std::exchange(head, head->Next);
+            }
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,97 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <limits>
+#include "Test.h"
+#include "Arena.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(ArenaPush)
+    {
+        Arena arena{16_MiB};
+        SSSTEST_EXPECT_EQ(arena.GetUsed(), 0);
+        SSSTEST_EXPECT_EQ(arena.GetCommitted(), 0);
+
+        auto *const first = static_cast<byte *>(arena.Push(3, 1));
+        auto *const second = static_cast<byte *>(arena.Push(8, 64));
+        SSSTEST_EXPECT_NEQ(first, nullptr);
+        SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(second) % 64, 0);
+        SSSTEST_EXPECT_GE(second, first + 3);
+        SSSTEST_EXPECT_EQ(arena.Owns(second), true);
+        SSSTEST_EXPECT_EQ(arena.Owns(&arena), false);
+
+        // NOTE: Crossing many commit steps must keep the earlier pointers valid
+        auto *const big = arena.PushArray<u32>(1_MiB);
+        SSSTEST_EXPECT_NEQ(big, nullptr);
+        big[1_MiB - 1] = 7;
+        first[0] = 1;
+        SSSTEST_EXPECT_EQ(big[1_MiB - 1], 7);
+        SSSTEST_EXPECT_GE(arena.GetCommitted(), arena.GetUsed());
+
+        // NOTE: Past the reservation
+        SSSTEST_EXPECT_EQ(arena.Push(32_MiB), nullptr);
+
+        // NOTE: Big enough for the end to wrap around
+        const size used = arena.GetUsed();
+        SSSTEST_EXPECT_EQ(arena.Push(std::numeric_limits<size>::max() - 8), nullptr);
+        SSSTEST_EXPECT_EQ(arena.GetUsed(), used);
+    }
+
+    SSSTEST_TEST(ArenaMarkers)
+    {
+        Arena arena{1_MiB};
+        const u64 *const kept = arena.New<u64>(42ull);
+
+        const ArenaMarker marker = arena.GetMarker();
+        void *const scratch = arena.Push(1000);
+        SSSTEST_EXPECT_NEQ(scratch, nullptr);
+        arena.PopTo(marker);
+        SSSTEST_EXPECT_EQ(arena.GetUsed(), marker.Offset);
+
+        // NOTE: Popped memory is handed out again
+        SSSTEST_EXPECT_EQ(arena.Push(1000), scratch);
+        SSSTEST_EXPECT_EQ(*kept, 42);
+
+        auto *const zeroed = static_cast<byte *>(arena.PushZeroed(16));
+        SSSTEST_EXPECT_EQ(zeroed[15], 0);
+
+        const size committed = arena.GetCommitted();
+        arena.Reset();
+        SSSTEST_EXPECT_EQ(arena.GetUsed(), 0);
+        SSSTEST_EXPECT_EQ(arena.GetCommitted(), committed);
+
+        arena.Trim();
+        SSSTEST_EXPECT_EQ(arena.GetCommitted(), 0);
+        SSSTEST_EXPECT_NEQ(arena.Push(16), nullptr);
+    }
+
+    SSSTEST_TEST(ArenaMove)
+    {
+        Arena arena{1_MiB};
+        auto *const value = arena.New<u32>(5u);
+
+        Arena moved{std::move(arena)};
+        SSSTEST_EXPECT_EQ(moved.Owns(value), true);
+        SSSTEST_EXPECT_EQ(arena.GetReserved(), 0);
+        SSSTEST_EXPECT_EQ(*value, 5);
+    }
+} // namespace SSSTest
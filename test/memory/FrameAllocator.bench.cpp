@@ -0,0 +1,64 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cstdlib>
+#include "Benchmark.h"
+#include "FrameAllocator.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size AllocationCount = 10'000;
+        constexpr size AllocationSize = 48;
+    } // namespace
+
+    SSSBENCHMARK(FrameAllocatorAllocate, 1000)
+    {
+        FrameAllocator allocator{8_MiB};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            allocator.BeginFrame(i);
+            for(size j = 0; j < AllocationCount; ++j)
+            {
+                DoNotOptimize(allocator.Allocate(AllocationSize, 16));
+            }
+            allocator.Retire(i);
+        }
+    }
+
+    SSSBENCHMARK(MallocPerFrame, 1000)
+    {
+        void *allocations[AllocationCount];
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(void *&allocation: allocations)
+            {
+                allocation = std::malloc(AllocationSize);
+                DoNotOptimize(allocation);
+            }
+            for(void *allocation: allocations)
+            {
+                std::free(allocation);
+            }
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,156 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "FrameAllocator.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(FrameAllocatorAllocate)
+    {
+        FrameAllocator allocator{1_MiB};
+        allocator.BeginFrame(0);
+
+        auto *const first = static_cast<byte *>(allocator.Allocate(10, 1));
+        auto *const second = static_cast<byte *>(allocator.Allocate(16, 32));
+        SSSTEST_EXPECT_NEQ(first, nullptr);
+        SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(second) % 32, 0);
+        SSSTEST_EXPECT_GE(second, first + 10);
+
+        // NOTE: Bigger than a chunk, taken straight from the region
+        auto *const big = allocator.AllocateArray<u64>(FrameAllocator::DefaultChunkSize);
+        SSSTEST_EXPECT_NEQ(big, nullptr);
+        big[FrameAllocator::DefaultChunkSize - 1] = 3;
+        SSSTEST_EXPECT_EQ(allocator.Allocate(2_MiB), nullptr);
+
+        const u32 *const value = allocator.New<u32>(9u);
+        SSSTEST_EXPECT_EQ(*value, 9);
+        allocator.Retire(0);
+
+        // NOTE: Every other region is used before the first one comes back
+        for(u64 frame = 1; frame <= FrameAllocator::FrameCount; ++frame)
+        {
+            allocator.BeginFrame(frame);
+            auto *const memory = static_cast<byte *>(allocator.Allocate(10, 1));
+            SSSTEST_EXPECT_EQ(memory == first, frame == FrameAllocator::FrameCount);
+            allocator.Retire(frame);
+        }
+    }
+
+    SSSTEST_TEST(FrameAllocatorBudget)
+    {
+        FrameAllocator allocator{256_KiB};
+        allocator.BeginFrame(0);
+
+        size allocated = 0;
+        while(allocator.Allocate(1000, 8) != nullptr)
+        {
+            allocated += 1000;
+        }
+        SSSTEST_EXPECT_LE(allocated, allocator.GetBytesPerFrame());
+        SSSTEST_EXPECT_GE(allocated, allocator.GetBytesPerFrame() - FrameAllocator::DefaultChunkSize);
+        allocator.Retire(0);
+
+        allocator.BeginFrame(1);
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), 0);
+        SSSTEST_EXPECT_NEQ(allocator.Allocate(1000, 8), nullptr);
+        allocator.Retire(1);
+    }
+
+    SSSTEST_TEST(FrameAllocatorAfterRetire)
+    {
+        FrameAllocator allocator{1_MiB};
+        allocator.BeginFrame(0);
+        SSSTEST_EXPECT_NEQ(allocator.Allocate(16), nullptr);
+        allocator.Retire(0);
+
+        // NOTE: The thread still has room in its chunk, but the region may already be reused by the GPU
+        SSSTEST_EXPECT_EQ(allocator.Allocate(16), nullptr);
+        SSSTEST_EXPECT_EQ(allocator.Allocate(FrameAllocator::DefaultChunkSize), nullptr);
+
+        allocator.BeginFrame(1);
+        SSSTEST_EXPECT_NEQ(allocator.Allocate(16), nullptr);
+        allocator.Retire(1);
+    }
+
+    SSSTEST_TEST(FrameAllocatorInterleaved)
+    {
+        FrameAllocator first{1_MiB};
+        FrameAllocator second{1_MiB};
+        first.BeginFrame(0);
+        second.BeginFrame(0);
+
+        // NOTE: Switching between allocators on a thread keeps bumping in the chunk each one already has
+        for(u32 i = 0; i < 1000; ++i)
+        {
+            SSSTEST_EXPECT_NEQ(first.Allocate(16), nullptr);
+            SSSTEST_EXPECT_NEQ(second.Allocate(16), nullptr);
+        }
+        SSSTEST_EXPECT_EQ(first.GetUsed(), FrameAllocator::DefaultChunkSize);
+        SSSTEST_EXPECT_EQ(second.GetUsed(), FrameAllocator::DefaultChunkSize);
+
+        first.Retire(0);
+        second.Retire(0);
+    }
+
+    SSSTEST_TEST(FrameAllocatorThreads)
+    {
+        constexpr size ThreadCount = 4;
+        constexpr size AllocationCount = 2000;
+
+        FrameAllocator allocator{16_MiB};
+        allocator.BeginFrame(0);
+
+        std::vector<std::vector<u64 *>> allocations(ThreadCount);
+        {
+            std::vector<std::jthread> threads;
+            for(size i = 0; i < ThreadCount; ++i)
+            {
+                threads.emplace_back(
+                    [&allocator, &result = allocations[i], i]
+                    {
+                        for(size j = 0; j < AllocationCount; ++j)
+                        {
+                            u64 *const value = allocator.New<u64>(i * AllocationCount + j);
+                            result.push_back(value);
+                        }
+                    });
+            }
+        }
+
+        // NOTE: No allocation overlaps another and none was overwritten by another thread
+        std::vector<u64 *> all;
+        for(size i = 0; i < ThreadCount; ++i)
+        {
+            for(size j = 0; j < AllocationCount; ++j)
+            {
+                SSSTEST_EXPECT_EQ(*allocations[i][j], i * AllocationCount + j);
+                all.push_back(allocations[i][j]);
+            }
+        }
+        std::ranges::sort(all);
+        SSSTEST_EXPECT_EQ(std::ranges::adjacent_find(all) == all.end(), true);
+        allocator.Retire(0);
+    }
+} // namespace SSSTest
@@ -0,0 +1,132 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Heap.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size AllocationCount = 10'000;
+
+        // NOTE: Mostly small sizes with a tail of bigger ones, freed in a shuffled order
+        const std::vector<size> Sizes = []
+        {
+            std::mt19937 random{3};
+            std::vector<size> sizes(AllocationCount);
+            for(size &bytes: sizes)
+            {
+                bytes = random() % 8 == 0 ? 256 + random() % 16'000 : 8 + random() % 120;
+            }
+
+            return sizes;
+        }();
+
+        const std::vector<size> FreeOrder = []
+        {
+            std::vector<size> order(AllocationCount);
+            for(size i = 0; i < AllocationCount; ++i)
+            {
+                order[i] = (i * 7'919) % AllocationCount;
+            }
+
+            return order;
+        }();
+
+        /**
+         * @brief Short lived small objects, the case the thread cache is for
+         */
+        template<typename Allocate, typename Free>
+        void SmallChurn(u64 iterations, Allocate &&allocate, Free &&free)
+        {
+            void *allocations[64];
+            for(u64 i = 0; i < iterations; ++i)
+            {
+                for(size j = 0; j < std::size(allocations); ++j)
+                {
+                    allocations[j] = allocate(16 + j * 3);
+                }
+                DoNotOptimize(allocations);
+                for(void *memory: allocations)
+                {
+                    free(memory);
+                }
+            }
+        }
+
+        template<typename Allocate, typename Free>
+        void Churn(u64 iterations, Allocate &&allocate, Free &&free)
+        {
+            std::vector<void *> allocations(AllocationCount);
+            for(u64 i = 0; i < iterations; ++i)
+            {
+                for(size j = 0; j < AllocationCount; ++j)
+                {
+                    allocations[j] = allocate(Sizes[j]);
+                }
+                DoNotOptimize(allocations.data());
+                for(const size j: FreeOrder)
+                {
+                    free(allocations[j]);
+                }
+            }
+        }
+    } // namespace
+
+    SSSBENCHMARK(HeapChurn, 200)
+    {
+        Heap heap;
+        Churn(
+            iterations, [&heap](size bytes) { return heap.Allocate(bytes); },
+            [&heap](void *memory) { heap.Free(memory); });
+    }
+
+    SSSBENCHMARK(MallocChurn, 200)
+    {
+        Churn(iterations, [](size bytes) { return std::malloc(bytes); }, [](void *memory) { std::free(memory); });
+    }
+
+    SSSBENCHMARK(HeapSmallChurn, 100'000)
+    {
+        Heap heap;
+        SmallChurn(
+            iterations, [&heap](size bytes) { return heap.Allocate(bytes); },
+            [&heap](void *memory) { heap.Free(memory); });
+    }
+
+    SSSBENCHMARK(HeapThreadCacheSmallChurn, 100'000)
+    {
+        Heap heap{Heap::DefaultPoolSize, MemoryTag::General, true};
+        SmallChurn(
+            iterations, [&heap](size bytes) { return heap.Allocate(bytes); },
+            [&heap](void *memory) { heap.Free(memory); });
+    }
+
+    SSSBENCHMARK(MallocSmallChurn, 100'000)
+    {
+        SmallChurn(iterations, [](size bytes) { return std::malloc(bytes); }, [](void *memory) { std::free(memory); });
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,192 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "Heap.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(HeapAllocate)
+    {
+        Heap heap{1_MiB};
+        SSSTEST_EXPECT_EQ(heap.GetPoolBytes(), 0);
+
+        void *const small = heap.Allocate(1);
+        void *const medium = heap.Allocate(1000);
+        SSSTEST_EXPECT_NEQ(small, nullptr);
+        SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(medium) % Heap::MinimumAlignment, 0);
+        SSSTEST_EXPECT_GE(Heap::GetUsableSize(medium), 1000);
+        std::memset(medium, 0xFF, 1000);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+
+        heap.Free(small);
+        heap.Deallocate(medium, 1000);
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+
+        // NOTE: Everything was merged back so the whole pool is available again
+        void *const whole = heap.Allocate(heap.GetPoolBytes() / 2);
+        SSSTEST_EXPECT_NEQ(whole, nullptr);
+        SSSTEST_EXPECT_EQ(heap.GetPoolBytes(), 1_MiB);
+        heap.Free(whole);
+
+        // NOTE: Bigger than a pool, a dedicated one is added
+        void *const big = heap.Allocate(3_MiB);
+        SSSTEST_EXPECT_NEQ(big, nullptr);
+        SSSTEST_EXPECT_GT(heap.GetPoolBytes(), 4_MiB);
+        heap.Free(big);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+    }
+
+    SSSTEST_TEST(HeapPoolForLargeRequest)
+    {
+        // NOTE: Sizes that a pool fits exactly but whose search rounds up to the next list
+        Heap small{64_KiB};
+        void *const first = small.Allocate(102'048);
+        SSSTEST_EXPECT_NEQ(first, nullptr);
+        SSSTEST_EXPECT_GE(Heap::GetUsableSize(first), 102'048);
+        small.Free(first);
+        SSSTEST_EXPECT_EQ(small.CheckIntegrity(), true);
+
+        Heap heap{};
+        void *const second = heap.Allocate(73_MiB);
+        SSSTEST_EXPECT_NEQ(second, nullptr);
+        SSSTEST_EXPECT_GE(Heap::GetUsableSize(second), 73_MiB);
+        heap.Free(second);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+    }
+
+    SSSTEST_TEST(HeapAlignment)
+    {
+        Heap heap{1_MiB};
+        std::vector<void *> allocations;
+        for(const size alignment: {size{32}, size{64}, size{256}, size{4096}})
+        {
+            for(const size bytes: {size{1}, size{48}, size{5000}})
+            {
+                void *memory = heap.Allocate(bytes, alignment);
+                SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(memory) % alignment, 0);
+                std::memset(memory, 1, bytes);
+                allocations.push_back(memory);
+            }
+        }
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+
+        for(void *memory: allocations)
+        {
+            heap.Free(memory);
+        }
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+    }
+
+    SSSTEST_TEST(HeapRandom)
+    {
+        Heap heap{256_KiB};
+        std::mt19937 random{7};
+        std::vector<std::pair<u8 *, size>> live;
+
+        for(u32 i = 0; i < 20'000; ++i)
+        {
+            if(live.empty() || random() % 3 != 0)
+            {
+                const size bytes = random() % 2 == 0 ? random() % 128 : random() % 20'000;
+                auto *const memory = static_cast<u8 *>(heap.Allocate(bytes, size{16} << (random() % 3)));
+                std::memset(memory, static_cast<u8>(bytes), bytes);
+                live.emplace_back(memory, bytes);
+            }
+            else
+            {
+                const size index = random() % live.size();
+                const auto [memory, bytes] = live[index];
+                SSSTEST_EXPECT_EQ(bytes == 0 || memory[bytes - 1] == static_cast<u8>(bytes), true);
+                heap.Free(memory);
+                live[index] = live.back();
+                live.pop_back();
+            }
+
+            if(i % 1000 == 0)
+            {
+                SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+            }
+        }
+
+        for(const auto &[memory, bytes]: live)
+        {
+            heap.Free(memory);
+        }
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+    }
+
+    SSSTEST_TEST(HeapThreadCache)
+    {
+        constexpr u32 ThreadCount = 4;
+
+        Heap heap{1_MiB, MemoryTag::General, true};
+        {
+            std::vector<std::jthread> threads;
+            for(u32 t = 0; t < ThreadCount; ++t)
+            {
+                threads.emplace_back(
+                    [&heap]
+                    {
+                        std::vector<void *> allocations;
+                        for(u32 i = 0; i < 10'000; ++i)
+                        {
+                            allocations.push_back(heap.Allocate(16 + i % 300));
+                            if(allocations.size() == 100)
+                            {
+                                for(void *memory: allocations)
+                                {
+                                    heap.Free(memory);
+                                }
+                                allocations.clear();
+                            }
+                        }
+                    });
+            }
+        }
+
+        // NOTE: The exiting threads gave their cached blocks back
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+        SSSTEST_EXPECT_EQ(heap.CheckIntegrity(), true);
+    }
+
+    SSSTEST_TEST(HeapStdAllocator)
+    {
+        Heap heap{1_MiB};
+        {
+            std::vector<u64, StdAllocator<u64>> values{StdAllocator<u64>{heap}};
+            for(u64 i = 0; i < 10'000; ++i)
+            {
+                values.push_back(i);
+            }
+            SSSTEST_EXPECT_EQ(values[9'999], 9'999);
+            SSSTEST_EXPECT_GT(heap.GetAllocatedBytes(), 10'000 * sizeof(u64));
+        }
+        SSSTEST_EXPECT_EQ(heap.GetAllocatedBytes(), 0);
+    }
+} // namespace SSSTest
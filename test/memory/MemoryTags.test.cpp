@@ -0,0 +1,90 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <string_view>
+#include "Test.h"
+#include "Arena.h"
+#include "Heap.h"
+#include "MemoryTags.h"
+#include "Pool.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+#ifdef SSSENGINE_MEMORY_TRACKING
+    SSSTEST_TEST(MemoryTagsCounters)
+    {
+        // NOTE: Gameplay is not used by the other tests so the counters start from a known state
+        constexpr MemoryTag Tag = MemoryTag::Gameplay;
+        UpdateMemoryTags();
+        const MemoryTagStats before = GetMemoryTagStats(Tag);
+
+        {
+            Heap heap{1_MiB, Tag};
+            void *const memory = heap.Allocate(1000);
+            SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).LiveBytes, before.LiveBytes + Heap::GetUsableSize(memory));
+
+            Pool<u64> pool{16, Tag};
+            const Handle<u64> handle = pool.Create(1ull);
+            SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).AllocationCount, before.AllocationCount + 2);
+
+            pool.Destroy(handle);
+            heap.Free(memory);
+            SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).LiveBytes, before.LiveBytes);
+            SSSTEST_EXPECT_GE(GetMemoryTagStats(Tag).PeakBytes, before.LiveBytes + 1000 + sizeof(u64));
+
+            // NOTE: Arenas report what they commit
+            Arena arena{1_MiB, Tag};
+            SSSTEST_EXPECT_NEQ(arena.Push(10), nullptr);
+            SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).LiveBytes, before.LiveBytes + arena.GetCommitted());
+        }
+        SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).LiveBytes, before.LiveBytes);
+
+        UpdateMemoryTags();
+        SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).FrameAllocationCount, 3);
+        UpdateMemoryTags();
+        SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).FrameAllocationCount, 0);
+    }
+
+    SSSTEST_TEST(MemoryTagsBudget)
+    {
+        constexpr MemoryTag Tag = MemoryTag::Audio;
+        SetMemoryBudget(Tag, 64_KiB);
+        SSSTEST_EXPECT_EQ(GetMemoryTagStats(Tag).Budget, 64_KiB);
+        SSSTEST_EXPECT_EQ(UpdateMemoryTags(), false);
+
+        {
+            Heap heap{1_MiB, Tag};
+            void *const memory = heap.Allocate(100_KiB);
+            SSSTEST_EXPECT_EQ(UpdateMemoryTags(), true);
+            heap.Free(memory);
+        }
+
+        SSSTEST_EXPECT_EQ(UpdateMemoryTags(), false);
+        SetMemoryBudget(Tag, 0);
+    }
+#endif
+
+    SSSTEST_TEST(MemoryTagsNames)
+    {
+        SSSTEST_EXPECT_EQ(std::wstring_view{GetMemoryTagName(MemoryTag::Renderer)}, L"Renderer");
+        SSSTEST_EXPECT_EQ(std::wstring_view{GetMemoryTagName(MemoryTag::Transient)}, L"Transient");
+    }
+} // namespace SSSTest
@@ -0,0 +1,73 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <memory>
+#include "Benchmark.h"
+#include "Pool.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 ObjectCount = 10'000;
+
+        struct Object
+        {
+            f32 Transform[16];
+            u64 Id;
+        };
+    } // namespace
+
+    SSSBENCHMARK(PoolCreateDestroy, 1000)
+    {
+        Pool<Object> pool{ObjectCount};
+        Handle<Object> handles[ObjectCount];
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(u32 j = 0; j < ObjectCount; ++j)
+            {
+                handles[j] = pool.Create();
+            }
+            DoNotOptimize(handles);
+            for(const Handle<Object> handle: handles)
+            {
+                pool.Destroy(handle);
+            }
+        }
+    }
+
+    SSSBENCHMARK(HeapCreateDestroy, 1000)
+    {
+        std::unique_ptr<Object> objects[ObjectCount];
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(auto &object: objects)
+            {
+                object = std::make_unique<Object>();
+            }
+            DoNotOptimize(objects);
+            for(auto &object: objects)
+            {
+                object.reset();
+            }
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,182 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "Pool.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(PoolCreateDestroy)
+    {
+        Pool<std::string> pool{4};
+
+        const Handle<std::string> first = pool.Create("first");
+        const Handle<std::string> second = pool.Create(100, 'a');
+        SSSTEST_EXPECT_EQ(first.IsValid(), true);
+        SSSTEST_EXPECT_EQ(*pool.Get(first), "first");
+        SSSTEST_EXPECT_EQ(pool.Get(second)->size(), 100);
+        SSSTEST_EXPECT_EQ(pool.IsAlive(Handle<std::string>{}), false);
+
+        pool.Destroy(first);
+        SSSTEST_EXPECT_EQ(pool.IsAlive(first), false);
+        SSSTEST_EXPECT_EQ(pool.TryGet(first), nullptr);
+
+        // NOTE: The freed slot is reused but the old handle stays stale
+        const Handle<std::string> reused = pool.Create("reused");
+        SSSTEST_EXPECT_EQ(reused.Index, first.Index);
+        SSSTEST_EXPECT_NEQ(reused.Generation, first.Generation);
+        SSSTEST_EXPECT_EQ(pool.TryGet(first), nullptr);
+        SSSTEST_EXPECT_EQ(*pool.TryGet(reused), "reused");
+
+        SSSTEST_EXPECT_EQ(pool.Create().IsValid(), true);
+        SSSTEST_EXPECT_EQ(pool.Create().IsValid(), true);
+        SSSTEST_EXPECT_EQ(pool.Create().IsValid(), false);
+    }
+
+    SSSTEST_TEST(PoolFullKeepsLiveSlots)
+    {
+        Pool<u32> pool{8};
+        std::vector<Handle<u32>> handles;
+        for(u32 i = 0; i < pool.GetCapacity(); ++i)
+        {
+            handles.push_back(pool.Create(i));
+        }
+
+        // NOTE: Failed creates must not claim slots, otherwise a later create hands out a live one
+        for(u32 i = 0; i < 100'000; ++i)
+        {
+            SSSTEST_EXPECT_EQ(pool.Create(i).IsValid(), false);
+        }
+
+        pool.Destroy(handles[3]);
+        const Handle<u32> reused = pool.Create(42u);
+        SSSTEST_EXPECT_EQ(reused.Index, handles[3].Index);
+        SSSTEST_EXPECT_EQ(pool.Create(0u).IsValid(), false);
+        for(u32 i = 0; i < pool.GetCapacity(); ++i)
+        {
+            SSSTEST_EXPECT_EQ(*pool.Get(i == 3 ? reused : handles[i]), i == 3 ? 42u : i);
+        }
+    }
+
+    SSSTEST_TEST(PoolThrowingConstructor)
+    {
+        struct Throwing
+        {
+            explicit Throwing(bool fail)
+            {
+                if(fail)
+                {
+                    throw std::runtime_error("Constructor failed");
+                }
+            }
+        };
+
+        Pool<Throwing> pool{2};
+        for(u32 i = 0; i < 10; ++i)
+        {
+            bool thrown = false;
+            try
+            {
+                (void)pool.Create(true);
+            }
+            catch(const std::runtime_error &)
+            {
+                thrown = true;
+            }
+            SSSTEST_EXPECT_EQ(thrown, true);
+        }
+
+        // NOTE: Every failed create gave its slot back
+        SSSTEST_EXPECT_EQ(pool.Create(false).IsValid(), true);
+        SSSTEST_EXPECT_EQ(pool.Create(false).IsValid(), true);
+        SSSTEST_EXPECT_EQ(pool.Create(false).IsValid(), false);
+    }
+
+    SSSTEST_TEST(PoolGrowsAcrossSlabs)
+    {
+        struct Big
+        {
+            u64 Values[100];
+        };
+
+        Pool<Big> pool{10'000};
+        std::vector<Handle<Big>> handles;
+        for(u32 i = 0; i < pool.GetCapacity(); ++i)
+        {
+            handles.push_back(pool.Create());
+            pool.Get(handles.back())->Values[99] = i;
+        }
+
+        for(u32 i = 0; i < pool.GetCapacity(); ++i)
+        {
+            SSSTEST_EXPECT_EQ(pool.Get(handles[i])->Values[99], i);
+        }
+    }
+
+    SSSTEST_TEST(PoolThreads)
+    {
+        constexpr u32 ThreadCount = 4;
+        constexpr u32 Iterations = 20'000;
+        constexpr u32 Live = 64;
+
+        Pool<u64> pool{ThreadCount * Live};
+        std::atomic<bool> failed{false};
+        {
+            std::vector<std::jthread> threads;
+            for(u32 t = 0; t < ThreadCount; ++t)
+            {
+                threads.emplace_back(
+                    [&pool, &failed, t]
+                    {
+                        // NOTE: Each thread keeps a window of live objects and checks nobody else wrote to them
+                        std::vector<Handle<u64>> handles;
+                        for(u32 i = 0; i < Iterations; ++i)
+                        {
+                            const u64 value = static_cast<u64>(t) << 32 | i;
+                            handles.push_back(pool.Create(value));
+                            if(!handles.back().IsValid())
+                            {
+                                failed = true;
+                                return;
+                            }
+
+                            if(handles.size() == Live)
+                            {
+                                for(u32 j = 0; j < Live; ++j)
+                                {
+                                    const u64 expected = static_cast<u64>(t) << 32 | (i - Live + 1 + j);
+                                    failed = failed || *pool.Get(handles[j]) != expected;
+                                    pool.Destroy(handles[j]);
+                                }
+                                handles.clear();
+                            }
+                        }
+                    });
+            }
+        }
+
+        SSSTEST_EXPECT_EQ(failed.load(), false);
+    }
+} // namespace SSSTest
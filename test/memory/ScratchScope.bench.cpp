@@ -0,0 +1,72 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <memory>
+#include "Benchmark.h"
+#include "ScratchScope.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size ElementCount = 16;
+
+        SSSENGINE_NO_INLINE u64 FillScratch(u64 seed)
+        {
+            ScratchScope scratch;
+            u64 *const values = scratch.Alloc<u64>(ElementCount);
+            for(size i = 0; i < ElementCount; ++i)
+            {
+                values[i] = seed + i;
+            }
+            // NOTE: Escapes the buffer so the allocation can't be optimized away
+            DoNotOptimize(values);
+            return values[seed % ElementCount];
+        }
+
+        SSSENGINE_NO_INLINE u64 FillHeap(u64 seed)
+        {
+            std::unique_ptr<u64[]> values{new u64[ElementCount]};
+            for(size i = 0; i < ElementCount; ++i)
+            {
+                values[i] = seed + i;
+            }
+            DoNotOptimize(values.get());
+            return values[seed % ElementCount];
+        }
+    } // namespace
+
+    SSSBENCHMARK(ScratchScopeTemporary, 1'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(FillScratch(i));
+        }
+    }
+
+    SSSBENCHMARK(HeapTemporary, 1'000'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(FillHeap(i));
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,98 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <thread>
+#include "Test.h"
+#include "ScratchScope.h"
+
+using namespace SSSEngine::Core::Memory;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(ScratchScopeRewinds)
+    {
+        const size base = GetThreadScratch().GetUsed();
+        {
+            ScratchScope scratch;
+            u32 *const values = scratch.Alloc<u32>(100);
+            SSSTEST_EXPECT_NEQ(values, nullptr);
+            SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(values) % alignof(u32), 0);
+            values[99] = 5;
+            SSSTEST_EXPECT_GE(scratch.GetUsed(), 100 * sizeof(u32));
+
+            void *inner = nullptr;
+            {
+                ScratchScope nested;
+                inner = nested.Push(64, 64);
+                SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(inner) % 64, 0);
+                SSSTEST_EXPECT_GE(scratch.GetUsed(), nested.GetUsed());
+            }
+
+            // NOTE: The nested scope is gone, its memory is handed out again while the outer allocation stays
+            const size outerUsed = scratch.GetUsed();
+            SSSTEST_EXPECT_EQ(GetThreadScratch().GetUsed(), base + outerUsed);
+            SSSTEST_EXPECT_EQ(values[99], 5);
+
+            const u64 *const object = scratch.New<u64>(9ull);
+            SSSTEST_EXPECT_EQ(*object, 9);
+        }
+        SSSTEST_EXPECT_EQ(GetThreadScratch().GetUsed(), base);
+
+        TrimThreadScratch();
+        SSSTEST_EXPECT_EQ(GetThreadScratch().GetCommitted(), 0);
+    }
+
+    SSSTEST_TEST(ScratchScopePerThread)
+    {
+        constexpr u32 ThreadCount = 4;
+        constexpr size Count = 10'000;
+
+        bool ok[ThreadCount]{};
+        std::thread threads[ThreadCount];
+        for(u32 t = 0; t < ThreadCount; ++t)
+        {
+            threads[t] = std::thread{[t, &ok]() {
+                ok[t] = true;
+                for(u32 round = 0; round < 100; ++round)
+                {
+                    ScratchScope scratch;
+                    u32 *const values = scratch.Alloc<u32>(Count);
+                    for(size i = 0; i < Count; ++i)
+                    {
+                        values[i] = t + round;
+                    }
+                    for(size i = 0; i < Count; ++i)
+                    {
+                        ok[t] = ok[t] && values[i] == t + round;
+                    }
+                }
+                ok[t] = ok[t] && GetThreadScratch().GetUsed() == 0;
+            }};
+        }
+        for(std::thread &thread: threads)
+        {
+            thread.join();
+        }
+
+        for(const bool threadOk: ok)
+        {
+            SSSTEST_EXPECT_EQ(threadOk, true);
+        }
+    }
+} // namespace SSSTest
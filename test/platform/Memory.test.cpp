@@ -0,0 +1,99 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <cstring>
+#include "Test.h"
+#include "Bits.h"
+#include "Memory.h"
+
+using namespace SSSEngine::Platform;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(MemoryReserveCommit)
+    {
+        const size pageSize = GetPageSize();
+        SSSTEST_EXPECT_EQ(SSSEngine::IsPowerOfTwo(pageSize), true);
+
+        constexpr size Reserved = 64_MiB;
+        auto *const base = static_cast<byte *>(ReserveAddressSpace(Reserved));
+        SSSTEST_EXPECT_NEQ(base, nullptr);
+        SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(base) % pageSize, 0);
+
+        // NOTE: Commit a page in the middle of the range so that a page that was never committed is also touched
+        byte *const page = base + pageSize * 3;
+        SSSTEST_EXPECT_EQ(Commit(page, pageSize), true);
+        SSSTEST_EXPECT_EQ(page[0], 0);
+        std::memset(page, 0xAB, pageSize);
+        SSSTEST_EXPECT_EQ(page[pageSize - 1], 0xAB);
+
+        SSSTEST_EXPECT_EQ(Decommit(page, pageSize), true);
+        SSSTEST_EXPECT_EQ(Commit(page, pageSize), true);
+        SSSTEST_EXPECT_EQ(page[0], 0);
+        SSSTEST_EXPECT_EQ(page[pageSize - 1], 0);
+
+        // NOTE: Sizes are rounded up to whole pages
+        SSSTEST_EXPECT_EQ(Commit(base, 1), true);
+        base[pageSize - 1] = 1;
+
+        SSSTEST_EXPECT_EQ(ReleaseAddressSpace(base, Reserved), true);
+    }
+
+    SSSTEST_TEST(MemoryTransparentHugePages)
+    {
+        constexpr size Reserved = HugePageSize * 3 + 1;
+        auto *const base = static_cast<byte *>(ReserveAddressSpace(Reserved, PageKind::TransparentHuge));
+        SSSTEST_EXPECT_NEQ(base, nullptr);
+
+        SSSTEST_EXPECT_EQ(Commit(base, HugePageSize * 2), true);
+        std::memset(base, 0xCD, HugePageSize * 2);
+        SSSTEST_EXPECT_EQ(base[HugePageSize * 2 - 1], 0xCD);
+
+        SSSTEST_EXPECT_EQ(Decommit(base, HugePageSize), true);
+        SSSTEST_EXPECT_EQ(ReleaseAddressSpace(base, Reserved, PageKind::TransparentHuge), true);
+    }
+
+    SSSTEST_TEST(MemoryHugePages)
+    {
+        // NOTE: Explicit huge pages need to be set up on the system, only check them when they are available
+        auto *const base = static_cast<byte *>(ReserveAddressSpace(HugePageSize, PageKind::Huge));
+        if(base == nullptr)
+        {
+            return;
+        }
+
+        SSSTEST_EXPECT_EQ(reinterpret_cast<uintptr>(base) % HugePageSize, 0);
+        base[0] = 1;
+        base[HugePageSize - 1] = 1;
+        SSSTEST_EXPECT_EQ(ReleaseAddressSpace(base, HugePageSize, PageKind::Huge), true);
+    }
+
+    SSSTEST_TEST(MemoryAllocate)
+    {
+        constexpr size Bytes = 1_MiB;
+        auto *const memory = static_cast<byte *>(AllocateMemory(Bytes));
+        SSSTEST_EXPECT_NEQ(memory, nullptr);
+        memory[Bytes - 1] = 1;
+        SSSTEST_EXPECT_EQ(FreeMemory(memory, Bytes), true);
+
+        const MemorySnapshot snapshot = GetSystemMemoryInfo();
+        SSSTEST_EXPECT_GT(snapshot.TotalSize, 0);
+        SSSTEST_EXPECT_LE(snapshot.Available, snapshot.TotalSize);
+    }
+} // namespace SSSTest
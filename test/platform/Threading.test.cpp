@@ -0,0 +1,61 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "Threading.h"
+
+using namespace SSSEngine::Platform;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(ThreadingWaitOnAddress)
+    {
+        std::atomic<u32> value{0};
+
+        // NOTE: Doesn't block when the value is not the undesired one
+        WaitOnAddress(value, 1);
+
+        std::vector<std::thread> waiters;
+        std::atomic<u32> woken{0};
+        for(u32 i = 0; i < 4; ++i)
+        {
+            waiters.emplace_back(
+                [&]()
+                {
+                    while(value.load() == 0)
+                    {
+                        WaitOnAddress(value, 0);
+                    }
+                    woken.fetch_add(1);
+                });
+        }
+
+        value.store(1);
+        WakeOneOnAddress(value);
+        WakeAllOnAddress(value);
+        for(std::thread &waiter: waiters)
+        {
+            waiter.join();
+        }
+        SSSTEST_EXPECT_EQ(woken.load(), 4);
+    }
+} // namespace SSSTest
@@ -0,0 +1,141 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "Test.h"
+#include "BuddyAllocator.h"
+
+using namespace SSSEngine::Renderer;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(BuddyAllocatorSplitAndMerge)
+    {
+        BuddyAllocator allocator{1_MiB, 4_KiB};
+        SSSTEST_EXPECT_EQ(allocator.GetSize(), 1_MiB);
+        SSSTEST_EXPECT_EQ(allocator.GetLargestFreeBlock(), 1_MiB);
+
+        const u64 first = allocator.Allocate(100);
+        SSSTEST_EXPECT_EQ(first, 0);
+        SSSTEST_EXPECT_EQ(allocator.GetBlockSize(first), 4_KiB);
+
+        // NOTE: Rounded up to the next power of 2 and aligned to it
+        const u64 second = allocator.Allocate(5_KiB);
+        SSSTEST_EXPECT_EQ(allocator.GetBlockSize(second), 8_KiB);
+        SSSTEST_EXPECT_EQ(second % 8_KiB, 0);
+
+        // NOTE: Alignment bigger than the size picks a bigger block
+        const u64 aligned = allocator.Allocate(4_KiB, 64_KiB);
+        SSSTEST_EXPECT_EQ(aligned % 64_KiB, 0);
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), 4_KiB + 8_KiB + 64_KiB);
+        SSSTEST_EXPECT_EQ(allocator.GetLargestFreeBlock(), 512_KiB);
+
+        SSSTEST_EXPECT_EQ(allocator.Allocate(2_MiB), BuddyAllocator::InvalidOffset);
+        SSSTEST_EXPECT_EQ(allocator.Allocate(0), BuddyAllocator::InvalidOffset);
+
+        allocator.Free(second);
+        allocator.Free(first);
+        allocator.Free(aligned);
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), 0);
+        SSSTEST_EXPECT_EQ(allocator.GetLargestFreeBlock(), 1_MiB);
+    }
+
+    SSSTEST_TEST(BuddyAllocatorExhaust)
+    {
+        BuddyAllocator allocator{64_KiB, 4_KiB};
+        std::vector<u64> offsets;
+        for(u64 offset = allocator.Allocate(4_KiB); offset != BuddyAllocator::InvalidOffset;
+            offset = allocator.Allocate(4_KiB))
+        {
+            offsets.push_back(offset);
+        }
+        SSSTEST_EXPECT_EQ(offsets.size(), 16);
+        SSSTEST_EXPECT_EQ(allocator.GetLargestFreeBlock(), 0);
+
+        // NOTE: Freeing every other block leaves no room for a bigger one
+        for(size i = 0; i < offsets.size(); i += 2)
+        {
+            allocator.Free(offsets[i]);
+        }
+        SSSTEST_EXPECT_EQ(allocator.Allocate(8_KiB), BuddyAllocator::InvalidOffset);
+
+        for(size i = 1; i < offsets.size(); i += 2)
+        {
+            allocator.Free(offsets[i]);
+        }
+        SSSTEST_EXPECT_EQ(allocator.Allocate(64_KiB), 0);
+    }
+
+    SSSTEST_TEST(BuddyAllocatorRandom)
+    {
+        struct Range
+        {
+            u64 Offset;
+            u64 Size;
+        };
+
+        BuddyAllocator allocator{16_MiB, 256};
+        std::vector<Range> ranges;
+        std::mt19937_64 random{7};
+
+        for(u32 step = 0; step < 20'000; ++step)
+        {
+            if(ranges.empty() || random() % 3 != 0)
+            {
+                const u64 size = 1 + random() % 64_KiB;
+                const u64 alignment = 1ull << (random() % 17);
+                const u64 offset = allocator.Allocate(size, alignment);
+                if(offset != BuddyAllocator::InvalidOffset)
+                {
+                    SSSTEST_EXPECT_EQ(offset % alignment, 0);
+                    SSSTEST_EXPECT_GE(allocator.GetBlockSize(offset), size);
+                    ranges.push_back({offset, allocator.GetBlockSize(offset)});
+                }
+            }
+            else
+            {
+                const size index = random() % ranges.size();
+                allocator.Free(ranges[index].Offset);
+                ranges[index] = ranges.back();
+                ranges.pop_back();
+            }
+        }
+
+        std::sort(ranges.begin(), ranges.end(), [](const Range &a, const Range &b) { return a.Offset < b.Offset; });
+        u64 used = 0;
+        for(size i = 0; i < ranges.size(); ++i)
+        {
+            used += ranges[i].Size;
+            SSSTEST_EXPECT_LE(ranges[i].Offset + ranges[i].Size, allocator.GetSize());
+            if(i > 0)
+            {
+                SSSTEST_EXPECT_LE(ranges[i - 1].Offset + ranges[i - 1].Size, ranges[i].Offset);
+            }
+        }
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), used);
+
+        for(const Range &range: ranges)
+        {
+            allocator.Free(range.Offset);
+        }
+        SSSTEST_EXPECT_EQ(allocator.GetLargestFreeBlock(), 16_MiB);
+    }
+} // namespace SSSTest
@@ -0,0 +1,70 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include "Test.h"
+#include "GpuHeapAllocator.h"
+
+using namespace SSSEngine::Renderer;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(GpuHeapAllocatorAddsHeaps)
+    {
+        GpuHeapAllocator allocator{1_MiB, 64_KiB, 2};
+        SSSTEST_EXPECT_EQ(allocator.GetHeapCount(), 0);
+
+        const GpuAllocation first = allocator.Allocate(600_KiB, 64_KiB);
+        SSSTEST_EXPECT_EQ(first.IsValid(), true);
+        SSSTEST_EXPECT_EQ(first.Heap, 0);
+        SSSTEST_EXPECT_EQ(first.Size, 1_MiB);
+        SSSTEST_EXPECT_EQ(allocator.GetHeapCount(), 1);
+
+        const GpuAllocation second = allocator.Allocate(100, 64_KiB);
+        SSSTEST_EXPECT_EQ(second.Heap, 1);
+        SSSTEST_EXPECT_EQ(second.Size, 64_KiB);
+        SSSTEST_EXPECT_EQ(allocator.GetHeapCount(), 2);
+
+        // NOTE: Small ranges fill the holes of the existing heaps
+        const GpuAllocation third = allocator.Allocate(64_KiB, 64_KiB);
+        SSSTEST_EXPECT_EQ(third.Heap, 1);
+        SSSTEST_EXPECT_NEQ(third.Offset, second.Offset);
+
+        // NOTE: Out of heaps and bigger than a heap both need a dedicated allocation
+        SSSTEST_EXPECT_EQ(allocator.Allocate(1_MiB, 64_KiB).IsValid(), false);
+        SSSTEST_EXPECT_EQ(allocator.Allocate(2_MiB, 64_KiB).IsValid(), false);
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), 1_MiB + 128_KiB);
+
+        allocator.Free(first);
+        const GpuAllocation reused = allocator.Allocate(1_MiB, 64_KiB);
+        SSSTEST_EXPECT_EQ(reused.Heap, 0);
+        SSSTEST_EXPECT_EQ(allocator.GetHeapCount(), 2);
+
+        allocator.Free(second);
+        allocator.Free(third);
+        allocator.Free(reused);
+        SSSTEST_EXPECT_EQ(allocator.GetUsed(), 0);
+    }
+
+    SSSTEST_TEST(GpuHeapAllocatorZeroSize)
+    {
+        GpuHeapAllocator allocator{1_MiB, 64_KiB, 2};
+        SSSTEST_EXPECT_EQ(allocator.Allocate(0, 64_KiB).IsValid(), false);
+        SSSTEST_EXPECT_EQ(allocator.GetHeapCount(), 0);
+    }
+} // namespace SSSTest
@@ -0,0 +1,136 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "BlockingQueue.h"
+#include "MpmcQueue.h"
+#include "SpscQueue.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(BlockingQueueWaits)
+    {
+        // NOTE: A tiny queue makes both sides sleep over and over
+        constexpr u64 Count = 100'000;
+        BlockingQueue<SpscQueue<u64>> queue{2};
+
+        std::thread producer(
+            [&]()
+            {
+                for(u64 i = 0; i < Count; ++i)
+                {
+                    queue.Push(i);
+                }
+            });
+
+        bool ordered = true;
+        for(u64 i = 0; i < Count; ++i)
+        {
+            u64 value = 0;
+            ordered = ordered && queue.Pop(value) && value == i;
+        }
+        producer.join();
+
+        SSSTEST_EXPECT_EQ(ordered, true);
+    }
+
+    SSSTEST_TEST(BlockingQueueBatches)
+    {
+        constexpr u32 ProducerCount = 3;
+        constexpr u64 BatchCount = 10'000;
+        BlockingQueue<MpmcQueue<u64>> queue{8};
+
+        std::vector<std::thread> producers;
+        for(u32 producer = 0; producer < ProducerCount; ++producer)
+        {
+            producers.emplace_back(
+                [&]()
+                {
+                    for(u64 i = 0; i < BatchCount; ++i)
+                    {
+                        u64 batch[5] = {1, 1, 1, 1, 1};
+                        queue.PushBatch(batch);
+                    }
+                });
+        }
+
+        u64 sum = 0;
+        while(sum < ProducerCount * BatchCount * 5)
+        {
+            u64 values[4];
+            const size count = queue.PopBatch(values);
+            for(size i = 0; i < count; ++i)
+            {
+                sum += values[i];
+            }
+        }
+        for(std::thread &producer: producers)
+        {
+            producer.join();
+        }
+
+        SSSTEST_EXPECT_EQ(sum, ProducerCount * BatchCount * 5);
+    }
+
+    SSSTEST_TEST(BlockingQueueClose)
+    {
+        BlockingQueue<MpmcQueue<u32>> queue{4};
+
+        // NOTE: The consumers are asleep on an empty queue when it is closed
+        std::vector<std::thread> consumers;
+        std::atomic<u32> finished{0};
+        for(u32 i = 0; i < 3; ++i)
+        {
+            consumers.emplace_back(
+                [&]()
+                {
+                    u32 value = 0;
+                    while(queue.Pop(value))
+                    {
+                    }
+                    finished.fetch_add(1);
+                });
+        }
+        queue.Push(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.Close();
+        for(std::thread &consumer: consumers)
+        {
+            consumer.join();
+        }
+        SSSTEST_EXPECT_EQ(finished.load(), 3);
+        SSSTEST_EXPECT_EQ(queue.Push(2), false);
+        SSSTEST_EXPECT_EQ(queue.TryPush(2), false);
+
+        // NOTE: Values pushed before closing can still be popped
+        BlockingQueue<SpscQueue<u32>> closed{4};
+        closed.Push(7);
+        closed.Close();
+        u32 value = 0;
+        SSSTEST_EXPECT_EQ(closed.Pop(value), true);
+        SSSTEST_EXPECT_EQ(value, 7);
+        SSSTEST_EXPECT_EQ(closed.Pop(value), false);
+    }
+} // namespace SSSTest
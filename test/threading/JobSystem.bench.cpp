@@ -0,0 +1,53 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <vector>
+#include "Benchmark.h"
+#include "JobSystem.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 JobCount = 10'000;
+
+        void Increment(void *data)
+        {
+            static_cast<std::atomic<u32> *>(data)->fetch_add(1, std::memory_order_relaxed);
+        }
+    } // namespace
+
+    // NOTE: The jobs do almost nothing, so this is the cost of running a job through the system
+    SSSBENCHMARK(JobSystemRunWait, 100)
+    {
+        JobSystem jobSystem;
+        std::atomic<u32> executed{0};
+        JobCounter counter;
+        const std::vector<Job> jobs(JobCount, {.Function = &Increment, .Data = &executed, .Counter = &counter});
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            jobSystem.Run(jobs);
+            jobSystem.Wait(counter);
+        }
+        DoNotOptimize(executed.load());
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,196 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "JobSystem.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    namespace
+    {
+        void Increment(void *data)
+        {
+            static_cast<std::atomic<u32> *>(data)->fetch_add(1, std::memory_order_relaxed);
+        }
+
+        struct Subtree
+        {
+            JobSystem *System;
+            std::atomic<u32> *Leaves;
+            u32 Depth;
+        };
+
+        /**
+         * @brief Splits in two jobs until Depth reaches 0, waiting on its children like a recursive algorithm would
+         */
+        void Split(void *data)
+        {
+            const auto *const subtree = static_cast<Subtree *>(data);
+            if(subtree->Depth == 0)
+            {
+                subtree->Leaves->fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            Subtree children[2] = {{subtree->System, subtree->Leaves, subtree->Depth - 1},
+                                   {subtree->System, subtree->Leaves, subtree->Depth - 1}};
+            JobCounter counter;
+            const Job jobs[2] = {{.Function = &Split, .Data = &children[0], .Counter = &counter},
+                                 {.Function = &Split, .Data = &children[1], .Counter = &counter}};
+            subtree->System->Run(jobs);
+            subtree->System->Wait(counter);
+        }
+
+        struct Spawner
+        {
+            JobSystem *System;
+            std::atomic<u32> *Started;
+            std::atomic<u32> *Submitted;
+            std::atomic<u32> *Executed;
+            JobCounter *Counter;
+            u32 SpawnerCount;
+            u32 ChildCount;
+        };
+
+        void WaitForAll(const std::atomic<u32> &arrived, u32 count)
+        {
+            while(arrived.load(std::memory_order_acquire) < count)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        /**
+         * @brief Queues its children without waiting on them. Every spawner holds its thread until all of them are done
+         * queueing, so nobody is left to take the children and they pile up
+         */
+        void Spawn(void *data)
+        {
+            const auto *const spawner = static_cast<Spawner *>(data);
+            spawner->Started->fetch_add(1, std::memory_order_release);
+            WaitForAll(*spawner->Started, spawner->SpawnerCount);
+
+            for(u32 i = 0; i < spawner->ChildCount; ++i)
+            {
+                spawner->System->Run({.Function = &Increment, .Data = spawner->Executed, .Counter = spawner->Counter});
+            }
+
+            spawner->Submitted->fetch_add(1, std::memory_order_release);
+            WaitForAll(*spawner->Submitted, spawner->SpawnerCount);
+        }
+    } // namespace
+
+    SSSTEST_TEST(JobSystemRunsEveryJob)
+    {
+        for(const u32 threadCount: {1u, 4u})
+        {
+            JobSystem jobSystem{threadCount};
+            SSSTEST_EXPECT_EQ(jobSystem.GetThreadCount(), threadCount);
+            SSSTEST_EXPECT_EQ(jobSystem.GetCurrentThreadIndex(), 0);
+
+            // NOTE: More jobs than fit in a deque, the rest go through the shared queue or run right away
+            constexpr u32 JobCount = 20'000;
+            std::atomic<u32> executed{0};
+            JobCounter counter;
+            std::vector<Job> jobs(JobCount, {.Function = &Increment, .Data = &executed, .Counter = &counter});
+            jobSystem.Run(jobs);
+            jobSystem.Run({.Function = &Increment, .Data = &executed, .Counter = &counter});
+            jobSystem.Wait(counter);
+
+            SSSTEST_EXPECT_EQ(counter.IsDone(), true);
+            SSSTEST_EXPECT_EQ(executed.load(), JobCount + 1);
+        }
+    }
+
+    SSSTEST_TEST(JobSystemNestedWaits)
+    {
+        JobSystem jobSystem{4};
+        std::atomic<u32> leaves{0};
+        Subtree root{&jobSystem, &leaves, 12};
+
+        JobCounter counter;
+        jobSystem.Run({.Function = &Split, .Data = &root, .Counter = &counter});
+        jobSystem.Wait(counter);
+
+        SSSTEST_EXPECT_EQ(leaves.load(), 1u << 12);
+    }
+
+    SSSTEST_TEST(JobSystemOutsideThreads)
+    {
+        JobSystem jobSystem{3};
+        std::atomic<u32> executed{0};
+        u32 outsideIndex = 0;
+
+        // NOTE: A thread that is not part of the system can still run and wait on jobs
+        std::thread outside(
+            [&]()
+            {
+                outsideIndex = jobSystem.GetCurrentThreadIndex();
+                JobCounter counter;
+                for(u32 i = 0; i < 1000; ++i)
+                {
+                    jobSystem.Run({.Function = &Increment, .Data = &executed, .Counter = &counter});
+                }
+                jobSystem.Wait(counter);
+            });
+        outside.join();
+
+        SSSTEST_EXPECT_EQ(outsideIndex, JobSystem::InvalidThread);
+        SSSTEST_EXPECT_EQ(executed.load(), 1000);
+    }
+
+    SSSTEST_TEST(JobSystemSaturated)
+    {
+        constexpr u32 ThreadCount = 16;
+        constexpr u32 ChildCount = 5000;
+        SSSENGINE_STATIC_ASSERT(ThreadCount * ChildCount > JobSystem::MaxJobs, "The jobs must not fit in the pool")
+
+        JobSystem jobSystem{ThreadCount};
+        std::atomic<u32> started{0};
+        std::atomic<u32> submitted{0};
+        std::atomic<u32> executed{0};
+        std::vector<JobCounter> counters(ThreadCount);
+        std::vector<Spawner> spawners;
+        std::vector<Job> jobs;
+        for(u32 i = 0; i < ThreadCount; ++i)
+        {
+            spawners.push_back({&jobSystem, &started, &submitted, &executed, &counters[i], ThreadCount, ChildCount});
+        }
+
+        JobCounter counter;
+        for(Spawner &spawner: spawners)
+        {
+            jobs.push_back({.Function = &Spawn, .Data = &spawner, .Counter = &counter});
+        }
+        jobSystem.Run(jobs);
+        jobSystem.Wait(counter);
+
+        for(const JobCounter &children: counters)
+        {
+            jobSystem.Wait(children);
+            SSSTEST_EXPECT_EQ(children.IsDone(), true);
+        }
+        SSSTEST_EXPECT_EQ(executed.load(), ThreadCount * ChildCount);
+    }
+} // namespace SSSTest
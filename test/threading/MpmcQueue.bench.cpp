@@ -0,0 +1,172 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "MpmcQueue.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 ThreadCount = 4;
+        constexpr u64 MessageCount = 100'000;
+
+        /**
+         * @brief Runs ThreadCount producers and ThreadCount consumers that move MessageCount values each
+         */
+        template<typename Push, typename Pop>
+        void Transfer(Push push, Pop pop)
+        {
+            std::vector<std::thread> threads;
+            for(u32 thread = 0; thread < ThreadCount; ++thread)
+            {
+                threads.emplace_back(
+                    [&]()
+                    {
+                        for(u64 j = 0; j < MessageCount;)
+                        {
+                            if(push(j))
+                            {
+                                ++j;
+                            }
+                            else
+                            {
+                                std::this_thread::yield();
+                            }
+                        }
+                    });
+                threads.emplace_back(
+                    [&]()
+                    {
+                        u64 sum = 0;
+                        for(u64 received = 0; received < MessageCount;)
+                        {
+                            u64 value = 0;
+                            if(pop(value))
+                            {
+                                sum += value;
+                                ++received;
+                            }
+                            else
+                            {
+                                std::this_thread::yield();
+                            }
+                        }
+                        DoNotOptimize(sum);
+                    });
+            }
+            for(std::thread &thread: threads)
+            {
+                thread.join();
+            }
+        }
+    } // namespace
+
+    SSSBENCHMARK(MpmcQueueTransfer, 10)
+    {
+        MpmcQueue<u64> queue{1024};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Transfer([&](u64 value) { return queue.TryPush(value); }, [&](u64 &value) { return queue.TryPop(value); });
+        }
+    }
+
+    SSSBENCHMARK(MpmcQueueBatchTransfer, 10)
+    {
+        MpmcQueue<u64> queue{1024};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            // NOTE: Same traffic as MpmcQueueTransfer, 16 values per claim
+            std::vector<std::thread> threads;
+            for(u32 thread = 0; thread < ThreadCount; ++thread)
+            {
+                threads.emplace_back(
+                    [&]()
+                    {
+                        u64 batch[16] = {};
+                        for(u64 j = 0; j < MessageCount;)
+                        {
+                            const size pushed =
+                                queue.TryPushBatch(std::span<u64>{batch, (std::min)(u64{16}, MessageCount - j)});
+                            if(pushed == 0)
+                            {
+                                std::this_thread::yield();
+                            }
+                            j += pushed;
+                        }
+                    });
+                threads.emplace_back(
+                    [&]()
+                    {
+                        u64 batch[16];
+                        for(u64 received = 0; received < MessageCount;)
+                        {
+                            const u64 wanted = (std::min)(u64{16}, MessageCount - received);
+                            const size popped = queue.TryPopBatch(std::span<u64>{batch, wanted});
+                            if(popped == 0)
+                            {
+                                std::this_thread::yield();
+                            }
+                            received += popped;
+                        }
+                        DoNotOptimize(batch);
+                    });
+            }
+            for(std::thread &thread: threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    SSSBENCHMARK(MutexDequeMultiTransfer, 10)
+    {
+        std::mutex mutex;
+        std::deque<u64> queue;
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Transfer(
+                [&](u64 value)
+                {
+                    const std::scoped_lock lock{mutex};
+                    queue.push_back(value);
+                    return true;
+                },
+                [&](u64 &value)
+                {
+                    const std::scoped_lock lock{mutex};
+                    if(queue.empty())
+                    {
+                        return false;
+                    }
+                    value = queue.front();
+                    queue.pop_front();
+                    return true;
+                });
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,145 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "MpmcQueue.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(MpmcQueueFullAndEmpty)
+    {
+        MpmcQueue<std::string> queue{4};
+
+        std::string value;
+        SSSTEST_EXPECT_EQ(queue.TryPop(value), false);
+        for(u32 i = 0; i < 4; ++i)
+        {
+            SSSTEST_EXPECT_EQ(queue.TryPush(std::to_string(i)), true);
+        }
+        const std::string extra = "extra";
+        SSSTEST_EXPECT_EQ(queue.TryPush(extra), false);
+
+        for(u32 i = 0; i < 10; ++i)
+        {
+            SSSTEST_EXPECT_EQ(queue.TryPop(value), true);
+            SSSTEST_EXPECT_EQ(value, std::to_string(i));
+            SSSTEST_EXPECT_EQ(queue.TryEmplace(1, static_cast<char>('0' + (i + 4) % 10)), true);
+        }
+        SSSTEST_EXPECT_EQ(queue.GetSizeApprox(), 4);
+    }
+
+    SSSTEST_TEST(MpmcQueueBatches)
+    {
+        MpmcQueue<u32> queue{8};
+        std::vector<u32> values{0, 1, 2, 3, 4, 5};
+        SSSTEST_EXPECT_EQ(queue.TryPushBatch(values), 6);
+        SSSTEST_EXPECT_EQ(queue.TryPushBatch(values), 2);
+        SSSTEST_EXPECT_EQ(queue.TryPushBatch(values), 0);
+
+        std::vector<u32> out(5);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 5);
+        SSSTEST_EXPECT_EQ(out[4], 4);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 3);
+        SSSTEST_EXPECT_EQ(out[0], 5);
+        SSSTEST_EXPECT_EQ(out[2], 1);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 0);
+    }
+
+    SSSTEST_TEST(MpmcQueueThreads)
+    {
+        constexpr u32 ThreadCount = 4;
+        constexpr u64 CountPerProducer = 200'000;
+        MpmcQueue<u64> queue{64};
+
+        // NOTE: Every producer pushes its own increasing sequence, each consumer must see every sequence in order
+        std::atomic<u64> popped{0};
+        std::atomic<u64> sum{0};
+        std::atomic<bool> ordered{true};
+        std::vector<std::thread> threads;
+        for(u64 producer = 0; producer < ThreadCount; ++producer)
+        {
+            threads.emplace_back(
+                [&, producer]()
+                {
+                    for(u64 i = 0; i < CountPerProducer;)
+                    {
+                        size pushed = 0;
+                        if(i % 2 == 0 && i + 2 <= CountPerProducer)
+                        {
+                            u64 batch[2] = {producer << 32 | i, producer << 32 | (i + 1)};
+                            pushed = queue.TryPushBatch(batch);
+                        }
+                        else
+                        {
+                            pushed = queue.TryPush(producer << 32 | i) ? 1 : 0;
+                        }
+
+                        // NOTE: Let the consumers run on machines with few cores
+                        if(pushed == 0)
+                        {
+                            std::this_thread::yield();
+                        }
+                        i += pushed;
+                    }
+                });
+            threads.emplace_back(
+                [&]()
+                {
+                    u64 last[ThreadCount] = {};
+                    bool first[ThreadCount] = {true, true, true, true};
+                    while(popped.load(std::memory_order_relaxed) < ThreadCount * CountPerProducer)
+                    {
+                        u64 values[3];
+                        const size count = queue.TryPopBatch(values);
+                        if(count == 0)
+                        {
+                            std::this_thread::yield();
+                        }
+                        for(size i = 0; i < count; ++i)
+                        {
+                            const u64 source = values[i] >> 32;
+                            const u64 index = values[i] & 0xFFFFFFFF;
+                            if(!first[source] && index <= last[source])
+                            {
+                                ordered.store(false);
+                            }
+                            first[source] = false;
+                            last[source] = index;
+                            sum.fetch_add(index, std::memory_order_relaxed);
+                        }
+                        popped.fetch_add(count, std::memory_order_relaxed);
+                    }
+                });
+        }
+        for(std::thread &thread: threads)
+        {
+            thread.join();
+        }
+
+        SSSTEST_EXPECT_EQ(popped.load(), ThreadCount * CountPerProducer);
+        SSSTEST_EXPECT_EQ(sum.load(), ThreadCount * CountPerProducer * (CountPerProducer - 1) / 2);
+        SSSTEST_EXPECT_EQ(ordered.load(), true);
+    }
+} // namespace SSSTest
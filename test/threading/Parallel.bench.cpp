@@ -0,0 +1,69 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+#include "Benchmark.h"
+#include "Parallel.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr size KeyCount = 1'000'000;
+
+        std::vector<u64> MakeSortKeys()
+        {
+            std::vector<u64> keys(KeyCount);
+            std::mt19937_64 random{4};
+            std::generate(keys.begin(), keys.end(), [&]() { return random(); });
+            return keys;
+        }
+    } // namespace
+
+    // NOTE: The sort keys of a frame, like the ones used to order draw calls
+    SSSBENCHMARK(ParallelSortKeys, 20)
+    {
+        JobSystem jobSystem;
+        const std::vector<u64> source = MakeSortKeys();
+        std::vector<u64> keys;
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            keys = source;
+            ParallelSort(jobSystem, std::span{keys});
+            DoNotOptimize(keys.data());
+        }
+    }
+
+    SSSBENCHMARK(StdSortKeys, 20)
+    {
+        const std::vector<u64> source = MakeSortKeys();
+        std::vector<u64> keys;
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            keys = source;
+            std::sort(keys.begin(), keys.end());
+            DoNotOptimize(keys.data());
+        }
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,194 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+#include "Test.h"
+#include "Array.h"
+#include "Parallel.h"
+
+using namespace SSSEngine;
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(ParallelForCoversRange)
+    {
+        JobSystem jobSystem{4};
+        AdaptiveGrain adaptive;
+
+        for(const size count: {size{0}, size{1}, size{1000}, size{100'003}})
+        {
+            std::vector<std::atomic<u32>> visits(count);
+            ParallelFor(jobSystem, count, 64,
+                        [&](size begin, size end)
+                        {
+                            for(size i = begin; i < end; ++i)
+                            {
+                                visits[i].fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+
+            std::vector<u32> values(count, 1);
+            ParallelFor(jobSystem, std::span{values}, adaptive,
+                        [](std::span<u32> chunk)
+                        {
+                            for(u32 &value: chunk)
+                            {
+                                value *= 3;
+                            }
+                        });
+
+            bool once = true;
+            for(size i = 0; i < count; ++i)
+            {
+                once = once && visits[i].load() == 1 && values[i] == 3;
+            }
+            SSSTEST_EXPECT_EQ(once, true);
+        }
+
+        // NOTE: The runs above were timed, the grain now comes from the measured cost instead of the thread count
+        SSSTEST_EXPECT_GT(adaptive.GetCostPerItem(), 0);
+        SSSTEST_EXPECT_GE(adaptive.GetGrainSize(1'000'000, 4), 1);
+        SSSTEST_EXPECT_LE(adaptive.GetGrainSize(1'000'000, 4), 1'000'000);
+    }
+
+    SSSTEST_TEST(AdaptiveGrainFollowsCost)
+    {
+        AdaptiveGrain adaptive{8};
+        SSSTEST_EXPECT_EQ(adaptive.GetGrainSize(3200, 4), 100);
+        SSSTEST_EXPECT_EQ(adaptive.GetGrainSize(10, 4), 8);
+
+        // NOTE: 10 ns per item, a chunk should hold 5000 items to take 50 us
+        adaptive.Record(1000, 10'000);
+        SSSTEST_EXPECT_EQ(adaptive.GetGrainSize(1'000'000, 4), 5000);
+        SSSTEST_EXPECT_EQ(adaptive.GetGrainSize(100, 4), 100);
+
+        // NOTE: The items got far more expensive, the grain shrinks over a few runs
+        for(u32 i = 0; i < 20; ++i)
+        {
+            adaptive.Record(10, 100'000);
+        }
+        SSSTEST_EXPECT_EQ(adaptive.GetGrainSize(1'000'000, 4), 8);
+    }
+
+    SSSTEST_TEST(ParallelReduceAndScan)
+    {
+        JobSystem jobSystem{4};
+        constexpr size Count = 50'001;
+        std::vector<u64> values(Count);
+        std::iota(values.begin(), values.end(), u64{1});
+
+        const u64 sum = ParallelReduce(
+            jobSystem, Count, 1000, u64{0},
+            [&](size begin, size end) { return std::accumulate(values.begin() + begin, values.begin() + end, u64{0}); },
+            std::plus<>{});
+        SSSTEST_EXPECT_EQ(sum, Count * (Count + 1) / 2);
+        SSSTEST_EXPECT_EQ(ParallelReduce(jobSystem, 0, 1000, u64{7}, [](size, size) { return u64{0}; }, std::plus<>{}),
+                          7);
+
+        std::vector<u64> inclusive(Count);
+        ParallelScan(jobSystem, std::span<const u64>{values}, std::span{inclusive}, 777);
+        std::vector<u64> expected(Count);
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+        SSSTEST_EXPECT_EQ(inclusive == expected, true);
+
+        // NOTE: In place, counts turned into offsets
+        std::vector<u64> offsets = values;
+        ParallelExclusiveScan(jobSystem, std::span<const u64>{offsets}, std::span{offsets}, 1234);
+        std::exclusive_scan(values.begin(), values.end(), expected.begin(), u64{0});
+        SSSTEST_EXPECT_EQ(offsets == expected, true);
+
+        std::vector<u32> maximums(Count);
+        std::vector<u32> noise(Count);
+        std::mt19937 random{3};
+        std::generate(noise.begin(), noise.end(), [&]() { return static_cast<u32>(random()); });
+        ParallelScan(jobSystem, std::span<const u32>{noise}, std::span{maximums}, 500, 0u,
+                     [](u32 first, u32 second) { return (std::max)(first, second); });
+        SSSTEST_EXPECT_EQ(maximums.back(), *std::max_element(noise.begin(), noise.end()));
+        SSSTEST_EXPECT_EQ(std::is_sorted(maximums.begin(), maximums.end()), true);
+    }
+
+    SSSTEST_TEST(ParallelScanDeducesType)
+    {
+        JobSystem jobSystem{2};
+        Array<u32> counts;
+        for(u32 i = 0; i < 1000; ++i)
+        {
+            counts.PushBack(i % 7);
+        }
+
+        // NOTE: Neither call names the element type
+        Array<u32> offsets;
+        offsets.Resize(counts.GetSize());
+        ParallelExclusiveScan(jobSystem, counts, std::span{offsets.GetData(), offsets.GetSize()}, 100);
+        std::vector<u32> sizes(counts.begin(), counts.end());
+        std::vector<u32> ends(sizes.size());
+        ParallelScan(jobSystem, sizes, std::span{ends}, 100);
+
+        std::vector<u32> expected(counts.GetSize());
+        std::exclusive_scan(counts.begin(), counts.end(), expected.begin(), 0u);
+        SSSTEST_EXPECT_EQ(std::equal(offsets.begin(), offsets.end(), expected.begin()), true);
+        std::inclusive_scan(counts.begin(), counts.end(), expected.begin());
+        SSSTEST_EXPECT_EQ(ends == expected, true);
+    }
+
+    SSSTEST_TEST(ParallelSortKeys)
+    {
+        std::mt19937_64 random{9};
+        for(const u32 threadCount: {1u, 4u})
+        {
+            JobSystem jobSystem{threadCount};
+
+            std::vector<u64> keys(200'000);
+            std::generate(keys.begin(), keys.end(), [&]() { return random() >> (random() % 48); });
+            std::vector<u64> expected = keys;
+            std::sort(expected.begin(), expected.end());
+            ParallelSort(jobSystem, std::span{keys});
+            SSSTEST_EXPECT_EQ(keys == expected, true);
+
+            std::vector<i32> signedKeys(100'000);
+            std::generate(signedKeys.begin(), signedKeys.end(), [&]() { return static_cast<i32>(random()); });
+            std::vector<i32> signedExpected = signedKeys;
+            std::sort(signedExpected.begin(), signedExpected.end());
+            ParallelSort(jobSystem, std::span{signedKeys});
+            SSSTEST_EXPECT_EQ(signedKeys == signedExpected, true);
+
+            // NOTE: Only the low byte differs, every other pass is skipped
+            std::vector<u32> lowByte(50'000);
+            std::generate(lowByte.begin(), lowByte.end(), [&]() { return 0xABCD0000u | (random() & 0xFF); });
+            ParallelSort(jobSystem, std::span{lowByte});
+            SSSTEST_EXPECT_EQ(std::is_sorted(lowByte.begin(), lowByte.end()), true);
+
+            std::vector<f32> floats(70'001);
+            std::generate(floats.begin(), floats.end(), [&]() { return static_cast<f32>(random() % 100'000) - 5e4f; });
+            ParallelSort(jobSystem, std::span{floats}, std::greater<>{});
+            SSSTEST_EXPECT_EQ(std::is_sorted(floats.begin(), floats.end(), std::greater<>{}), true);
+
+            std::vector<u16> small{5, 3, 9, 1};
+            ParallelSort(jobSystem, std::span{small});
+            SSSTEST_EXPECT_EQ(small == std::vector<u16>({1, 3, 5, 9}), true);
+        }
+    }
+} // namespace SSSTest
@@ -0,0 +1,110 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "Benchmark.h"
+#include "SpscQueue.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u64 MessageCount = 100'000;
+    } // namespace
+
+    // NOTE: One iteration moves MessageCount values from a producer thread to the benchmark thread
+    SSSBENCHMARK(SpscQueueTransfer, 20)
+    {
+        SpscQueue<u64> queue{1024};
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::thread producer(
+                [&]()
+                {
+                    for(u64 j = 0; j < MessageCount;)
+                    {
+                        if(queue.TryPush(j))
+                        {
+                            ++j;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+
+            u64 sum = 0;
+            for(u64 received = 0; received < MessageCount;)
+            {
+                u64 value = 0;
+                if(queue.TryPop(value))
+                {
+                    sum += value;
+                    ++received;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            producer.join();
+            DoNotOptimize(sum);
+        }
+    }
+
+    SSSBENCHMARK(MutexDequeTransfer, 20)
+    {
+        std::mutex mutex;
+        std::deque<u64> queue;
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::thread producer(
+                [&]()
+                {
+                    for(u64 j = 0; j < MessageCount; ++j)
+                    {
+                        const std::scoped_lock lock{mutex};
+                        queue.push_back(j);
+                    }
+                });
+
+            u64 sum = 0;
+            for(u64 received = 0; received < MessageCount;)
+            {
+                std::unique_lock lock{mutex};
+                if(queue.empty())
+                {
+                    lock.unlock();
+                    std::this_thread::yield();
+                    continue;
+                }
+                sum += queue.front();
+                queue.pop_front();
+                ++received;
+            }
+            producer.join();
+            DoNotOptimize(sum);
+        }
+    }
+} // namespace SSSBenchmark
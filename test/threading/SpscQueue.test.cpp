@@ -0,0 +1,136 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "SpscQueue.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(SpscQueueFullAndEmpty)
+    {
+        SpscQueue<u32> queue{3};
+        SSSTEST_EXPECT_EQ(queue.GetCapacity(), 4);
+
+        u32 value = 0;
+        SSSTEST_EXPECT_EQ(queue.TryPop(value), false);
+        for(u32 i = 0; i < 4; ++i)
+        {
+            SSSTEST_EXPECT_EQ(queue.TryPush(i), true);
+        }
+        SSSTEST_EXPECT_EQ(queue.TryPush(4u), false);
+        SSSTEST_EXPECT_EQ(queue.GetSizeApprox(), 4);
+
+        // NOTE: Wrap around the end of the slots a few times
+        for(u32 i = 0; i < 10; ++i)
+        {
+            SSSTEST_EXPECT_EQ(queue.TryPop(value), true);
+            SSSTEST_EXPECT_EQ(value, i);
+            SSSTEST_EXPECT_EQ(queue.TryPush(i + 4), true);
+        }
+    }
+
+    SSSTEST_TEST(SpscQueueBatches)
+    {
+        SpscQueue<u32> queue{8};
+        std::vector<u32> values{0, 1, 2, 3, 4, 5};
+        SSSTEST_EXPECT_EQ(queue.TryPushBatch(values), 6);
+        SSSTEST_EXPECT_EQ(queue.TryPushBatch(values), 2);
+
+        std::vector<u32> out(5);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 5);
+        SSSTEST_EXPECT_EQ(out[4], 4);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 3);
+        SSSTEST_EXPECT_EQ(out[0], 5);
+        SSSTEST_EXPECT_EQ(out[2], 1);
+        SSSTEST_EXPECT_EQ(queue.TryPopBatch(out), 0);
+    }
+
+    SSSTEST_TEST(SpscQueueDestroysValues)
+    {
+        const auto shared = std::make_shared<u32>(1);
+        {
+            SpscQueue<std::shared_ptr<u32>> queue{4};
+            queue.TryPush(shared);
+            queue.TryPush(shared);
+
+            std::shared_ptr<u32> out;
+            queue.TryPop(out);
+            SSSTEST_EXPECT_EQ(shared.use_count(), 3);
+        }
+        SSSTEST_EXPECT_EQ(shared.use_count(), 1);
+    }
+
+    SSSTEST_TEST(SpscQueueThreads)
+    {
+        constexpr u64 Count = 1'000'000;
+        SpscQueue<u64> queue{256};
+
+        std::thread producer(
+            [&]()
+            {
+                for(u64 i = 0; i < Count;)
+                {
+                    size pushed = 0;
+                    if(i % 3 == 0)
+                    {
+                        u64 batch[4] = {i, i + 1, i + 2, i + 3};
+                        pushed = queue.TryPushBatch(std::span<u64>{batch, (std::min)(u64{4}, Count - i)});
+                    }
+                    else
+                    {
+                        pushed = queue.TryPush(i) ? 1 : 0;
+                    }
+
+                    // NOTE: Let the consumer run on machines with few cores
+                    if(pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    i += pushed;
+                }
+            });
+
+        bool ordered = true;
+        u64 expected = 0;
+        while(expected < Count)
+        {
+            u64 values[8];
+            const size count = queue.TryPopBatch(values);
+            if(count == 0)
+            {
+                std::this_thread::yield();
+            }
+            for(size i = 0; i < count; ++i)
+            {
+                ordered = ordered && values[i] == expected++;
+            }
+        }
+        producer.join();
+
+        SSSTEST_EXPECT_EQ(ordered, true);
+        SSSTEST_EXPECT_EQ(queue.GetSizeApprox(), 0);
+    }
+} // namespace SSSTest
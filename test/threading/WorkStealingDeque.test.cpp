@@ -0,0 +1,130 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Test.h"
+#include "WorkStealingDeque.h"
+
+using namespace SSSEngine::Core::Threading;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(WorkStealingDequeOrder)
+    {
+        WorkStealingDeque<u32> deque{4};
+        u32 value = 0;
+        SSSTEST_EXPECT_EQ(deque.Pop(value), false);
+        SSSTEST_EXPECT_EQ(deque.Steal(value), false);
+
+        for(u32 i = 0; i < 4; ++i)
+        {
+            SSSTEST_EXPECT_EQ(deque.Push(i), true);
+        }
+        SSSTEST_EXPECT_EQ(deque.Push(4u), false);
+
+        // NOTE: The owner takes the newest, thieves the oldest
+        SSSTEST_EXPECT_EQ(deque.Pop(value), true);
+        SSSTEST_EXPECT_EQ(value, 3);
+        SSSTEST_EXPECT_EQ(deque.Steal(value), true);
+        SSSTEST_EXPECT_EQ(value, 0);
+        SSSTEST_EXPECT_EQ(deque.GetSizeApprox(), 2);
+
+        SSSTEST_EXPECT_EQ(deque.Push(5u), true);
+        SSSTEST_EXPECT_EQ(deque.Push(6u), true);
+        SSSTEST_EXPECT_EQ(deque.Steal(value), true);
+        SSSTEST_EXPECT_EQ(value, 1);
+        SSSTEST_EXPECT_EQ(deque.Pop(value), true);
+        SSSTEST_EXPECT_EQ(value, 6);
+        SSSTEST_EXPECT_EQ(deque.Pop(value), true);
+        SSSTEST_EXPECT_EQ(value, 5);
+        SSSTEST_EXPECT_EQ(deque.Pop(value), true);
+        SSSTEST_EXPECT_EQ(value, 2);
+        SSSTEST_EXPECT_EQ(deque.Pop(value), false);
+        SSSTEST_EXPECT_EQ(deque.GetSizeApprox(), 0);
+    }
+
+    SSSTEST_TEST(WorkStealingDequeThieves)
+    {
+        // NOTE: Every value must be taken exactly once, by the owner or by one of the thieves
+        constexpr u32 Count = 200'000;
+        constexpr u32 ThiefCount = 3;
+        WorkStealingDeque<u32> deque{64};
+        std::vector<std::atomic<u32>> taken(Count);
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> thieves;
+        for(u32 i = 0; i < ThiefCount; ++i)
+        {
+            thieves.emplace_back(
+                [&]()
+                {
+                    while(!done.load(std::memory_order_acquire))
+                    {
+                        u32 value = 0;
+                        if(deque.Steal(value))
+                        {
+                            taken[value].fetch_add(1, std::memory_order_relaxed);
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        for(u32 i = 0; i < Count;)
+        {
+            if(deque.Push(i))
+            {
+                ++i;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+
+            // NOTE: Pop every few pushes so the owner and the thieves race for the last values
+            u32 value = 0;
+            if(i % 3 == 0 && deque.Pop(value))
+            {
+                taken[value].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        u32 value = 0;
+        while(deque.Pop(value))
+        {
+            taken[value].fetch_add(1, std::memory_order_relaxed);
+        }
+        done.store(true, std::memory_order_release);
+        for(std::thread &thief: thieves)
+        {
+            thief.join();
+        }
+
+        bool once = true;
+        for(const std::atomic<u32> &count: taken)
+        {
+            once = once && count.load() == 1;
+        }
+        SSSTEST_EXPECT_EQ(once, true);
+    }
+} // namespace SSSTest
@@ -0,0 +1,133 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <vector>
+#include "Benchmark.h"
+#include "Array.h"
+
+using namespace SSSEngine;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 ElementCount = 10'000;
+        constexpr u32 InnerCount = 1'000;
+    } // namespace
+
+    SSSBENCHMARK(ArrayPushBack, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Array<u32> values;
+            for(u32 j = 0; j < ElementCount; ++j)
+            {
+                values.PushBack(j);
+            }
+            DoNotOptimize(values.GetData());
+        }
+    }
+
+    SSSBENCHMARK(VectorPushBack, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::vector<u32> values;
+            for(u32 j = 0; j < ElementCount; ++j)
+            {
+                values.push_back(j);
+            }
+            DoNotOptimize(values.data());
+        }
+    }
+
+    SSSBENCHMARK(ArrayOfArraysPushBack, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Array<Array<u32>> values;
+            for(u32 j = 0; j < InnerCount; ++j)
+            {
+                values.EmplaceBack().PushBack(j);
+            }
+            DoNotOptimize(values.GetData());
+        }
+    }
+
+    SSSBENCHMARK(VectorOfVectorsPushBack, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::vector<std::vector<u32>> values;
+            for(u32 j = 0; j < InnerCount; ++j)
+            {
+                values.emplace_back().push_back(j);
+            }
+            DoNotOptimize(values.data());
+        }
+    }
+
+    SSSBENCHMARK(ArrayResizeUninitialized, 10'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            Array<f32> values;
+            values.ResizeUninitialized(ElementCount);
+            values[i % ElementCount] = 1.0f;
+            DoNotOptimize(values.GetData());
+        }
+    }
+
+    SSSBENCHMARK(VectorResize, 10'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::vector<f32> values;
+            values.resize(ElementCount);
+            values[i % ElementCount] = 1.0f;
+            DoNotOptimize(values.data());
+        }
+    }
+
+    SSSBENCHMARK(SmallArrayPushBack, 100'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            SmallArray<u32, 16> values;
+            for(u32 j = 0; j < 16; ++j)
+            {
+                values.PushBack(j);
+            }
+            DoNotOptimize(values.GetData());
+        }
+    }
+
+    SSSBENCHMARK(SmallVectorPushBack, 100'000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::vector<u32> values;
+            for(u32 j = 0; j < 16; ++j)
+            {
+                values.push_back(j);
+            }
+            DoNotOptimize(values.data());
+        }
+    }
+} // namespace SSSBenchmark
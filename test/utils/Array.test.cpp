@@ -0,0 +1,191 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <memory>
+#include <string>
+#include "Test.h"
+#include "Array.h"
+
+using namespace SSSEngine;
+
+namespace SSSTest
+{
+    namespace
+    {
+        struct Counted
+        {
+            static inline i32 Alive = 0;
+
+            explicit Counted(i32 value) : Value{std::make_unique<i32>(value)}
+            {
+                ++Alive;
+            }
+
+            Counted(Counted &&other) noexcept : Value{std::move(other.Value)}
+            {
+                ++Alive;
+            }
+
+            Counted &operator=(Counted &&other) noexcept = default;
+
+            ~Counted()
+            {
+                --Alive;
+            }
+
+            std::unique_ptr<i32> Value;
+        };
+
+        struct CountingAllocator
+        {
+            i32 *Allocations;
+
+            void *Allocate(size bytes, size alignment) const
+            {
+                ++*Allocations;
+                return GlobalAllocator::Allocate(bytes, alignment);
+            }
+
+            void Deallocate(void *memory, size bytes, size alignment) const noexcept
+            {
+                --*Allocations;
+                GlobalAllocator::Deallocate(memory, bytes, alignment);
+            }
+        };
+    } // namespace
+
+    SSSTEST_TEST(ArrayPushAndGrow)
+    {
+        Array<u32> values;
+        SSSTEST_EXPECT_EQ(values.IsEmpty(), true);
+        for(u32 i = 0; i < 1000; ++i)
+        {
+            values.PushBack(i);
+        }
+        SSSTEST_EXPECT_EQ(values.GetSize(), 1000);
+        SSSTEST_EXPECT_GE(values.GetCapacity(), 1000);
+
+        u64 sum = 0;
+        for(const u32 value: values)
+        {
+            sum += value;
+        }
+        SSSTEST_EXPECT_EQ(sum, 999 * 1000 / 2);
+
+        // NOTE: Pushing an element of the array itself while it grows
+        Array<std::string> strings{"first"};
+        for(u32 i = 0; i < 100; ++i)
+        {
+            strings.PushBack(strings[0]);
+        }
+        SSSTEST_EXPECT_EQ(strings.Back(), "first");
+
+        values.RemoveSwap(0);
+        SSSTEST_EXPECT_EQ(values[0], 999);
+        values.Remove(0);
+        SSSTEST_EXPECT_EQ(values[0], 1);
+        SSSTEST_EXPECT_EQ(values.Back(), 998);
+        SSSTEST_EXPECT_EQ(values.GetSize(), 998);
+    }
+
+    SSSTEST_TEST(ArrayResize)
+    {
+        Array<i32> values(10);
+        SSSTEST_EXPECT_EQ(values.GetSize(), 10);
+        SSSTEST_EXPECT_EQ(values[9], 0);
+
+        values.ResizeUninitialized(100);
+        SSSTEST_EXPECT_EQ(values.GetSize(), 100);
+        values[99] = 7;
+        values.Resize(50);
+        SSSTEST_EXPECT_EQ(values.GetSize(), 50);
+        SSSTEST_EXPECT_GE(values.GetCapacity(), 100);
+
+        values.Clear();
+        SSSTEST_EXPECT_EQ(values.IsEmpty(), true);
+    }
+
+    SSSTEST_TEST(ArrayNonTrivialElements)
+    {
+        {
+            Array<Counted> values;
+            for(i32 i = 0; i < 100; ++i)
+            {
+                values.EmplaceBack(i);
+            }
+            SSSTEST_EXPECT_EQ(Counted::Alive, 100);
+            SSSTEST_EXPECT_EQ(*values[42].Value, 42);
+
+            values.PopBack();
+            SSSTEST_EXPECT_EQ(Counted::Alive, 99);
+
+            Array<Counted> moved{std::move(values)};
+            SSSTEST_EXPECT_EQ(values.GetSize(), 0);
+            SSSTEST_EXPECT_EQ(*moved.Back().Value, 98);
+            SSSTEST_EXPECT_EQ(Counted::Alive, 99);
+        }
+        SSSTEST_EXPECT_EQ(Counted::Alive, 0);
+
+        // NOTE: Arrays relocate with memcpy so arrays of arrays grow without touching the inner arrays
+        SSSTEST_EXPECT_EQ(IsTriviallyRelocatableV<Array<Counted>>, true);
+        Array<Array<i32>> nested;
+        for(i32 i = 0; i < 100; ++i)
+        {
+            nested.EmplaceBack(std::initializer_list<i32>{i, i + 1});
+        }
+        SSSTEST_EXPECT_EQ(nested[50][1], 51);
+    }
+
+    SSSTEST_TEST(SmallArrayInline)
+    {
+        i32 allocations = 0;
+        {
+            SmallArray<u64, 8, CountingAllocator> values{CountingAllocator{&allocations}};
+            SSSTEST_EXPECT_EQ(values.GetCapacity(), 8);
+            for(u64 i = 0; i < 8; ++i)
+            {
+                values.PushBack(i);
+            }
+            SSSTEST_EXPECT_EQ(allocations, 0);
+
+            SmallArray<u64, 8, CountingAllocator> copy{values};
+            SmallArray<u64, 8, CountingAllocator> moved{std::move(copy)};
+            SSSTEST_EXPECT_EQ(moved[7], 7);
+            SSSTEST_EXPECT_EQ(allocations, 0);
+
+            values.PushBack(8);
+            SSSTEST_EXPECT_EQ(allocations, 1);
+            SSSTEST_EXPECT_EQ(values[8], 8);
+            SSSTEST_EXPECT_EQ(values[0], 0);
+
+            moved = std::move(values);
+            SSSTEST_EXPECT_EQ(moved.GetSize(), 9);
+            SSSTEST_EXPECT_EQ(values.GetCapacity(), 8);
+            SSSTEST_EXPECT_EQ(allocations, 1);
+        }
+        SSSTEST_EXPECT_EQ(allocations, 0);
+
+        SmallArray<std::string, 2> strings;
+        strings.EmplaceBack("a");
+        strings.EmplaceBack("b");
+        SmallArray<std::string, 2> movedStrings{std::move(strings)};
+        movedStrings.EmplaceBack("c");
+        SSSTEST_EXPECT_EQ(movedStrings[0] + movedStrings[1] + movedStrings[2], "abc");
+    }
+} // namespace SSSTest
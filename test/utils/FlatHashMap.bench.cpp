@@ -0,0 +1,114 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "Benchmark.h"
+#include "FlatHashMap.h"
+
+using namespace SSSEngine;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 KeyCount = 10'000;
+
+        std::vector<u64> MakeKeys()
+        {
+            std::mt19937_64 random{3};
+            std::vector<u64> keys(KeyCount);
+            for(u64 &key: keys)
+            {
+                key = random();
+            }
+            return keys;
+        }
+
+        const std::vector<u64> Keys = MakeKeys();
+    } // namespace
+
+    SSSBENCHMARK(FlatHashMapInsert, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            FlatHashMap<u64, u64> map;
+            for(const u64 key: Keys)
+            {
+                map[key] = key;
+            }
+            DoNotOptimize(map.GetSize());
+        }
+    }
+
+    SSSBENCHMARK(UnorderedMapInsert, 1000)
+    {
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            std::unordered_map<u64, u64> map;
+            for(const u64 key: Keys)
+            {
+                map[key] = key;
+            }
+            DoNotOptimize(map.size());
+        }
+    }
+
+    SSSBENCHMARK(FlatHashMapFind, 1000)
+    {
+        FlatHashMap<u64, u64> map;
+        for(const u64 key: Keys)
+        {
+            map[key] = key;
+        }
+
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            u64 sum = 0;
+            for(const u64 key: Keys)
+            {
+                sum += *map.Find(key);
+                // NOTE: Half of the lookups miss
+                sum += map.Find(key + 1) != nullptr;
+            }
+            DoNotOptimize(sum);
+        }
+    }
+
+    SSSBENCHMARK(UnorderedMapFind, 1000)
+    {
+        std::unordered_map<u64, u64> map;
+        for(const u64 key: Keys)
+        {
+            map[key] = key;
+        }
+
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            u64 sum = 0;
+            for(const u64 key: Keys)
+            {
+                sum += map.find(key)->second;
+                sum += map.find(key + 1) != map.end();
+            }
+            DoNotOptimize(sum);
+        }
+    }
+} // namespace SSSBenchmark
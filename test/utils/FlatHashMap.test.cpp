@@ -0,0 +1,169 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include "Test.h"
+#include "FlatHashMap.h"
+
+using namespace SSSEngine;
+
+namespace SSSTest
+{
+    namespace
+    {
+        // NOTE: Every key in the same probe sequence, so lookups have to go through full groups and tombstones
+        struct CollidingHash
+        {
+            size operator()(u32) const noexcept
+            {
+                return 0;
+            }
+        };
+    } // namespace
+
+    SSSTEST_TEST(FlatHashMapBasic)
+    {
+        FlatHashMap<u32, std::string> map;
+        SSSTEST_EXPECT_EQ(map.Find(1), nullptr);
+        SSSTEST_EXPECT_EQ(map.Remove(1), false);
+
+        SSSTEST_EXPECT_EQ(map.Emplace(1, "one").second, true);
+        SSSTEST_EXPECT_EQ(map.Emplace(1, "uno").second, false);
+        map[2] = "two";
+        SSSTEST_EXPECT_EQ(*map.Find(1), "one");
+        SSSTEST_EXPECT_EQ(map[2], "two");
+        SSSTEST_EXPECT_EQ(map.GetSize(), 2);
+        SSSTEST_EXPECT_EQ(map.Contains(3), false);
+
+        FlatHashMap<u32, std::string> copy{map};
+        SSSTEST_EXPECT_EQ(map.Remove(1), true);
+        SSSTEST_EXPECT_EQ(map.Contains(1), false);
+        SSSTEST_EXPECT_EQ(*copy.Find(1), "one");
+
+        FlatHashMap<u32, std::string> moved{std::move(copy)};
+        SSSTEST_EXPECT_EQ(copy.IsEmpty(), true);
+        SSSTEST_EXPECT_EQ(moved.GetSize(), 2);
+
+        u32 keySum = 0;
+        for(const auto &entry: moved)
+        {
+            keySum += entry.Key;
+        }
+        SSSTEST_EXPECT_EQ(keySum, 3);
+
+        moved.Clear();
+        SSSTEST_EXPECT_EQ(moved.IsEmpty(), true);
+        SSSTEST_EXPECT_EQ(moved.Find(2), nullptr);
+    }
+
+    SSSTEST_TEST(FlatHashMapGrowth)
+    {
+        FlatHashMap<u64, u64> map;
+        map.Reserve(1000);
+        const size capacity = map.GetCapacity();
+        SSSTEST_EXPECT_GE(capacity, 1000);
+
+        for(u64 i = 0; i < 1000; ++i)
+        {
+            map[i * 7919] = i;
+        }
+        SSSTEST_EXPECT_EQ(map.GetCapacity(), capacity);
+
+        for(u64 i = 0; i < 100'000; ++i)
+        {
+            map[i * 7919] = i;
+        }
+        SSSTEST_EXPECT_EQ(map.GetSize(), 100'000);
+        for(u64 i = 0; i < 100'000; ++i)
+        {
+            SSSTEST_EXPECT_EQ(*map.Find(i * 7919), i);
+        }
+    }
+
+    SSSTEST_TEST(FlatHashMapCollisions)
+    {
+        FlatHashMap<u32, u32, CollidingHash> map;
+        for(u32 i = 0; i < 200; ++i)
+        {
+            map[i] = i;
+        }
+        for(u32 i = 0; i < 200; i += 2)
+        {
+            SSSTEST_EXPECT_EQ(map.Remove(i), true);
+        }
+        for(u32 i = 0; i < 200; ++i)
+        {
+            SSSTEST_EXPECT_EQ(map.Contains(i), i % 2 == 1);
+        }
+
+        // NOTE: Churn on a full table reuses the tombstones instead of growing forever
+        const size capacity = map.GetCapacity();
+        for(u32 i = 1000; i < 5000; ++i)
+        {
+            map[i] = i;
+            map.Remove(i);
+        }
+        SSSTEST_EXPECT_EQ(map.GetCapacity(), capacity);
+        SSSTEST_EXPECT_EQ(map.GetSize(), 100);
+    }
+
+    SSSTEST_TEST(FlatHashMapRandom)
+    {
+        FlatHashMap<u32, u32> map;
+        std::unordered_map<u32, u32> reference;
+        std::mt19937 random{11};
+
+        for(u32 step = 0; step < 200'000; ++step)
+        {
+            const u32 key = random() % 5000;
+            switch(random() % 3)
+            {
+                case 0:
+                    map[key] = step;
+                    reference[key] = step;
+                    break;
+                case 1:
+                    SSSTEST_EXPECT_EQ(map.Remove(key), reference.erase(key) == 1);
+                    break;
+                default:
+                {
+                    const u32 *value = map.Find(key);
+                    const auto it = reference.find(key);
+                    SSSTEST_EXPECT_EQ(value != nullptr, it != reference.end());
+                    if(value != nullptr && it != reference.end())
+                    {
+                        SSSTEST_EXPECT_EQ(*value, it->second);
+                    }
+                    break;
+                }
+            }
+        }
+
+        SSSTEST_EXPECT_EQ(map.GetSize(), reference.size());
+        size visited = 0;
+        for(const auto &entry: map)
+        {
+            SSSTEST_EXPECT_EQ(reference.at(entry.Key), entry.Value);
+            ++visited;
+        }
+        SSSTEST_EXPECT_EQ(visited, reference.size());
+    }
+} // namespace SSSTest
@@ -0,0 +1,116 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <memory>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "SlotMap.h"
+
+using namespace SSSEngine;
+
+namespace SSSBenchmark
+{
+    namespace
+    {
+        constexpr u32 ObjectCount = 10'000;
+
+        struct Object
+        {
+            f32 Position[3];
+            f32 Velocity[3];
+        };
+    } // namespace
+
+    // NOTE: Both containers had half of their objects removed at random, the usual state after a few frames of
+    // spawning and destroying
+    SSSBENCHMARK(SlotMapIterate, 1000)
+    {
+        SlotMap<Object> objects;
+        std::vector<SlotMap<Object>::Key> keys;
+        for(u32 i = 0; i < ObjectCount; ++i)
+        {
+            keys.push_back(objects.Insert({{0, 0, 0}, {1, 2, 3}}));
+        }
+        std::mt19937 random{1};
+        for(u32 i = 0; i < ObjectCount / 2; ++i)
+        {
+            objects.Remove(keys[random() % ObjectCount]);
+        }
+
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(Object &object: objects)
+            {
+                for(u32 axis = 0; axis < 3; ++axis)
+                {
+                    object.Position[axis] += object.Velocity[axis];
+                }
+            }
+            DoNotOptimize(objects.GetValues());
+        }
+    }
+
+    SSSBENCHMARK(PointerArrayIterate, 1000)
+    {
+        std::vector<std::unique_ptr<Object>> objects;
+        for(u32 i = 0; i < ObjectCount; ++i)
+        {
+            objects.push_back(std::make_unique<Object>(Object{{0, 0, 0}, {1, 2, 3}}));
+        }
+        std::mt19937 random{1};
+        for(u32 i = 0; i < ObjectCount / 2; ++i)
+        {
+            objects[random() % ObjectCount].reset();
+        }
+
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(const std::unique_ptr<Object> &object: objects)
+            {
+                if(object)
+                {
+                    for(u32 axis = 0; axis < 3; ++axis)
+                    {
+                        object->Position[axis] += object->Velocity[axis];
+                    }
+                }
+            }
+            DoNotOptimize(objects.data());
+        }
+    }
+
+    SSSBENCHMARK(SlotMapInsertRemove, 1000)
+    {
+        SlotMap<Object> objects;
+        std::vector<SlotMap<Object>::Key> keys(ObjectCount);
+        for(u64 i = 0; i < iterations; ++i)
+        {
+            for(u32 j = 0; j < ObjectCount; ++j)
+            {
+                keys[j] = objects.Insert({});
+            }
+            for(u32 j = 0; j < ObjectCount; ++j)
+            {
+                objects.Remove(keys[j]);
+            }
+        }
+        DoNotOptimize(objects.GetSize());
+    }
+} // namespace SSSBenchmark
@@ -0,0 +1,111 @@
+/*  SSS Engine
+    Copyright (C) 2025  Francisco Santos
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+    USA
+*/
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include "Test.h"
+#include "SlotMap.h"
+
+using namespace SSSEngine;
+
+namespace SSSTest
+{
+    SSSTEST_TEST(SlotMapInsertRemove)
+    {
+        SlotMap<u32> map;
+        SSSTEST_EXPECT_EQ(map.Contains({}), false);
+
+        const auto first = map.Insert(10);
+        const auto second = map.Insert(20);
+        const auto third = map.Insert(30);
+        SSSTEST_EXPECT_EQ(map.GetSize(), 3);
+        SSSTEST_EXPECT_EQ(map[second], 20);
+
+        // NOTE: The last value moves into the hole and its key still finds it
+        SSSTEST_EXPECT_EQ(map.Remove(first), true);
+        SSSTEST_EXPECT_EQ(map.Remove(first), false);
+        SSSTEST_EXPECT_EQ(map.Find(first), nullptr);
+        SSSTEST_EXPECT_EQ(map.GetValues()[0], 30);
+        SSSTEST_EXPECT_EQ(map[third], 30);
+        SSSTEST_EXPECT_EQ(map.GetKey(0), third);
+
+        // NOTE: The slot is reused with a new generation so the old key stays stale
+        const auto reused = map.Insert(40);
+        SSSTEST_EXPECT_EQ(reused.Index, first.Index);
+        SSSTEST_EXPECT_NEQ(reused.Generation, first.Generation);
+        SSSTEST_EXPECT_EQ(map.Contains(first), false);
+        SSSTEST_EXPECT_EQ(*map.Find(reused), 40);
+
+        u32 sum = 0;
+        for(const u32 value: map)
+        {
+            sum += value;
+        }
+        SSSTEST_EXPECT_EQ(sum, 90);
+
+        map.Clear();
+        SSSTEST_EXPECT_EQ(map.IsEmpty(), true);
+        SSSTEST_EXPECT_EQ(map.Contains(second), false);
+        SSSTEST_EXPECT_EQ(map.Insert(1).Index < 3, true);
+    }
+
+    SSSTEST_TEST(SlotMapMoveOnlyValues)
+    {
+        SlotMap<std::unique_ptr<i32>> map;
+        const auto first = map.Emplace(std::make_unique<i32>(1));
+        const auto second = map.Emplace(std::make_unique<i32>(2));
+        map.Remove(first);
+        SSSTEST_EXPECT_EQ(*map[second], 2);
+    }
+
+    SSSTEST_TEST(SlotMapRandom)
+    {
+        SlotMap<u64> map;
+        std::unordered_map<u32, std::pair<SlotMap<u64>::Key, u64>> reference;
+        std::mt19937 random{5};
+        u32 nextId = 0;
+
+        for(u32 step = 0; step < 100'000; ++step)
+        {
+            if(reference.empty() || random() % 2 == 0)
+            {
+                const u64 value = random();
+                reference[nextId++] = {map.Insert(value), value};
+            }
+            else
+            {
+                auto it = reference.begin();
+                std::advance(it, random() % (std::min<size>)(reference.size(), 8));
+                SSSTEST_EXPECT_EQ(map.Remove(it->second.first), true);
+                reference.erase(it);
+            }
+        }
+
+        SSSTEST_EXPECT_EQ(map.GetSize(), reference.size());
+        for(const auto &[id, entry]: reference)
+        {
+            SSSTEST_EXPECT_EQ(map[entry.first], entry.second);
+        }
+        for(size i = 0; i < map.GetSize(); ++i)
+        {
+            SSSTEST_EXPECT_EQ(map[map.GetKey(i)], map.GetValues()[i]);
+        }
+    }
+} // namespace SSSTest